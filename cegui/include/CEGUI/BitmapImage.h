@@ -81,7 +81,8 @@ protected:
     \brief
         Fills the vertices data for the textured quad based on the supplied
         parameters. The supplied pointer must point to an array of size 6
-        for the quad.
+        for the quad, of which the first four vertices are the corners in the
+        order expected by GeometryBuffer::appendQuad.
     */
     void createTexturedQuadVertices(
         TexturedColouredVertex* vbuffer,
@@ -79,6 +79,7 @@
 #include "CEGUI/Logger.h"
 #include "CEGUI/Cursor.h"
 #include "CEGUI/NamedElement.h"
+#include "CEGUI/Profiler.h"
 #include "CEGUI/Property.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/PropertySet.h"
@@ -33,6 +33,8 @@
 #include "CEGUI/Window.h"
 #include "CEGUI/CommonDialogs/ColourPicker/Types.h"
 
+#include <vector>
+
 #if defined(_MSC_VER)
 #   pragma warning(push)
 #   pragma warning(disable : 4251)
@@ -169,12 +171,17 @@ protected:
     void refreshAlphaSliderImage();
 
     void reloadColourPickerControlsTexture();
+    void blitColourImage(const std::vector<RGB_Colour>& image_data,
+                         const Rectf& area);
+    void initColourWheel();
 
     Lab_Colour getColourSliderPositionColourLAB(float value);
     Lab_Colour getColourPickingPositionColourLAB(float xAbs, float yAbs);
 
     HSV_Colour getColourSliderPositionColourHSV(float value);
     HSV_Colour getColourPickingPositionColourHSV(float xAbs, float yAbs);
+    void getColourWheelPosition(float xAbs, float yAbs,
+                                float& hue, float& radius) const;
 
     RGB_Colour getAlphaSliderPositionColour(int x, int y);
 
@@ -297,7 +304,19 @@ protected:
 
     bool d_draggingColourPickerIndicator;
 
-    RGB_Colour* d_colourPickingTexture;
+    //! pixels of the colour picking, colour slider and alpha slider images.
+    std::vector<RGB_Colour> d_colourPickingImageData;
+    std::vector<RGB_Colour> d_colourSliderImageData;
+    std::vector<RGB_Colour> d_alphaSliderImageData;
+    //! whether the image data changed since it was uploaded to the texture.
+    bool d_colourPickingImageChanged;
+    bool d_colourSliderImageChanged;
+    bool d_alphaSliderImageChanged;
+    //! RGBA pixels of the image being uploaded, see blitColourImage.
+    std::vector<std::uint8_t> d_blitPixels;
+    //! hue and radius of the HSV colour wheel at each colour picking pixel.
+    std::vector<float> d_colourWheelHue;
+    std::vector<float> d_colourWheelRadius;
 
     bool d_ignoreEvents;
     RegexMatcher& d_regexMatcher;
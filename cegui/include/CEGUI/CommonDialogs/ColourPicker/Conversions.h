@@ -34,6 +34,8 @@ the ColourPicker colour types
 #include "CEGUI/CommonDialogs/ColourPicker/Types.h"
 #include "CEGUI/Colour.h"
 
+#include <cstddef>
+
 #if defined(_MSC_VER)
 #   pragma warning(push)
 #   pragma warning(disable : 4251)
@@ -63,6 +65,29 @@ public:
     //! Function for converting a HSV to an RGB_Colour
     static RGB_Colour toRGB(const HSV_Colour& colour);
 
+    /*!
+    \brief
+        Convert \a count Lab colours, given as separate arrays of their L, a
+        and b components, to RGB_Colours.
+
+        The conversion is written without branches over blocks of colours, so
+        that the compiler can vectorise it. This is much faster than
+        converting the colours one at a time when generating images.
+    */
+    static void labToRGB(const float* L, const float* a, const float* b,
+                         RGB_Colour* out, size_t count);
+
+    /*!
+    \brief
+        Convert \a count HSV colours, given as separate arrays of their H, S
+        and V components, to RGB_Colours. The hues must be in the range [0, 1].
+
+        The conversion is written without branches over blocks of colours, so
+        that the compiler can vectorise it.
+    */
+    static void hsvToRGB(const float* H, const float* S, const float* V,
+                         RGB_Colour* out, size_t count);
+
     //! Conversion from RGB_Colour to CEGUI::Colour
     static CEGUI::Colour toCeguiColour(const RGB_Colour& colourRGB);
 
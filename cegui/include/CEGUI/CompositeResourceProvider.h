@@ -30,6 +30,7 @@ Author:   Hans Mackowiak (Hanmac) hanmac@gmx.de
 #include "CEGUI/IteratorBase.h"
 #include "CEGUI/ResourceProvider.h"
 #include <unordered_map>
+#include <unordered_set>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -108,6 +109,33 @@ public:
           ResourceProvider Pointer.
       */      
   ResourceProvider* get(const String& name);
+  /*!
+      \brief
+          discards the indexed file names of all providers.
+
+          The names of the files each provider has in a resource group are
+          indexed the first time a file is loaded from the group, so that
+          finding the provider holding a file is a hash look-up. Files added
+          later are found by indexing the group again when a look-up fails,
+          but files removed from a provider are only dropped from the index
+          when it is invalidated.
+
+      \return
+          Nothing.
+      */
+  void invalidateFileIndex();
+  /*!
+      \brief
+          discards the indexed file names of all providers for one resource
+          group.
+
+      \param resourceGroup
+          The resource group identifier whose index is to be discarded.
+
+      \return
+          Nothing.
+      */
+  void invalidateFileIndex(const String& resourceGroup);
 
   void loadRawDataContainer(const String& filename,
         RawDataContainer& output,
@@ -116,8 +144,18 @@ public:
          const String& file_pattern,
          const String& resource_group) override;
 protected:
+  //! return the provider that has the file, or nullptr if none does.
+  ResourceProvider* findProvider(const String& filename, const String& resourceGroup);
+  //! return the names of the files \a prov has in a resource group, indexing them if needed.
+  const std::unordered_set<String>& getFileIndex(ResourceProvider& prov, const String& resourceGroup);
+
   typedef std::unordered_map<String, ResourceProvider*> Providermap;
   Providermap  d_providerlist;
+
+  //! file names of one provider, by resource group.
+  typedef std::unordered_map<String, std::unordered_set<String> > FileIndexMap;
+  //! file names of each provider.
+  std::unordered_map<const ResourceProvider*, FileIndexMap> d_fileIndices;
 public:
   typedef ConstMapIterator<Providermap> ProviderIterator;
   ProviderIterator  getIterator() const;
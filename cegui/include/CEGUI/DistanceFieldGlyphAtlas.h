@@ -0,0 +1,205 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Defines a signed distance field glyph atlas shared by font sizes
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIDistanceFieldGlyphAtlas_h_
+#define _CEGUIDistanceFieldGlyphAtlas_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+#include "CEGUI/Rectf.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Colour.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class Texture;
+
+/*!
+\brief
+    Atlas of glyphs of one font face stored as signed distance fields, which
+    FreeTypeFont uses in distance field mode so that all sizes of a face
+    share the same glyph textures.
+
+    Each glyph is rasterised once at a fixed base size. Its coverage is then
+    turned into a distance field on the CPU: the alpha of every texel holds
+    the distance to the nearest edge of the outline, mapped so that 0.5 lies
+    on the edge, values above 0.5 inside the glyph and values below outside,
+    up to getSpread() base size pixels away. The field can be sampled at any
+    scale by a renderer supporting DefaultShaderType::DistanceField.
+
+    Atlases are shared per font file and resource group; they are obtained
+    with acquire and have to be given back with release.
+*/
+class CEGUIEXPORT DistanceFieldGlyphAtlas
+{
+public:
+    //! A glyph of the atlas, in pixels of the base size.
+    struct Glyph
+    {
+        //! Texture holding the glyph, or nullptr if the glyph has no outline.
+        Texture* d_texture = nullptr;
+        //! Area of the glyph's distance field in the texture.
+        Rectf d_area;
+        //! Offset of the top left of the area from the pen position.
+        glm::vec2 d_offset;
+        //! Unhinted horizontal advance.
+        float d_advance = 0.0f;
+    };
+
+    //! Pixel size at which glyphs are rasterised.
+    static const unsigned int BaseSize;
+    //! Distance, in pixels of the base size, covered by the distance field.
+    static const unsigned int Spread;
+    //! Width and height of the atlas textures.
+    static const unsigned int PageSize;
+
+    /*!
+    \brief
+        Returns the atlas for the font file \a filename of the resource group
+        \a resource_group, creating it if it does not exist yet, or nullptr
+        if the file is not a scalable font.
+
+    \exception GenericException
+        thrown if the font file can not be loaded.
+    */
+    static DistanceFieldGlyphAtlas* acquire(const String& filename,
+                                            const String& resource_group);
+
+    //! Gives back an atlas obtained by acquire, destroying it if unused.
+    static void release(DistanceFieldGlyphAtlas& atlas);
+
+    //! Returns the number of atlases that exist.
+    static size_t getAtlasCount();
+
+    /*!
+    \brief
+        Converts an 8 bit coverage bitmap into a signed distance field.
+
+        Coverage values of 128 and above are inside the outline. The
+        distances are exact euclidean distances between pixel centres, refined
+        by the coverage of the pixels on the edge.
+
+    \param coverage
+        Pointer to the first row of the coverage bitmap.
+
+    \param width
+        Width of the coverage bitmap.
+
+    \param height
+        Height of the coverage bitmap.
+
+    \param pitch
+        Number of bytes between the starts of two rows of the coverage bitmap.
+
+    \param spread
+        Distance, in pixels, at which the field reaches 0 outside and 255
+        inside the outline. The field is this many pixels larger than the
+        bitmap on each side.
+
+    \param field
+        Receives the (width + 2 * spread) * (height + 2 * spread) values of
+        the field, 128 being on the edge.
+    */
+    static void generateDistanceField(const std::uint8_t* coverage,
+        int width, int height, int pitch, int spread,
+        std::vector<std::uint8_t>& field);
+
+    /*!
+    \brief
+        Returns the glyph for \a code_point, generating its distance field if
+        needed, or nullptr if the face has no glyph for it. The textures are
+        not updated before the next call to flushUpload.
+    */
+    const Glyph* getGlyph(char32_t code_point);
+
+    //! Uploads the glyphs generated since the last upload to their texture.
+    void flushUpload();
+
+    //! Returns the number of glyphs generated.
+    size_t getGlyphCount() const { return d_glyphs.size(); }
+
+    //! Returns the number of textures used by the atlas.
+    size_t getTextureCount() const { return d_textures.size(); }
+
+private:
+    DistanceFieldGlyphAtlas(const String& filename, const String& resource_group);
+    ~DistanceFieldGlyphAtlas();
+
+    DistanceFieldGlyphAtlas(const DistanceFieldGlyphAtlas&) = delete;
+    DistanceFieldGlyphAtlas& operator=(const DistanceFieldGlyphAtlas&) = delete;
+
+    //! Generates the glyph for \a code_point and puts it into the atlas.
+    void generateGlyph(char32_t code_point, Glyph& glyph);
+    //! Finds space of the given size in the latest texture, adding one if full.
+    void allocate(int width, int height, int& x, int& y);
+    void createTexture();
+
+    //! Key of the atlas in the registry.
+    String d_key;
+    unsigned int d_refCount;
+    //! Font file data, kept alive for the face.
+    RawDataContainer d_fontData;
+    //! FreeType library and face used for this atlas only.
+    FT_Library d_library;
+    FT_Face d_face;
+
+    typedef std::unordered_map<char32_t, Glyph> GlyphMap;
+    GlyphMap d_glyphs;
+    std::vector<Texture*> d_textures;
+    //! Pixels of the latest texture.
+    std::vector<argb_t> d_pageBuffer;
+    //! Position and height of the current shelf in the latest texture.
+    int d_shelfX;
+    int d_shelfY;
+    int d_shelfHeight;
+    //! Area of the latest texture changed in the buffer but not yet uploaded
+    int d_uploadMinX;
+    int d_uploadMinY;
+    int d_uploadMaxX;
+    int d_uploadMaxY;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif	// end of guard _CEGUIDistanceFieldGlyphAtlas_h_
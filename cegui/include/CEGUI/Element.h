@@ -719,6 +719,17 @@ public:
     */
     Sizef calculatePixelSize(bool skipAllPixelAlignment = false) const;
 
+    /*!
+    \brief
+        Return \a size limited by this element's min and max size and adjusted
+        to its aspect mode and pixel alignment, as it would be when set as the
+        element's pixel size. This does not change the element.
+
+    \param size
+        The unconstrained size, in pixels.
+    */
+    Sizef constrainPixelSize(const Sizef& size) const;
+
     /*!
     \brief Return the pixel size of the parent element.
 
@@ -1152,6 +1163,23 @@ public:
     */
     virtual void adjustSizeToContent();
 
+    /*!
+    \brief
+        Return the size "adjustSizeToContent" would give the element, without
+        changing the element or firing any events.
+
+        This is the measure half of sizing an element to its content, while
+        "adjustSizeToContent" is the arrange half which applies the result.
+        Code that only needs to know the desired size should call this rather
+        than resizing the element and restoring it.
+
+        The default implementation calls "getSizeAdjustedToContent_direct".
+
+    \see adjustSizeToContent
+    \see getSizeAdjustedToContent_direct
+    */
+    virtual USize getSizeAdjustedToContent() const;
+
     /*!
     \brief
         Get the width of the content of the element.
@@ -1348,6 +1376,17 @@ public:
     */
     void adjustSizeToContent_direct();
 
+    /*!
+    \brief
+        Return the size "adjustSizeToContent_direct" would give the element,
+        without changing it. If the size isn't adjusted to the content, the
+        current size is returned.
+
+    \see adjustSizeToContent_direct
+    \see getSizeAdjustedToContent
+    */
+    USize getSizeAdjustedToContent_direct() const;
+
     /*!
     \brief
         Return a tiny number ("epsilon") serving as a "safety guard" for the
@@ -1419,7 +1458,9 @@ public:
         lines.
 
         The default implementation calls
-        "contentFitsForSpecifiedElementSize_tryByResizing".
+        "contentFitsForSpecifiedElementSize_tryByResizing". Since that resizes
+        the element on every call, element types that can compute the answer
+        from their content alone should override this method.
 
         This method is used by "getSizeAdjustedToContent_bisection".
 
@@ -263,6 +263,14 @@ public:
     */
     virtual void notifyDisplaySizeChanged(const Sizef& size);
 
+    /*!
+    \brief
+        Integrates the glyphs that finished rasterising in the background
+        since the last call. The FontManager calls this once per frame, before
+        rendering. Fonts that rasterise their glyphs on demand do nothing.
+    */
+    virtual void processPendingGlyphs();
+
     /*!
     \brief
         Return the pixel line spacing value for.
@@ -317,6 +325,10 @@ public:
         String object containing the text to return the rendered pixel
         width for.
 
+    \param defaultParagraphDir
+        The default paragraph direction the text is rendered with. Fonts that
+        shape text may measure it differently depending on the direction.
+
     \return
         Number of pixels that \a text will occupy when rendered with
         this Font.
@@ -335,7 +347,8 @@ public:
 
     \see getTextAdvance
     */
-    float getTextExtent(const String& text) const;
+    virtual float getTextExtent(const String& text,
+        DefaultParagraphDirection defaultParagraphDir = DefaultParagraphDirection::LeftToRight) const;
 
     /*!
     \brief
@@ -354,6 +367,10 @@ public:
     \param text
         String object containing the text to return the pixel advance for.
 
+    \param defaultParagraphDir
+        The default paragraph direction the text is rendered with. Fonts that
+        shape text may measure it differently depending on the direction.
+
     \return
         pixel advance of \a text when rendered with this Font.
 
@@ -371,7 +388,8 @@ public:
 
     \see getTextExtent
     */
-    float getTextAdvance(const String& text) const;
+    virtual float getTextAdvance(const String& text,
+        DefaultParagraphDirection defaultParagraphDir = DefaultParagraphDirection::LeftToRight) const;
 
     /*!
     \brief
@@ -466,6 +484,16 @@ public:
     */
     virtual void updateFont() = 0;
 
+    /*!
+    \brief
+        Return a counter that changes whenever text laid out by any font may
+        give different geometry than before, for example because a font was
+        resized or destroyed, received glyphs or grew a glyph texture. Code
+        caching text geometry compares it to know when its cache is stale.
+    */
+    static unsigned int getGlyphGeometryGeneration()
+    { return d_glyphGeometryGeneration; }
+
 protected:
     //! Constructor.
     Font(const String& name, const String& type_name, const String& filename,
@@ -538,6 +566,8 @@ protected:
     String d_resourceGroup;
     //! Holds default resource group for font loading.
     static String d_defaultResourceGroup;
+    //! incremented whenever text geometry laid out by a font may have changed.
+    static unsigned int d_glyphGeometryGeneration;
 
     //! maximal font ascender (pixels above the baseline)
     float d_ascender;
@@ -292,6 +292,13 @@ public:
     */
     void notifyDisplaySizeChanged(const Sizef& size);
 
+    /*!
+    \brief
+        Lets all fonts integrate the glyphs that finished rasterising in the
+        background. Called by the System once per frame, before rendering.
+    */
+    void processPendingGlyphs();
+
     /*!
     \brief
         Writes a full XML font file for the specified Font to the given
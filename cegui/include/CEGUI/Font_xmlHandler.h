@@ -52,6 +52,8 @@ public:
     static const String FontElement;
     //! Tag name for Mapping elements.
     static const String MappingElement;
+    //! Tag name for Fallback elements.
+    static const String FallbackElement;
     //! Attribute name that stores the specific font type.
     static const String FontTypeAttribute;
     //! Attribute name that stores the font name.
@@ -115,6 +117,8 @@ private:
 
     //! handles the opening Mapping XML element.
     void elementMappingStart(const XMLAttributes& attributes);
+    //! handles the opening Fallback XML element.
+    void elementFallbackStart(const XMLAttributes& attributes);
     //! creates a FreeTypeFont
     void createFreeTypeFont(const XMLAttributes& attributes);
     //! creates a PixmapFont
@@ -40,6 +40,7 @@ class Animation;
 class AnimationInstance;
 class AnimationManager;
 class BasicRenderedStringParser;
+class BitmapImage;
 class BidiVisualMapping;
 class CentredRenderedString;
 class Clipboard;
@@ -66,7 +67,10 @@ class GeometryBuffer;
 class GlobalEventSet;
 class GUIContext;
 class Image;
+class ImageAtlasBuilder;
+struct ImageAtlasStatistics;
 class ImageCodec;
+class ImageHandle;
 class ImageManager;
 class ImagerySection;
 class Interpolator;
@@ -111,6 +115,7 @@ class SchemeManager;
 class ScriptFunctor;
 class ScriptModule;
 class Sizef;
+class ShapedTextCache;
 class SimpleTimer;
 class SVGImage;
 class String;
@@ -118,6 +123,7 @@ class StringTranscoder;
 class System;
 class Texture;
 class TextureTarget;
+class TextureTargetPool;
 class TextUtils;
 class UBox;
 class UDim;
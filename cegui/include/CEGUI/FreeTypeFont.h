@@ -34,6 +34,12 @@
 #include "CEGUI/BitmapImage.h"
 #include "CEGUI/FontSizeUnit.h"
 #include "CEGUI/FreeTypeFontGlyph.h"
+#include "CEGUI/DistanceFieldGlyphAtlas.h"
+#ifdef CEGUI_USE_RAQM
+#include "CEGUI/ShapedTextCache.h"
+#endif
+
+#include <mutex>
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -51,7 +57,11 @@ namespace CEGUI
     like TTF and PS as well as on bitmap font formats like PCF and FON.
 
     Glyphs are rendered dynamically on demand, so a large font with lots
-    of glyphs won't slow application startup time.
+    of glyphs won't slow application startup time. Optionally they can be
+    rasterised on a background thread, see setUseAsyncRasterisation, or
+    rendered from distance fields shared by all sizes of the font file, see
+    setUseDistanceField. Code points missing from the font file are looked
+    up in a chain of fallback font files, see addFallbackFont.
 */
 class FreeTypeFont : public Font
 {
@@ -113,6 +123,21 @@ public:
     bool isCodepointAvailable(char32_t codePoint) const override;
     FreeTypeFontGlyph* getGlyphForCodepoint(const char32_t codePoint) const override;
 
+#ifdef CEGUI_USE_RAQM
+    // measure using the same shaped runs used for rendering.
+    float getTextExtent(const String& text,
+        DefaultParagraphDirection defaultParagraphDir = DefaultParagraphDirection::LeftToRight) const override;
+    float getTextAdvance(const String& text,
+        DefaultParagraphDirection defaultParagraphDir = DefaultParagraphDirection::LeftToRight) const override;
+
+    /*!
+    \brief
+        Return the cache of shaped text runs of this font, for setting its
+        memory limit and inspecting its hit and miss counts.
+    */
+    ShapedTextCache& getShapedTextCache() { return d_shapedTextCache; }
+#endif
+
     /*!
     \brief
         Sets the Font size of this font.
@@ -208,6 +233,110 @@ public:
     //! Sets the initial size to be used for any new glyph atlas texture.
     void setInitialGlyphAtlasSize(int val);
 
+    /*!
+    \brief
+        Sets whether glyphs are rasterised on a background thread instead of
+        the first time they are drawn.
+
+        A glyph that is not rasterised yet is queued to a worker thread, which
+        uses its own FreeType face. Until it is done, the glyph is laid out
+        with its unhinted advance and is not drawn. Finished glyphs are added
+        to the glyph atlas in one upload per frame by processPendingGlyphs,
+        which then fires EventRenderSizeChanged so that windows using this
+        font redraw their text.
+    */
+    void setUseAsyncRasterisation(bool use_async_rasterisation);
+
+    //! Returns whether glyphs are rasterised on a background thread.
+    bool getUsesAsyncRasterisation() const;
+
+    /*!
+    \brief
+        Rasterises the glyphs of all code points in \a code_points that are
+        not rasterised yet, for example the character set of a language when
+        it is loaded. Glyphs are queued to the background thread if
+        asynchronous rasterisation is used; otherwise they are rasterised
+        immediately and uploaded together.
+    */
+    void prewarmGlyphs(const String& code_points);
+
+    //! Rasterises the glyphs of all code points from \a first to \a last.
+    void prewarmGlyphs(char32_t first, char32_t last);
+
+    //! Returns the number of glyphs waiting to be rasterised in the background.
+    size_t getPendingGlyphCount() const;
+
+    /*!
+    \brief
+        Waits until all glyphs queued for background rasterisation are done
+        and adds them to the glyph atlas.
+    */
+    void waitForPendingGlyphs();
+
+    void processPendingGlyphs() override;
+
+    /*!
+    \brief
+        Sets whether glyphs are rendered from signed distance fields instead
+        of bitmaps rasterised at the size of this font.
+
+        The distance fields are kept in a DistanceFieldGlyphAtlas shared by
+        all FreeTypeFonts using the same font file, whatever their size, so
+        fonts of several sizes hold one atlas and changing the size or the
+        auto scaling does not rasterise the glyphs again. Glyphs are laid out
+        unhinted and drawn at fractional positions, and the anti-aliasing and
+        asynchronous rasterisation settings do not apply.
+
+        This only takes effect for scalable fonts and if the Renderer
+        supports DefaultShaderType::DistanceField; otherwise bitmap glyphs
+        are used.
+    */
+    void setUseDistanceField(bool use_distance_field);
+
+    //! Returns whether rendering glyphs from distance fields was requested.
+    bool getUsesDistanceField() const;
+
+    /*!
+    \brief
+        Returns the atlas the glyphs are rendered from, or nullptr if the font
+        renders bitmap glyphs.
+    */
+    const DistanceFieldGlyphAtlas* getDistanceFieldAtlas() const;
+
+    /*!
+    \brief
+        Appends a font file to the chain of fallback fonts, whose glyphs are
+        used for the code points this font has no glyph for. The chain is
+        searched in the order the fallbacks were added.
+
+        A fallback font is created at the pixel size and with the
+        anti-aliasing and distance field settings of this font, and is shared
+        by all FreeTypeFonts falling back to the same file with the same
+        settings, so its glyphs are rasterised once for all of them. Fallback
+        glyphs are always rasterised when they are first drawn.
+
+    \param filename
+        The filename of the font file to fall back to.
+
+    \param resource_group
+        The resource group identifier to use when loading \a filename, or an
+        empty string for the default resource group of fonts.
+    */
+    void addFallbackFont(const String& filename, const String& resource_group = "");
+
+    //! Removes all fonts from the chain of fallback fonts.
+    void clearFallbackFonts();
+
+    //! Returns the number of fonts in the chain of fallback fonts.
+    size_t getFallbackFontCount() const;
+
+    /*!
+    \brief
+        Returns the shared font created for the fallback at \a index of the
+        chain, or nullptr if \a index is out of range.
+    */
+    const FreeTypeFont* getFallbackFont(size_t index) const;
+
 protected:
     /*!
         A data structure containing info about one horizontal line inside
@@ -235,11 +364,37 @@ protected:
         mutable int d_maximumExtentY = 0;
     };
 
+    //! The rasterised bitmap and metrics of a glyph, before it is put into an atlas.
+    struct GlyphBitmap
+    {
+        char32_t d_codePoint = 0;
+        //! False if the glyph could not be loaded.
+        bool d_loaded = false;
+        int d_width = 0;
+        int d_height = 0;
+        //! Offset of the bitmap from the pen position.
+        glm::vec2 d_offset;
+        float d_advance = 0.0f;
+        long d_lsbDelta = 0;
+        long d_rsbDelta = 0;
+        std::vector<argb_t> d_pixels;
+    };
+
+    //! Worker thread rasterising glyphs with its own FreeType face.
+    struct AsyncRasteriser;
+
     //! Type for mapping codepoints to the corresponding Freetype Font glyphs
     typedef std::unordered_map<char32_t, FreeTypeFontGlyph*> CodePointToGlyphMap;
     //! Type for mapping Freetype indices to the corresponding Freetype Font glyphs
     typedef std::unordered_map<FT_UInt, char32_t> IndexToCodePointMap;
 
+    //! The font file and resource group of a fallback font.
+    struct FallbackFontSource
+    {
+        String d_filename;
+        String d_resourceGroup;
+    };
+
     /*!
     \brief
         Updates a part of the buffer data, which equates to a sub-image inside the 
@@ -276,19 +431,71 @@ protected:
     void checkUnicodeCharMapAvailability();
     void tryToCreateFontWithClosestFontHeight(
         FT_Error errorResult, int requestedFontPixelHeight) const;
-    //! initialise FontGlyph for given codepoint.
+    /*!
+    \brief
+        Initialises the FontGlyph for the given codepoint. Rasterised glyphs
+        are not uploaded to the atlas texture until flushGlyphAtlasUpload.
+    */
     void prepareGlyph(FreeTypeFontGlyph* glyph) const;
 
+    //! Loads and renders a glyph into the glyph slot of \a face.
+    static FT_Error loadGlyph(FT_Face face, char32_t codePoint, bool antiAliased);
+    //! Copies the glyph rendered in the glyph slot of \a face.
+    static void readGlyphBitmap(FT_Face face, GlyphBitmap& bitmap);
+    //! Adds a rasterised glyph to the atlas and sets the glyph's metrics.
+    void addGlyphBitmap(FreeTypeFontGlyph* glyph, const GlyphBitmap& bitmap) const;
+    //! Uploads the part of the latest atlas texture changed since the last upload.
+    void flushGlyphAtlasUpload() const;
+
+    //! Queues a glyph for rasterisation on the background thread.
+    void queueGlyph(FreeTypeFontGlyph* glyph) const;
+
+    //! Initialises the FontGlyph from the distance field glyph atlas.
+    void prepareDistanceFieldGlyph(FreeTypeFontGlyph* glyph) const;
+
+    /*!
+    \brief
+        Returns the distance field glyph atlas for this font's file if it is
+        to be used, or nullptr.
+    */
+    DistanceFieldGlyphAtlas* acquireDistanceFieldAtlas() const;
+
+    /*!
+    \brief
+        Returns the shared font for \a source at the given effective pixel
+        size and the settings of this font, creating it if needed. Every
+        call must be matched by a call to releaseFallbackFont.
+    */
+    FreeTypeFont* acquireFallbackFont(const FallbackFontSource& source,
+                                      unsigned int pixelSize) const;
+
+    //! Releases a font returned by acquireFallbackFont.
+    static void releaseFallbackFont(FreeTypeFont* font);
+
+    //! Releases all fonts of \a fonts and clears it.
+    static void releaseFallbackFonts(std::vector<FreeTypeFont*>& fonts);
+
+    //! Returns the glyph of this font for \a codePoint, without the fallbacks.
+    FreeTypeFontGlyph* findOwnGlyph(char32_t codePoint) const;
+
+    /*!
+    \brief
+        Returns the prepared glyph for \a codePoint from this font or the
+        first fallback having it, and sets \a owner to the font it is from.
+    */
+    const FreeTypeFontGlyph* getPreparedGlyph(char32_t codePoint,
+                                              const FreeTypeFont*& owner) const;
+
     void initialiseGlyphMap();
 
     void handleFontSizeOrFontUnitChange();
 
-    //! Rasterises the glyph and adds it into a glyph atlas texture
-    void rasterise(FreeTypeFontGlyph* glyph) const;
+    //! Adds the rasterised glyph into a glyph atlas texture
+    void rasterise(FreeTypeFontGlyph* glyph, const GlyphBitmap& bitmap) const;
     
     //! Helper functions for rasterisation
     void addRasterisedGlyphToTextureAndSetupGlyphImage(
-        FreeTypeFontGlyph* glyph, Texture* texture, int glyphWidth, int glyphHeight,
+        FreeTypeFontGlyph* glyph, Texture* texture, const GlyphBitmap& bitmap,
         const TextureGlyphLine& glyphTexLine) const;
 
     void findFittingSpotInGlyphTextureLines(int glyphWidth, int glyphHeight,
@@ -311,6 +518,37 @@ protected:
         glm::vec2& penPosition) const override;
 
 #ifdef CEGUI_USE_RAQM
+    /*!
+    \brief
+        Return the glyphs of \a text shaped with paragraph direction \a dir,
+        from the shaped text cache if possible. The run is valid until the
+        next call.
+    */
+    const ShapedTextCache::Run& getShapedRun(const std::u32string& text,
+                                             DefaultParagraphDirection dir) const;
+
+    /*!
+    \brief
+        Return the prepared glyph for a glyph index of the face, or the
+        replacement character glyph if the index maps to no code point.
+    */
+    const FreeTypeFontGlyph* getPreparedGlyphForIndex(unsigned int glyphIndex) const;
+
+    /*!
+    \brief
+        Position the glyphs of \a text shaped with paragraph direction \a dir
+        and call \a glyphFunc with each glyph and its horizontal position.
+        Rendering and measuring both place the glyphs through this, so the
+        measured sizes always match the rendered text.
+
+    \param penPositionX
+        The pen position to start at, advanced past the text on return.
+    */
+    template <typename GlyphFunc>
+    void placeShapedGlyphs(const std::u32string& text, DefaultParagraphDirection dir,
+                           float space_extra, float& penPositionX,
+                           GlyphFunc glyphFunc) const;
+
     std::vector<GeometryBuffer*> layoutUsingRaqmAndCreateRenderGeometry(
         const String& text, const Rectf* clip_rect, const ColourRect& colours,
         const float space_extra, ImageRenderSettings imgRenderSettings,
@@ -332,6 +570,8 @@ protected:
     bool d_antiAliased;
     //! FreeType-specific font handle
     FT_Face d_fontFace;
+    //! Serialises kerning lookups on d_fontFace from windows built in parallel.
+    mutable std::mutex d_fontFaceMutex;
     //! Font file data
     RawDataContainer d_fontData;
     //! Type definition for TextureVector.
@@ -357,6 +597,33 @@ protected:
     mutable std::vector<argb_t> d_lastTextureBuffer;
     //! Contains information about the extents of each line of glyphs of the latest texture
     mutable std::vector<TextureGlyphLine> d_textureGlyphLines;
+    //! Area of the latest texture changed in the buffer but not yet uploaded
+    mutable int d_uploadMinX = 0;
+    mutable int d_uploadMinY = 0;
+    mutable int d_uploadMaxX = 0;
+    mutable int d_uploadMaxY = 0;
+    //! True if glyphs are rasterised on a background thread.
+    bool d_useAsyncRasterisation = false;
+    //! The background rasteriser, created when the first glyph is queued.
+    AsyncRasteriser* d_asyncRasteriser = nullptr;
+    //! True if glyphs are to be rendered from distance fields.
+    bool d_useDistanceField = false;
+    //! The shared atlas glyphs are rendered from, if distance fields are used.
+    DistanceFieldGlyphAtlas* d_distanceFieldAtlas = nullptr;
+    //! Scale from the atlas' base size to the size of this font.
+    float d_distanceFieldScale = 1.0f;
+    //! The fallback fonts, in the order they are searched.
+    std::vector<FallbackFontSource> d_fallbackSources;
+    //! The shared fonts created for d_fallbackSources at the current size.
+    std::vector<FreeTypeFont*> d_fallbackFonts;
+    //! The effective pixel size the fallback fonts were created for.
+    unsigned int d_fallbackPixelSize = 0;
+#ifdef CEGUI_USE_RAQM
+    //! Shaped text runs for the current face and size.
+    mutable ShapedTextCache d_shapedTextCache;
+    //! Guards d_shapedTextCache, whose lookups update its usage order.
+    mutable std::mutex d_shapedTextCacheMutex;
+#endif
 };
 
 } // End of  CEGUI namespace section
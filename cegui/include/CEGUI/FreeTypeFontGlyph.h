@@ -70,6 +70,12 @@ public:
     //! return whether the glyph is valid
     bool isInitialised() const;
 
+    //! set whether the glyph is waiting to be rasterised in the background
+    void setPending(bool pending);
+
+    //! return whether the glyph is waiting to be rasterised in the background
+    bool isPending() const;
+
     void setLsbDelta(const long lsbDelta);
     long getLsbDelta() const;
     void setRsbDelta(const long rsbDelta);
@@ -88,6 +94,9 @@ private:
 
     //! Says whether this glyph is initialised or not
     bool d_initialised = false;
+
+    //! Says whether this glyph is queued for background rasterisation
+    bool d_pending = false;
 };
 
 }
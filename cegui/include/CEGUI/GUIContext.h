@@ -34,6 +34,7 @@
 #include "CEGUI/WindowNavigator.h"
 
 #include <map>
+#include <vector>
 
 #if defined (_MSC_VER)
 #   pragma warning(push)
@@ -223,10 +224,38 @@ public:
     */
     void setWindowNavigator(WindowNavigator* navigator);
 
+    /*!
+    \brief
+        Set how many threads build the geometry of the windows that need a
+        redraw when the context is drawn, including the thread calling draw.
+
+        With more than one thread, the windows are collected first, their
+        geometry is built in parallel and it is then queued in draw order on
+        the calling thread. This only happens if the Renderer can create
+        geometry buffers from several threads, and only for windows whose
+        WindowRenderer allows it; all other geometry is built as before.
+        A value of 0 or 1, the default, builds all geometry on the calling
+        thread.
+
+    \see Renderer::isGeometryBufferCreationThreadSafe
+    \see WindowRenderer::isGeometryBuildThreadSafe
+    */
+    void setGeometryBuildThreadCount(unsigned int count);
+
+    //! Return the number of threads set by setGeometryBuildThreadCount.
+    unsigned int getGeometryBuildThreadCount() const;
+
 protected:
     void updateRootWindowAreaRects() const;
     void drawWindowContentToTarget();
     void renderWindowHierarchyToSurfaces();
+    //! build the geometry of windows needing a redraw on the worker threads.
+    void buildWindowGeometryInParallel();
+    //! collect, in draw order, the windows whose geometry workers may build.
+    void collectGeometryBuildWindows(Window& window,
+                                     std::vector<Window*>& windows) const;
+    //! compute the cached areas of a hierarchy, so workers only read them.
+    void updateGeometryBuildCaches(const Window& window) const;
 
     void createDefaultTooltipWindowInstance() const;
     void destroyDefaultTooltipWindowInstance();
@@ -302,6 +331,12 @@ protected:
 
     //! the window navigator (if any) used to navigate the GUI
     WindowNavigator* d_windowNavigator;
+
+    struct GeometryBuildPool;
+    //! threads building window geometry, including the calling thread.
+    unsigned int d_geometryBuildThreadCount;
+    //! the worker threads, if d_geometryBuildThreadCount is above 1.
+    GeometryBuildPool* d_geometryBuildPool;
 };
 
 }
@@ -37,6 +37,7 @@
 #include <glm/gtc/quaternion.hpp>
 
 #include <vector>
+#include <cstdint>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -164,6 +165,12 @@ public:
     */
     void setCustomTransform(const glm::mat4x4& transformation);
 
+    /*!
+    \brief
+        Gets the custom transformation matrix applied to the geometry.
+    */
+    const glm::mat4x4& getCustomTransform() const;
+
     /*!
     \brief
         Set the clipping region to be used when rendering this buffer. The
@@ -202,6 +209,26 @@ public:
     */
     void setStencilPostRenderingVertexCount(unsigned int vertex_count);
 
+    /*!
+    \brief
+        Gets the fill rule that is used when rendering the geometry.
+    */
+    PolygonFillRule getStencilFillRule() const;
+
+    /*!
+    \brief
+        Gets the number of vertices that are rendered after the stencil buffer was filled.
+    */
+    unsigned int getStencilPostRenderingVertexCount() const;
+
+    /*!
+    \brief
+        Gets the raw vertex data buffered in this GeometryBuffer, laid out as
+        described by the vertex attributes. If the buffer is quad indexed, the
+        data holds four vertices per quad.
+    */
+    const std::vector<float>& getVertexData() const;
+
     /*!
     \brief
         Append the geometry data to the existing data
@@ -279,6 +306,63 @@ public:
     */
     virtual void appendGeometry(const TexturedColouredVertex* vertex_array, std::size_t vertex_count);
 
+    /*!
+    \brief
+        Append a textured quad to the GeometryBuffer.
+
+        If the renderer supports it, quads are stored as four vertices each and
+        drawn with the renderer's shared quad index buffer instead of as two
+        independent triangles. The buffer falls back to plain triangles as soon
+        as any other geometry is appended to it, a stencil fill rule is set or
+        it holds more quads than a 16 bit index can address.
+
+    \param corners
+        Pointer to an array of four vertices, in the order top-left,
+        bottom-left, bottom-right and top-right.
+    */
+    void appendQuad(const TexturedColouredVertex* corners);
+
+    /*!
+    \brief
+        Append textured quads given as raw vertex data, such as the vertex
+        data of a quad indexed GeometryBuffer. The quads stay indexed if
+        appendQuad would keep them indexed.
+
+    \param vertex_data
+        Pointer to the vertex data of the quads, four vertices per quad in the
+        order appendQuad expects.
+
+    \param quad_count
+        The number of quads in \a vertex_data.
+    */
+    void appendQuads(const float* vertex_data, std::size_t quad_count);
+
+    /*!
+    \brief
+        Returns whether the geometry of this GeometryBuffer is stored as
+        indexed quads, each made of four vertices that are drawn using the
+        shared quad indices.
+    */
+    bool isQuadIndexed() const;
+
+    /*!
+    \brief
+        Returns the number of indices used to draw this GeometryBuffer, or 0 if
+        it is not indexed.
+    */
+    std::size_t getIndexCount() const;
+
+    /*!
+    \brief
+        Returns the indices shared by all quad indexed GeometryBuffers, six per
+        quad for the largest number of quads a GeometryBuffer may hold indexed.
+        Renderers upload these once and reuse them for every buffer.
+    */
+    static const std::vector<std::uint16_t>& getQuadIndices();
+
+    //! The largest number of quads a GeometryBuffer keeps indexed.
+    static const std::size_t MaxIndexedQuadCount = 16384;
+
     /*!
     \brief
         A helper function that sets a texture parameter of the RenderMaterial of this
@@ -499,13 +583,26 @@ public:
     \brief
         Scales the texture coordinates of this geometry buffer by the supplied factor, if the
         texture is matching the texture (if one exists) of this geometry buffer.
+
+        The vertex data is modified in place; renderers that keep a copy of it
+        in a hardware buffer override this to update that copy as well.
     */
-    void updateTextureCoordinates(const Texture* texture, const float scaleFactor);
+    virtual void updateTextureCoordinates(const Texture* texture, const float scaleFactor);
 
 
 protected:  
     GeometryBuffer(RefCounted<RenderMaterial> renderMaterial);
 
+    //! Returns whether the next quad can be appended as an indexed quad.
+    bool canAppendIndexedQuad() const;
+
+    /*!
+    \brief
+        Converts quad indexed vertex data to plain triangles, six vertices per
+        quad, and marks the buffer as no longer indexed.
+    */
+    void expandIndexedQuads();
+
     //! Reference to the RenderMaterial used for this GeometryBuffer
     RefCounted<RenderMaterial>  d_renderMaterial;
 
@@ -564,6 +661,12 @@ protected:
     bool            d_clippingActive;
     //! The alpha value which will be applied to the whole buffer when rendering
     float           d_alpha;
+    //! Whether the renderer can draw this buffer using the shared quad indices.
+    bool            d_quadIndexingSupported;
+    //! True if the vertex data is stored as four vertices per indexed quad.
+    bool            d_quadIndexed;
+    //! True while appendQuad is appending the vertices of an indexed quad.
+    bool            d_appendingIndexedQuad;
 
 };
 
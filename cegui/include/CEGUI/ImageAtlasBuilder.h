@@ -0,0 +1,199 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Packs bitmap image data into shared atlas textures
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIImageAtlasBuilder_h_
+#define _CEGUIImageAtlasBuilder_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+#include "CEGUI/Sizef.h"
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//! Figures describing the outcome of a call to ImageAtlasBuilder::build().
+struct ImageAtlasStatistics
+{
+    //! Number of textures the sources would use without atlasing.
+    size_t d_texturesBefore;
+    //! Number of textures used after atlasing (pages + rejected sources).
+    size_t d_texturesAfter;
+    //! Number of atlas pages that were created.
+    size_t d_pageCount;
+    //! Fraction of the atlas pages' area covered by image data.
+    float d_fillRatio;
+};
+
+/*!
+\brief
+    Packs the pixel data of several small bitmap sources - loose image files
+    and small imagesets - into a few shared atlas textures.
+
+    Sources are decoded on the CPU via the system's ImageCodec when they are
+    added. Calling build() packs them into atlas pages, creates the page
+    textures through the Renderer and then rewrites every BitmapImage that
+    referenced a source so that it uses the atlas page and the matching sub
+    area of it. Source textures that were atlased are destroyed.
+
+    Because the decoded data is kept on the CPU until build() is called, this
+    works with any renderer, including the NullRenderer.
+*/
+class CEGUIEXPORT ImageAtlasBuilder
+{
+public:
+    //! Figures describing the outcome of a call to build().
+    typedef ImageAtlasStatistics Statistics;
+
+    /*!
+    \brief
+        Constructor.
+
+    \param name
+        Name used as prefix for the atlas page textures created by the builder.
+
+    \param page_size
+        Size, in pixels, of each atlas page texture.
+
+    \param max_source_size
+        Largest source, in pixels, that will be accepted into the atlas. Larger
+        sources are rejected and keep their own texture.
+    */
+    ImageAtlasBuilder(const String& name,
+                      const Sizef& page_size = Sizef(1024.0f, 1024.0f),
+                      const Sizef& max_source_size = Sizef(256.0f, 256.0f));
+
+    ~ImageAtlasBuilder();
+
+    /*!
+    \brief
+        Load an image file into a texture of its own for \a image, named after
+        the image, and queue it for packing into the atlas. The image is given
+        the whole file as its image area and renders from its own texture until
+        build() moves it onto an atlas page and destroys that texture.
+
+        The file is decoded only once, whether it is accepted or not.
+
+    \return
+        - true if the file was accepted.
+        - false if the file could not be decoded or is too large, in which case
+          \a image just keeps its own texture.
+    */
+    bool addImageFile(BitmapImage& image, const String& filename,
+                      const String& resource_group);
+
+    /*!
+    \brief
+        Queue an existing texture, which was loaded from \a filename, for
+        packing into the atlas. On build() every BitmapImage that uses
+        \a texture is moved onto the atlas and \a texture is destroyed.
+
+    \return
+        - true if the texture was accepted.
+        - false if the file could not be decoded or is too large.
+    */
+    bool addTexture(Texture& texture, const String& filename,
+                    const String& resource_group);
+
+    /*!
+    \brief
+        Remove any queued source for \a image, which is about to be destroyed.
+        The own texture of an image file queued by addImageFile is destroyed.
+    */
+    void discardImage(const Image& image);
+
+    /*!
+    \brief
+        Remove any queued source for \a texture, which is about to be
+        destroyed.
+    */
+    void discardTexture(const Texture& texture);
+
+    //! Return the number of sources queued since the last build().
+    size_t getPendingSourceCount() const;
+
+    /*!
+    \brief
+        Pack all queued sources into atlas pages, create the page textures and
+        rewrite the affected images.
+
+    \return
+        Statistics for the sources packed by this call.
+    */
+    const Statistics& build();
+
+    //! Return the statistics of the last call to build().
+    const Statistics& getStatistics() const;
+
+    //! Return all atlas page textures created by this builder.
+    const std::vector<Texture*>& getPages() const;
+
+private:
+    //! A queued source together with its decoded RGBA pixels.
+    struct Source
+    {
+        Texture* d_texture;
+        BitmapImage* d_image;
+        std::vector<std::uint8_t> d_pixels;
+        unsigned int d_width;
+        unsigned int d_height;
+        unsigned int d_x;
+        unsigned int d_y;
+        size_t d_page;
+    };
+
+    bool decodeSource(Source& source, const String& filename,
+                      const String& resource_group) const;
+    bool fitsAtlas(const Source& source) const;
+    size_t packSources();
+    void createPage(size_t page_index);
+    void rewriteImages(const std::vector<Source*>& sources);
+
+    String d_name;
+    unsigned int d_pageWidth;
+    unsigned int d_pageHeight;
+    Sizef d_maxSourceSize;
+
+    std::vector<Source*> d_sources;
+    std::vector<Texture*> d_pages;
+    size_t d_rejectedCount;
+    Statistics d_statistics;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIImageAtlasBuilder_h_
@@ -0,0 +1,99 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Handle caching the Image registered under a name
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIImageHandle_h_
+#define _CEGUIImageHandle_h_
+
+#include "CEGUI/String.h"
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Refers to an Image by name and caches the Image it resolves to, so code
+    that draws the same image repeatedly does not look it up in the
+    ImageManager every time.
+
+    The cached pointer is dropped whenever the ImageManager destroys an image,
+    after which the name is resolved again on the next access. An image that
+    is destroyed and recreated under the same name is therefore picked up
+    automatically.
+*/
+class CEGUIEXPORT ImageHandle
+{
+public:
+    ImageHandle();
+    explicit ImageHandle(const String& name);
+
+    //! Set the name of the Image this handle refers to.
+    void setName(const String& name);
+
+    //! Return the name of the Image this handle refers to.
+    const String& getName() const { return d_name; }
+
+    //! Return whether this handle refers to no Image at all.
+    bool empty() const { return d_name.empty(); }
+
+    /*!
+    \brief
+        Return the Image this handle refers to.
+
+    \exception UnknownObjectException
+        thrown if no Image is registered under the name of this handle.
+    */
+    Image& get() const;
+
+    ImageHandle& operator=(const String& name);
+
+    bool operator==(const ImageHandle& other) const
+        { return d_name == other.d_name; }
+    bool operator!=(const ImageHandle& other) const
+        { return d_name != other.d_name; }
+
+private:
+    //! name of the Image.
+    String d_name;
+    //! Image the name resolved to, or nullptr if not yet resolved.
+    mutable Image* d_image;
+    //! ImageManager image generation at which d_image was resolved.
+    mutable unsigned int d_generation;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIImageHandle_h_
+
@@ -144,6 +144,15 @@ public:
     void loadImageset(const String& filename, const String& resource_group = "");
     void loadImagesetFromString(const String& source);
 
+    /*!
+    \brief
+        Destroy all images whose names start with \a prefix followed by a '/',
+        such as the images of an imageset, and optionally the texture named
+        \a prefix.
+
+        Images are indexed by collection, so this only visits the images in
+        the collection.
+    */
     void destroyImageCollection(const String& prefix,
                                 const bool delete_texture = true);
 
@@ -151,6 +160,50 @@ public:
                           const String& filename,
                           const String& resource_group = "");
 
+    /*!
+    \brief
+        Set whether loose image files added via addBitmapImageFromFile and the
+        textures of small bitmap imagesets are packed into shared atlas
+        textures rather than each using a texture of its own.
+
+        While enabled, such images are queued and only move onto an atlas
+        texture when buildImageAtlas is called; until then they render from a
+        texture of their own. Scheme calls it automatically once it has loaded
+        its resources. An atlas page texture is destroyed
+        together with the last image using it.
+    */
+    void setImageAtlasingEnabled(bool enabled);
+
+    //! Return whether image atlasing is enabled.
+    bool isImageAtlasingEnabled() const;
+
+    //! Set the size, in pixels, of the atlas page textures.
+    void setImageAtlasPageSize(const Sizef& size);
+
+    //! Return the size, in pixels, of the atlas page textures.
+    const Sizef& getImageAtlasPageSize() const;
+
+    /*!
+    \brief
+        Set the size, in pixels, of the largest image file or imageset texture
+        that will be packed into an atlas. Larger ones keep their own texture.
+    */
+    void setImageAtlasMaxSourceSize(const Sizef& size);
+
+    //! Return the largest image size that will be packed into an atlas.
+    const Sizef& getImageAtlasMaxSourceSize() const;
+
+    /*!
+    \brief
+        Pack every image queued for atlasing since the last call into atlas
+        pages and point the images at them.
+
+    \return
+        Statistics on the number of textures before and after packing and the
+        fill ratio of the atlas pages.
+    */
+    ImageAtlasStatistics buildImageAtlas();
+
     /*!
     \brief
         Notify the ImageManager that the display size may have changed.
@@ -201,6 +254,28 @@ public:
     */
     ImageIterator getIterator() const;
 
+    //! container type holding the images of one collection, by name.
+    typedef std::unordered_map<String, Image*> ImageCollection;
+
+    //! ConstBaseIterator type definition for a collection.
+    typedef ConstMapIterator<ImageCollection> ImageCollectionIterator;
+
+    /*!
+    \brief
+        Return a ImageManager::ImageCollectionIterator object to iterate over
+        the images whose names start with \a prefix followed by a '/'.
+    */
+    ImageCollectionIterator getCollectionIterator(const String& prefix) const;
+
+    /*!
+    \brief
+        Return a counter that changes whenever an image is destroyed. Code
+        caching Image pointers, such as ImageHandle, compares it to know when
+        its pointers may have become dangling.
+    */
+    static unsigned int getImageGeneration()
+        { return d_imageGeneration; }
+
 private:
     // implement chained xml handler abstract interface
     void elementStartLocal(const String& element, const XMLAttributes& attributes) override;
@@ -212,12 +287,25 @@ private:
     //! helper to delete an image given an map iterator.
     void destroy(ImageMap::iterator& iter);
 
+    //! add an image to the container and the collections it belongs to.
+    void addImage(Image& image, ImageFactory* factory);
+
     // XML parsing helper functions.
     void elementImagesetStart(const XMLAttributes& attributes);
 
     // Get or create the Imageset's texture
     void retrieveImagesetTexture(const String& name, const String& filename, const String &resource_group);
 
+    //! Return the atlas builder that queues images, creating it if needed.
+    ImageAtlasBuilder& getPendingImageAtlas();
+
+    /*!
+    \brief
+        Notify that an image placed on the atlas page \a page is going away,
+        destroying the page once no image uses it anymore.
+    */
+    void releaseImageAtlasPage(const Texture& page);
+
     // Get or create the Imageset's SVGData
     void retrieveImagesetSVGData(const String& name, const String& filename, const String &resource_group);
 
@@ -227,11 +315,28 @@ private:
 
     //! Default resource group specifically for Imagesets.
     static String d_imagesetDefaultResourceGroup;
+    //! incremented whenever an image is destroyed.
+    static unsigned int d_imageGeneration;
 
     //! container holding the factories.
     ImageFactoryRegistry d_factories;
     //! container holding the images.
     ImageMap d_images;
+    //! images indexed by every '/' terminated prefix of their names.
+    std::unordered_map<String, ImageCollection> d_imageCollections;
+
+    //! whether image files and small imagesets are packed into atlases.
+    bool d_imageAtlasingEnabled;
+    //! size of the atlas page textures.
+    Sizef d_imageAtlasPageSize;
+    //! largest source that is packed into an atlas.
+    Sizef d_imageAtlasMaxSourceSize;
+    //! builder holding the images queued for the next atlas, if any.
+    ImageAtlasBuilder* d_pendingImageAtlas;
+    //! atlas page textures and the number of images placed on each of them.
+    std::unordered_map<const Texture*, size_t> d_imageAtlasPages;
+    //! the atlas page each image was placed on, for the images still on one.
+    std::unordered_map<const Image*, const Texture*> d_atlasedImages;
 };
 
 //---------------------------------------------------------------------------//
@@ -42,6 +42,11 @@
 // the default implementation. The only difference is that this class will
 // attempt to load resources from a zip archive if the resource does not exist
 // outside the archive.
+//
+// The central directory of the archive is indexed once when the archive is
+// set, so locating a file is a hash look-up rather than a scan of the archive.
+// Loading files from the archive may be done concurrently from multiple
+// threads; each thread uses its own archive handle taken from a pool.
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -60,12 +65,19 @@ public:
     \brief
         sets the archive from which files are retrieved.
 
+        The archive's central directory is read and indexed immediately, and
+        the archive is memory mapped where the platform allows it so that
+        stored (uncompressed) entries can be copied out directly.
+
     \param archive
         The filepath to the archive
     */
     void setArchive(const String& archive);
     void setLoadLocal(bool load = true);
 
+    //! Return the number of files indexed in the currently set archive.
+    size_t getArchiveEntryCount() const;
+
     void loadRawDataContainer(const String& filename,
                               RawDataContainer& output,
                               const String& resourceGroup) override;
@@ -76,6 +88,7 @@ protected:
     bool doesFileExist(const String& filename);
     void openArchive();
     void closeArchive();
+    void buildArchiveIndex();
 
     struct Impl;
     Impl* d_pimpl;
@@ -0,0 +1,284 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Defines a lightweight frame profiler with Chrome trace export
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIProfiler_h_
+#define _CEGUIProfiler_h_
+
+#include "CEGUI/Singleton.h"
+#include "CEGUI/String.h"
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+//! Counters maintained by the Profiler.
+enum class ProfilerCounter : int
+{
+    //! GeometryBuffers created by the Renderer.
+    GeometryBuffersCreated,
+    //! Vertices submitted for drawing.
+    Vertices,
+    //! GeometryBuffers drawn.
+    DrawCalls,
+    //! Uploads of pixel data to textures.
+    TextureUploads,
+    //! Property values converted to or from their String representation.
+    PropertyStringConversions,
+    //! Number of counters; not a counter itself.
+    Count
+};
+
+/*!
+\brief
+    Collects timings of the scoped zones placed on CEGUI's hot paths, along
+    with a few counters, so that the cost of a frame can be broken down.
+
+    Zones are placed with the CEGUI_PROFILE_ZONE and CEGUI_PROFILE_WINDOW_ZONE
+    macros and counters updated with CEGUI_PROFILE_COUNT. The macros compile
+    to nothing unless CEGUI is built with CEGUI_HAS_PROFILER, and while the
+    profiler is disabled at runtime they cost a single test.
+
+    Zone timings are aggregated per zone name and, for window zones, per
+    window type. When trace capture is enabled, every zone is also recorded
+    as an event which can be exported in the Chrome trace JSON format, for
+    viewing in chrome://tracing or Perfetto.
+*/
+class CEGUIEXPORT Profiler : public Singleton<Profiler>
+{
+public:
+    //! Aggregated timings of one zone, for one window type.
+    struct ZoneStatistics
+    {
+        //! Name of the zone.
+        String name;
+        //! Window type the zone was entered for, empty for other zones.
+        String windowType;
+        //! Number of times the zone was entered.
+        std::uint64_t callCount;
+        //! Total time spent in the zone, in seconds.
+        double totalTime;
+        //! Longest time spent in the zone at once, in seconds.
+        double maxTime;
+    };
+
+    typedef std::chrono::steady_clock Clock;
+
+    Profiler();
+    ~Profiler();
+
+    static Profiler& getSingleton();
+    static Profiler* getSingletonPtr();
+
+    //! Set whether zones and counters are recorded. Disabled by default.
+    void setEnabled(bool setting);
+
+    //! Return whether zones and counters are recorded.
+    bool isEnabled() const { return d_enabled; }
+
+    /*!
+    \brief
+        Set whether every zone is recorded as a trace event in addition to
+        being aggregated. Disabled by default.
+    */
+    void setTraceCaptureEnabled(bool setting);
+
+    //! Return whether zones are recorded as trace events.
+    bool isTraceCaptureEnabled() const { return d_traceCaptureEnabled; }
+
+    /*!
+    \brief
+        Set the maximum number of trace events kept. Events recorded once the
+        limit has been reached are dropped and counted instead.
+    */
+    void setMaxTraceEvents(std::size_t count);
+
+    //! Return the maximum number of trace events kept.
+    std::size_t getMaxTraceEvents() const;
+
+    //! Return the number of trace events currently held.
+    std::size_t getTraceEventCount() const;
+
+    //! Return the number of trace events dropped because of the limit.
+    std::size_t getDroppedTraceEventCount() const;
+
+    //! Discard all trace events.
+    void clearTrace();
+
+    /*!
+    \brief
+        Write the trace events to \a out as Chrome trace JSON. The counters
+        are written as counter tracks with one sample per frame.
+    */
+    void writeChromeTrace(std::ostream& out) const;
+
+    /*!
+    \brief
+        Write the trace events to the file \a filename as Chrome trace JSON.
+
+    \exception FileIOException
+        thrown if the file could not be opened for writing.
+    */
+    void saveChromeTrace(const String& filename) const;
+
+    //! Return the aggregated timings of all zones entered so far.
+    std::vector<ZoneStatistics> getZoneStatistics() const;
+
+    //! Discard the aggregated zone timings.
+    void resetZoneStatistics();
+
+    //! Return the total accumulated for \a counter.
+    std::uint64_t getCounter(ProfilerCounter counter) const;
+
+    //! Reset all counters to zero.
+    void resetCounters();
+
+    /*!
+    \brief
+        Mark the end of a frame. Called by System after rendering all the
+        GUIContexts; records the counter samples of the frame when capturing
+        a trace.
+    */
+    void endFrame();
+
+    //! Return the number of frames ended since the profiler was enabled.
+    std::uint64_t getFrameCount() const;
+
+    //! Add \a amount to \a counter if a profiler exists and is enabled.
+    static void count(ProfilerCounter counter, std::uint64_t amount = 1);
+
+    /*!
+    \brief
+        Record a zone that was entered at \a start and left at \a end.
+        Normally called by ProfilerZone.
+
+    \param name
+        Name of the zone. Must remain valid for the lifetime of the profiler,
+        zones are expected to be named by string literals.
+
+    \param windowType
+        Pointer to the window type the zone is entered for, or nullptr.
+    */
+    void recordZone(const char* name, const String* windowType,
+                    Clock::time_point start, Clock::time_point end);
+
+private:
+    //! A zone recorded while capturing a trace.
+    struct TraceEvent
+    {
+        const char* name;
+        String windowType;
+        double start;
+        double duration;
+    };
+
+    //! Counter values sampled at the end of a frame.
+    struct CounterSample
+    {
+        double time;
+        std::uint64_t values[static_cast<int>(ProfilerCounter::Count)];
+    };
+
+    //! Return the microseconds elapsed from the profiler epoch to \a time.
+    double toTraceTime(Clock::time_point time) const;
+
+    typedef std::map<String, ZoneStatistics> WindowTypeStatisticsMap;
+    typedef std::unordered_map<const char*, WindowTypeStatisticsMap> ZoneStatisticsMap;
+
+    bool d_enabled;
+    bool d_traceCaptureEnabled;
+    std::size_t d_maxTraceEvents;
+    std::size_t d_droppedTraceEvents;
+    std::uint64_t d_frameCount;
+    //! time trace timestamps are relative to.
+    Clock::time_point d_epoch;
+    ZoneStatisticsMap d_zoneStatistics;
+    std::vector<TraceEvent> d_traceEvents;
+    std::vector<CounterSample> d_counterSamples;
+    std::uint64_t d_counters[static_cast<int>(ProfilerCounter::Count)];
+    //! counter values at the end of the previous frame.
+    std::uint64_t d_frameCounterBase[static_cast<int>(ProfilerCounter::Count)];
+    //! guards recording from windows whose geometry is built in parallel.
+    std::mutex d_recordMutex;
+};
+
+/*!
+\brief
+    Times the scope it lives in and records it with the Profiler, if one
+    exists and is enabled when the scope is entered.
+*/
+class CEGUIEXPORT ProfilerZone
+{
+public:
+    ProfilerZone(const char* name, const String* windowType = nullptr);
+    ~ProfilerZone();
+
+private:
+    ProfilerZone(const ProfilerZone&);
+    ProfilerZone& operator=(const ProfilerZone&);
+
+    Profiler* d_profiler;
+    const char* d_name;
+    const String* d_windowType;
+    Profiler::Clock::time_point d_start;
+};
+
+} // End of  CEGUI namespace section
+
+#define CEGUI_PROFILER_CONCAT_IMPL(a, b) a##b
+#define CEGUI_PROFILER_CONCAT(a, b) CEGUI_PROFILER_CONCAT_IMPL(a, b)
+
+#ifdef CEGUI_HAS_PROFILER
+//! Time the enclosing scope as the zone \a name.
+#   define CEGUI_PROFILE_ZONE(name) \
+        CEGUI::ProfilerZone CEGUI_PROFILER_CONCAT(ceguiProfilerZone, __LINE__)(name)
+//! Time the enclosing scope as the zone \a name of the Window \a window.
+#   define CEGUI_PROFILE_WINDOW_ZONE(name, window) \
+        CEGUI::ProfilerZone CEGUI_PROFILER_CONCAT(ceguiProfilerZone, __LINE__)(name, &(window).getType())
+//! Add \a amount to the ProfilerCounter \a counter.
+#   define CEGUI_PROFILE_COUNT(counter, amount) \
+        CEGUI::Profiler::count(CEGUI::ProfilerCounter::counter, amount)
+#else
+#   define CEGUI_PROFILE_ZONE(name)
+#   define CEGUI_PROFILE_WINDOW_ZONE(name, window)
+#   define CEGUI_PROFILE_COUNT(counter, amount)
+#endif
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIProfiler_h_
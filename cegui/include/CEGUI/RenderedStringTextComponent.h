@@ -30,6 +30,9 @@
 #include "CEGUI/RenderedStringComponent.h"
 #include "CEGUI/ColourRect.h"
 #include "CEGUI/String.h"
+#include "CEGUI/DefaultParagraphDirection.h"
+#include "CEGUI/RefCounted.h"
+#include "CEGUI/RenderMaterial.h"
 
 #include <vector>
 
@@ -79,9 +82,62 @@ public:
                       const float start, const float end) override;
 
 protected:
+    //! The vertices and settings of one GeometryBuffer of the laid out text.
+    struct GlyphGeometry
+    {
+        RefCounted<RenderMaterial> d_material;
+        std::vector<float> d_vertexData;
+        bool d_quadIndexed;
+        bool d_clippingActive;
+        float d_alpha;
+    };
+
+    /*!
+        The geometry of the text as last laid out by the font, and what it
+        was laid out with. Text laid out again with the same font, colours and
+        spacing at a whole pixel offset, with the clipping area at the same
+        offset, gives the same geometry moved by that offset.
+    */
+    struct GlyphGeometryCache
+    {
+        bool d_valid = false;
+        const Font* d_font = nullptr;
+        //! Font::getGlyphGeometryGeneration when the text was laid out.
+        unsigned int d_fontGeneration = 0;
+        glm::vec2 d_position;
+        bool d_clipped = false;
+        //! The clipping area relative to d_position.
+        Rectf d_clipRect;
+        ColourRect d_colours;
+        float d_spaceExtra = 0.0f;
+        DefaultParagraphDirection d_paragraphDir = DefaultParagraphDirection::LeftToRight;
+        std::vector<GlyphGeometry> d_buffers;
+    };
+
+    /*!
+    \brief
+        Creates the GeometryBuffers for the text from the glyph geometry cache
+        into \a buffers and returns true, or returns false if the cache does
+        not hold the text laid out with the given settings.
+    */
+    bool createCachedGlyphGeometry(std::vector<GeometryBuffer*>& buffers,
+        const Font* fnt, const glm::vec2& position, const Rectf* clip_rect,
+        const ColourRect& colours, float space_extra,
+        DefaultParagraphDirection paragraph_dir) const;
+
+    //! Stores the GeometryBuffers laid out for the text in the glyph geometry cache.
+    void cacheGlyphGeometry(const std::vector<GeometryBuffer*>& buffers,
+        const Font* fnt, const glm::vec2& position, const Rectf* clip_rect,
+        const ColourRect& colours, float space_extra,
+        DefaultParagraphDirection paragraph_dir) const;
+
+    //! Discards the cached glyph geometry.
+    void invalidateGlyphGeometryCache() const;
+
     const Font* getEffectiveFont(const Window* window) const;
     void handleFormattingOptions(const Window* ref_wnd, const float vertical_space, glm::vec2& final_pos) const;
-    void createSelectionRenderGeometry(const glm::vec2& position, const Rectf* clip_rect, const float vertical_space, const Font* fnt) const;
+    void createSelectionRenderGeometry(const glm::vec2& position, const Rectf* clip_rect, const float vertical_space, const Font* fnt,
+                                       DefaultParagraphDirection defaultParagraphDir) const;
     static size_t getNextTokenLength(const String& text, size_t start_idx);
 
     //! pointer to the image drawn by the component.
@@ -92,6 +148,8 @@ protected:
     ColourRect d_colours;
     //! last set selection
     size_t d_selectionStart, d_selectionLength;
+    //! The text geometry last laid out by the font.
+    mutable GlyphGeometryCache d_glyphGeometryCache;
 };
     
 } // End of  CEGUI namespace section
@@ -29,6 +29,7 @@
 
 #include "CEGUI/FormattedRenderedString.h"
 #include "CEGUI/JustifiedRenderedString.h"
+#include "CEGUI/Profiler.h"
 #include <vector>
 
 // Start of CEGUI namespace section
@@ -93,6 +94,8 @@ template <typename T>
 void RenderedStringWordWrapper<T>::format(const Window* ref_wnd,
                                           const Sizef& area_size)
 {
+    CEGUI_PROFILE_ZONE("RenderedStringWordWrapper::format");
+
     deleteFormatters();
 
     bool was_word_split = false;
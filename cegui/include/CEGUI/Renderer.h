@@ -36,6 +36,7 @@
 
 #include <glm/glm.hpp>
 
+#include <mutex>
 #include <set>
 
 #if defined(_MSC_VER)
@@ -78,6 +79,12 @@ enum class DefaultShaderType : int
     Solid,
     //! A shader for textured geometry, used in most CEGUI widgets
     Textured,
+    /*!
+        A shader for textured geometry whose texture alpha holds a signed
+        distance field, used for scalable glyphs. Only available if
+        Renderer::supportsShaderType returns true for it.
+    */
+    DistanceField,
     //! Count of types
     Count
 };
@@ -184,6 +191,13 @@ public:
     */
     void updateGeometryBufferTexCoords(const Texture* texture, const float scaleFactor);
 
+    /*!
+    \brief
+        Returns whether any of the geometry buffers created by this Renderer
+        currently renders with the supplied texture.
+    */
+    bool isTextureUsedByGeometry(const Texture* texture) const;
+
     /*!
     \brief
         Create a TextureTarget that can be used to cache imagery; this is a
@@ -201,6 +215,28 @@ public:
     */
     virtual TextureTarget* createTextureTarget(bool addStencilBuffer) = 0;
 
+    /*!
+    \brief
+        Create a TextureTarget that can be used to cache imagery of the given
+        size. Renderers that pool their TextureTargets use the size to hand
+        out a recycled target of a suitable size class.
+
+        The default implementation creates a new TextureTarget and declares
+        the render size to it.
+
+    \param addStencilBuffer
+        A boolean that defines whether a stencil buffer should be attached to the
+        TextureTarget or not.
+
+    \param size
+        The size of the content that will be rendered to the TextureTarget.
+
+    \return
+        Pointer to a TextureTarget object that is suitable for caching imagery,
+        or 0 if the renderer is unable to offer such a thing.
+    */
+    virtual TextureTarget* createTextureTarget(bool addStencilBuffer, const Sizef& size);
+
     /*!
     \brief
         Function that cleans up TextureTarget objects created with the
@@ -412,6 +448,26 @@ public:
     */
     virtual RefCounted<RenderMaterial> createRenderMaterial(const DefaultShaderType shaderType) const = 0;
 
+    /*!
+    \brief
+        Returns whether createRenderMaterial can create a RenderMaterial for
+        the specified default shader type. Solid and Textured are supported by
+        every Renderer.
+
+    \param shaderType
+        The type of CEGUI shader to check for.
+    */
+    virtual bool supportsShaderType(const DefaultShaderType shaderType) const;
+
+    /*!
+    \brief
+        Returns whether GeometryBuffers can be created, filled and destroyed
+        on threads other than the rendering thread, each buffer being used by
+        one thread at a time. GUIContext only builds window geometry in
+        parallel on Renderers that can. The default is false.
+    */
+    virtual bool isGeometryBufferCreationThreadSafe() const;
+
     /*!
     \brief
         Marks all matrices of all GeometryBuffers as dirty, so that they will be updated before their next usage.
@@ -538,6 +594,8 @@ private:
     typedef std::set<GeometryBuffer*> GeometryBufferSet;
     //! Container used to track geometry buffers.
     GeometryBufferSet d_geometryBuffers;
+    //! Guards d_geometryBuffers while window geometry is built in parallel.
+    std::mutex d_geometryBuffersMutex;
     //! The Font scale factor to be used when rendering Fonts (except Bitmap Fonts).
     float d_fontScale;
 };
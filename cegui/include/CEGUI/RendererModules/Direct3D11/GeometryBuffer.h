@@ -55,6 +55,7 @@ public:
     // Implement GeometryBuffer interface.
     virtual void draw() const;
     virtual void appendGeometry(const float* vertex_data, std::size_t array_size);
+    virtual void updateTextureCoordinates(const Texture* texture, const float scaleFactor);
 
     /*
     \brief
@@ -49,13 +49,17 @@ class NULL_GUIRENDERER_API NullGeometryBuffer : public GeometryBuffer
 {
 public:
     //! Constructor
-    NullGeometryBuffer(CEGUI::RefCounted<RenderMaterial> renderMaterial);
+    NullGeometryBuffer(NullRenderer& owner, CEGUI::RefCounted<RenderMaterial> renderMaterial);
     //! Destructor
     virtual ~NullGeometryBuffer();
 
     // Implementation/overrides of member functions inherited from GeometryBuffer
     void draw() const override;
     void appendGeometry(const std::vector<float>& vertex_data);
+
+protected:
+    //! Renderer that owns the GeometryBuffer and collects its draw statistics.
+    NullRenderer& d_owner;
 };
 
 
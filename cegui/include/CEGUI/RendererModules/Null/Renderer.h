@@ -29,6 +29,7 @@
 
 #include "../../Renderer.h"
 #include "../../Sizef.h"
+#include "../../TextureTargetPool.h"
 
 #include <vector>
 #include <unordered_map>
@@ -108,9 +109,12 @@ public:
     // implement CEGUI::Renderer interface
     RenderTarget& getDefaultRenderTarget() override;
     RefCounted<RenderMaterial> createRenderMaterial(const DefaultShaderType shaderType) const override;
+    bool supportsShaderType(const DefaultShaderType shaderType) const override;
+    bool isGeometryBufferCreationThreadSafe() const override;
     GeometryBuffer& createGeometryBufferTextured(RefCounted<RenderMaterial> renderMaterial) override;
     GeometryBuffer& createGeometryBufferColoured(RefCounted<RenderMaterial> renderMaterial) override;
     TextureTarget* createTextureTarget(bool addStencilBuffer) override;
+    TextureTarget* createTextureTarget(bool addStencilBuffer, const Sizef& size) override;
     void destroyTextureTarget(TextureTarget* target) override;
     void destroyAllTextureTargets() override;
     Texture& createTexture(const String& name) override;
@@ -131,6 +135,52 @@ public:
     const String& getIdentifierString() const override;
     bool isTexCoordSystemFlipped() const override;
 
+    /*!
+    \brief
+        Return the pool that recycles the TextureTargets of this renderer and
+        provides statistics about their texture memory.
+    */
+    TextureTargetPool& getTextureTargetPool();
+
+    /*!
+    \brief
+        Statistics on the geometry submitted for drawing during one frame,
+        counting the bytes a GPU based renderer would have to read.
+    */
+    struct FrameStatistics
+    {
+        //! Number of GeometryBuffer draws.
+        unsigned int d_drawCalls;
+        //! Number of vertices drawn.
+        std::size_t d_vertexCount;
+        //! Number of indices drawn, from the shared quad index buffer.
+        std::size_t d_indexCount;
+        //! Bytes of vertex data drawn.
+        std::size_t d_vertexBytes;
+        //! Bytes of index data drawn.
+        std::size_t d_indexBytes;
+    };
+
+    /*!
+    \brief
+        Return the statistics of the last frame rendered between
+        beginRendering and endRendering.
+    */
+    const FrameStatistics& getLastFrameStatistics() const;
+
+    /*!
+    \brief
+        Set whether GeometryBuffers created from now on store textured quads
+        as indexed quads. Enabled by default.
+    */
+    void setQuadIndexingEnabled(bool enabled);
+
+    //! Return whether new GeometryBuffers store textured quads as indexed quads.
+    bool isQuadIndexingEnabled() const;
+
+    //! Record a draw of \a buffer in the statistics of the current frame.
+    void recordGeometryDraw(const GeometryBuffer& buffer);
+
 protected:
     //! default constructor.
     NullRenderer();
@@ -156,6 +206,8 @@ protected:
     typedef std::vector<TextureTarget*> TextureTargetList;
     //! Container used to track texture targets.
     TextureTargetList d_textureTargets;
+    //! Pool recycling released texture targets.
+    TextureTargetPool d_textureTargetPool;
     //! container type used to hold GeometryBuffers we create.
     typedef std::vector<NullGeometryBuffer*> GeometryBufferList;
     //! Container used to track geometry buffers.
@@ -171,6 +223,14 @@ protected:
     NullShaderWrapper* d_shaderWrapperTextured;
     //! Shaderwrapper for coloured vertices
     NullShaderWrapper* d_shaderWrapperSolid;
+    //! Shaderwrapper for vertices textured with a signed distance field
+    NullShaderWrapper* d_shaderWrapperDistanceField;
+    //! Whether new GeometryBuffers store textured quads as indexed quads.
+    bool d_quadIndexingEnabled;
+    //! Statistics of the frame currently being rendered.
+    FrameStatistics d_frameStatistics;
+    //! Statistics of the last frame rendered.
+    FrameStatistics d_lastFrameStatistics;
 };
 
 
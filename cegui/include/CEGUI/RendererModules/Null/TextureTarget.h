@@ -63,6 +63,8 @@ protected:
     static const float DEFAULT_SIZE;
     //! This wraps d_texture so it can be used by the core CEGUI lib.
     NullTexture* d_CEGUITexture;
+    //! size of the texture: the declared render size rounded up to its size class.
+    Sizef d_textureSize;
 };
 
 } // End of  CEGUI namespace section
@@ -70,6 +70,7 @@ public:
 
     virtual void draw() const;
     virtual void appendGeometry(const float* vertex_data, std::size_t array_size);
+    virtual void updateTextureCoordinates(const Texture* texture, const float scaleFactor);
     virtual void reset();
     virtual int getVertexAttributeElementCount() const;
 
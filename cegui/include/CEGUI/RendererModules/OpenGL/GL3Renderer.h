@@ -166,6 +166,13 @@ public:
     */
     OpenGLBaseStateChangeWrapper* getOpenGLStateChanger();
 
+    /*!
+    \brief
+        Returns the OpenGL element array buffer holding the quad indices shared
+        by all quad indexed GeometryBuffers of this renderer.
+    */
+    GLuint getQuadIndexBuffer() const;
+
     // base class overrides / abstract function implementations
     void beginRendering() override;
     void endRendering() override;
@@ -173,6 +180,7 @@ public:
     void setupRenderingBlendMode(const BlendMode mode,
                                  const bool force = false) override;
     RefCounted<RenderMaterial> createRenderMaterial(const DefaultShaderType shaderType) const override;
+    bool supportsShaderType(const DefaultShaderType shaderType) const override;
 
 protected:
     //! Overrides
@@ -207,6 +215,8 @@ protected:
     void initialiseStandardTexturedShaderWrapper();
     //! Initialises the OpenGL ShaderWrapper for coloured objects
     void initialiseStandardColouredShaderWrapper();
+    //! Initialises the OpenGL ShaderWrapper for distance field textured objects
+    void initialiseStandardDistanceFieldShaderWrapper();
 
 
 protected:
@@ -223,10 +233,15 @@ private:
     //! restores all relevant OpenGL States CEGUI touches to their default value
     void restoreChangedStatesToDefaults(bool isAfterRendering);
 
+    //! uploads the shared quad indices into an element array buffer.
+    void initialiseQuadIndexBuffer();
+
     //! Wrapper of the OpenGL shader we will use for textured geometry
     OpenGLBaseShaderWrapper* d_shaderWrapperTextured;
     //! Wrapper of the OpenGL shader we will use for solid geometry
     OpenGLBaseShaderWrapper* d_shaderWrapperSolid;
+    //! Wrapper of the OpenGL shader we will use for distance field textured geometry
+    OpenGLBaseShaderWrapper* d_shaderWrapperDistanceField;
 
     //! The wrapper we use for OpenGL calls, to detect redundant state changes and prevent them
     OpenGLBaseStateChangeWrapper* d_openGLStateChanger;
@@ -234,6 +249,8 @@ private:
     OpenGLBaseShaderManager* d_shaderManager;
     //! pointer to a helper that creates TextureTargets supported by the system.
     OGLTextureTargetFactory* d_textureTargetFactory;
+    //! Element array buffer holding the shared quad indices.
+    GLuint d_quadIndexBuffer;
 };
 
 }
@@ -49,6 +49,7 @@ public:
     // Overrides of virtual and abstract methods from GeometryBuffer
     void draw() const override;
     void appendGeometry(const float* vertex_data, std::size_t array_size) override;
+    void updateTextureCoordinates(const Texture* texture, const float scaleFactor) override;
     void reset() override;
 
     // Implementation/overrides of member functions inherited from OpenGLGeometryBufferBase
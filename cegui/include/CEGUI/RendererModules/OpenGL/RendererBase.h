@@ -33,6 +33,7 @@
 #include "../../Sizef.h"
 #include "../../Rectf.h"
 #include "../../TextureTarget.h"
+#include "../../TextureTargetPool.h"
 #include "../../RefCounted.h"
 #include "CEGUI/RendererModules/OpenGL/GL.h"
 
@@ -69,6 +70,7 @@ public:
     GeometryBuffer& createGeometryBufferTextured(CEGUI::RefCounted<RenderMaterial> renderMaterial) override;
     GeometryBuffer& createGeometryBufferColoured(CEGUI::RefCounted<RenderMaterial> renderMaterial) override;
     TextureTarget* createTextureTarget(bool addStencilBuffer) override;
+    TextureTarget* createTextureTarget(bool addStencilBuffer, const Sizef& size) override;
     void destroyTextureTarget(TextureTarget* target) override;
     void destroyAllTextureTargets() override;
     Texture& createTexture(const String& name) override;
@@ -161,6 +163,22 @@ public:
     */
     virtual Sizef getAdjustedTextureSize(const Sizef& sz) = 0;
 
+    /*!
+    \brief
+        Return the size of texture a TextureTarget should use to render
+        content of size \a sz. This is the pool size class of \a sz adjusted
+        according to the OpenGL capabilities, so that targets of similar size
+        can be recycled without reallocating their texture.
+    */
+    Sizef getTextureTargetSize(const Sizef& sz);
+
+    /*!
+    \brief
+        Return the pool that recycles the TextureTargets of this renderer and
+        provides statistics about their texture memory.
+    */
+    TextureTargetPool& getTextureTargetPool();
+
     /*!
     \brief
         Utility function that will return \a f if it's a power of two, or the
@@ -242,6 +260,8 @@ protected:
     typedef std::vector<TextureTarget*> TextureTargetList;
     //! Container used to track texture targets.
     TextureTargetList d_textureTargets;
+    //! Pool recycling released texture targets.
+    TextureTargetPool d_textureTargetPool;
     //! container type used to hold Textures we create.
     typedef std::unordered_map<String, OpenGLTexture*> TextureMap;
     //! Container used to track textures.
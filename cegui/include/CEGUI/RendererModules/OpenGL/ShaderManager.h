@@ -49,6 +49,8 @@ namespace CEGUI
     {
         StandardTextured,
         StandardSolid,
+        //! Only loaded for desktop OpenGL 3.2 and OpenGL ES 3.0
+        StandardDistanceField,
 
         Count
     };
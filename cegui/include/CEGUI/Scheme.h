@@ -194,6 +194,13 @@ public:
     */
     void loadFalagardMappings();
 
+    /*!
+    \brief
+        Pack the images queued during loading into shared atlas textures, if
+        image atlasing is enabled in the ImageManager.
+    */
+    void buildImageAtlas();
+
     /*!
     \brief
         Unload all XML based imagesets created by the scheme.
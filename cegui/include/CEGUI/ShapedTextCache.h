@@ -0,0 +1,179 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Defines a bounded cache of shaped text runs
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIShapedTextCache_h_
+#define _CEGUIShapedTextCache_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/DefaultParagraphDirection.h"
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Cache of shaped text runs, used by Font implementations that do complex
+    text layout so that the same text does not have to be shaped again for
+    every measurement and every geometry rebuild.
+
+    A run is the list of glyphs produced by shaping a text with a given
+    paragraph direction. Each cache belongs to one font face at one size,
+    and the owning Font clears it whenever either changes. The memory used
+    is bounded by a maximum number of cached glyphs; once it is reached, the
+    least recently used runs are dropped.
+*/
+class CEGUIEXPORT ShapedTextCache
+{
+public:
+    //! A glyph of a shaped run, with its metrics in pixels.
+    struct Glyph
+    {
+        //! Index of the glyph within the font face.
+        unsigned int d_index;
+        //! Index of the first code point of the text that the glyph is for.
+        unsigned int d_cluster;
+        //! Horizontal advance to the next glyph.
+        float d_advance;
+        //! Horizontal offset of the glyph from the pen position.
+        float d_offsetX;
+        //! Vertical offset of the glyph from the pen position.
+        float d_offsetY;
+    };
+
+    //! The glyphs of a shaped text, in visual order.
+    typedef std::vector<Glyph> Run;
+
+    //! Default maximum number of cached glyphs.
+    static const size_t DefaultMaxGlyphCount;
+
+    explicit ShapedTextCache(size_t max_glyph_count = DefaultMaxGlyphCount);
+
+    /*!
+    \brief
+        Return the cached run for \a text shaped with the paragraph direction
+        \a dir, or nullptr if it is not cached. Counts as a hit or a miss.
+
+        The run remains valid until the next call to insert or clear.
+    */
+    const Run* find(const std::u32string& text, DefaultParagraphDirection dir);
+
+    /*!
+    \brief
+        Add the run shaped for \a text with paragraph direction \a dir,
+        dropping the least recently used runs as needed to stay within the
+        maximum glyph count.
+
+    \return
+        The stored run, valid until the next call to insert or clear. Runs
+        larger than the maximum glyph count are returned but not cached.
+    */
+    const Run& insert(const std::u32string& text, DefaultParagraphDirection dir,
+                      Run run);
+
+    //! Drop all cached runs. The hit and miss counts are kept.
+    void clear();
+
+    //! Set the maximum number of glyphs cached, dropping runs if needed.
+    void setMaxGlyphCount(size_t count);
+
+    //! Return the maximum number of glyphs cached.
+    size_t getMaxGlyphCount() const { return d_maxGlyphCount; }
+
+    //! Return the number of glyphs currently cached.
+    size_t getGlyphCount() const { return d_glyphCount; }
+
+    //! Return the number of runs currently cached.
+    size_t getRunCount() const { return d_runs.size(); }
+
+    //! Return the number of lookups that found a cached run.
+    size_t getHitCount() const { return d_hitCount; }
+
+    //! Return the number of lookups that did not find a cached run.
+    size_t getMissCount() const { return d_missCount; }
+
+    //! Reset the hit and miss counts to zero.
+    void resetStatistics();
+
+private:
+    struct Key
+    {
+        std::u32string d_text;
+        DefaultParagraphDirection d_direction;
+
+        bool operator==(const Key& rhs) const
+        {
+            return d_direction == rhs.d_direction && d_text == rhs.d_text;
+        }
+    };
+
+    struct KeyHasher
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+    //! Least recently used first.
+    typedef std::list<const Key*> UsageList;
+
+    struct Entry
+    {
+        Run d_run;
+        UsageList::iterator d_usage;
+    };
+
+    typedef std::unordered_map<Key, Entry, KeyHasher> RunMap;
+
+    //! Drop least recently used runs until \a count more glyphs fit.
+    void makeRoom(size_t count);
+
+    size_t d_maxGlyphCount;
+    size_t d_glyphCount;
+    size_t d_hitCount;
+    size_t d_missCount;
+    RunMap d_runs;
+    UsageList d_usage;
+    //! Holds the last run that was too large to be cached.
+    Run d_uncachedRun;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIShapedTextCache_h_
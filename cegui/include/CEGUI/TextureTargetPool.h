@@ -0,0 +1,169 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Defines a pool recycling TextureTargets by size class
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITextureTargetPool_h_
+#define _CEGUITextureTargetPool_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/Sizef.h"
+
+#include <cstddef>
+#include <vector>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Helper for Renderer implementations that keeps released TextureTargets
+    around so they can be handed out again instead of being re-created.
+
+    Windows using an AutoRenderingSurface release their TextureTarget when
+    the surface is disabled or the stencil setting changes, and request a new
+    one later. The pool keeps such targets, up to a configurable amount of
+    texture memory, and hands them to the next request of a matching size
+    class. Renderers also use the size class when a target is resized, so
+    small changes to a window's size do not re-create the render texture.
+
+    The pool does not create or delete targets itself; that remains the job
+    of the Renderer owning it.
+*/
+class CEGUIEXPORT TextureTargetPool
+{
+public:
+    //! Statistics about the TextureTargets of a Renderer and its pool.
+    struct Statistics
+    {
+        //! Number of TextureTargets that currently exist.
+        std::size_t d_targetCount;
+        //! Number of TextureTargets kept in the pool for reuse.
+        std::size_t d_pooledTargetCount;
+        //! Bytes of texture memory held by the pooled TextureTargets.
+        std::size_t d_pooledBytes;
+        //! Bytes of texture memory held by all TextureTargets, in use or pooled.
+        std::size_t d_bytesHeld;
+        /*!
+            Bytes the areas requested for the TextureTargets in use would need.
+            The rest of d_bytesHeld is lost to size class rounding and pooling.
+        */
+        std::size_t d_bytesRequested;
+        //! Number of requests that were served by a pooled TextureTarget.
+        std::size_t d_reuseCount;
+    };
+
+    TextureTargetPool();
+
+    /*!
+    \brief
+        Registers a newly created TextureTarget as being in use.
+    */
+    void notifyTargetCreated(TextureTarget& target);
+
+    /*!
+    \brief
+        Forgets a TextureTarget that is about to be deleted.
+    */
+    void notifyTargetDestroyed(TextureTarget& target);
+
+    /*!
+    \brief
+        Takes a pooled TextureTarget that is suitable for rendering content of
+        the given size.
+
+    \param addStencilBuffer
+        Whether the TextureTarget must have a stencil buffer attached.
+
+    \param size
+        The size of the content that will be rendered. A zero size accepts
+        a pooled target of any size.
+
+    \return
+        A cleared TextureTarget from the pool, or 0 if none is suitable and a
+        new one has to be created.
+    */
+    TextureTarget* acquire(bool addStencilBuffer, const Sizef& size);
+
+    /*!
+    \brief
+        Offers a TextureTarget that is no longer used to the pool.
+
+    \return
+        - true if the pool keeps the target, which must then not be deleted.
+        - false if the target should be deleted, because the pool is full.
+    */
+    bool release(TextureTarget& target);
+
+    /*!
+    \brief
+        Return the size class of a size: each dimension rounded up to a
+        multiple of the size granularity.
+    */
+    Sizef getSizeClass(const Sizef& size) const;
+
+    //! Set the granularity, in pixels, of the size classes.
+    void setSizeGranularity(float granularity);
+
+    //! Return the granularity, in pixels, of the size classes.
+    float getSizeGranularity() const;
+
+    //! Set the maximum bytes of texture memory kept by pooled TextureTargets.
+    void setMaxPooledBytes(std::size_t bytes);
+
+    //! Return the maximum bytes of texture memory kept by pooled TextureTargets.
+    std::size_t getMaxPooledBytes() const;
+
+    //! Return statistics about the TextureTargets and the pool.
+    Statistics getStatistics() const;
+
+    //! Return the bytes of texture memory used by the texture of a TextureTarget.
+    static std::size_t getByteSize(const TextureTarget& target);
+
+private:
+    //! TextureTargets that are in use.
+    std::vector<TextureTarget*> d_usedTargets;
+    //! TextureTargets that are kept for reuse.
+    std::vector<TextureTarget*> d_pooledTargets;
+    //! Granularity, in pixels, of the size classes.
+    float d_sizeGranularity;
+    //! Maximum bytes of texture memory kept by pooled TextureTargets.
+    std::size_t d_maxPooledBytes;
+    //! Number of requests that were served by a pooled TextureTarget.
+    std::size_t d_reuseCount;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUITextureTargetPool_h_
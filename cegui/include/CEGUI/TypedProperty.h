@@ -34,6 +34,7 @@
 #include "CEGUI/Property.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/Exceptions.h"
+#include "CEGUI/Profiler.h"
 // Start of CEGUI namespace section
 namespace CEGUI
 {
@@ -64,12 +65,14 @@ public:
     //! \copydoc Property::get
     String get(const PropertyReceiver* receiver) const override
     {
+        CEGUI_PROFILE_COUNT(PropertyStringConversions, 1);
         return Helper::toString(getNative(receiver));
     }
 
     //! \copydoc Property::set
     void set(PropertyReceiver* receiver, const String& value) override
     {
+        CEGUI_PROFILE_COUNT(PropertyStringConversions, 1);
         setNative(receiver, Helper::fromString(value));
     }
 
@@ -1943,6 +1943,19 @@ public:
     */
     void invalidate(const bool recursive = false);
 
+    /*!
+    \brief
+        Invalidate only the overlay geometry of this window, causing it to be
+        recreated by the WindowRenderer during the next rendering pass while
+        the rest of the cached geometry is kept.
+
+        The overlay is small, frequently changing imagery drawn on top of the
+        window content, such as the caret and selection of an edit box.
+
+    \see WindowRenderer::createOverlayRenderGeometry
+    */
+    void invalidateOverlay();
+
     /*!
     \brief
         Set the cursor image to be used when the cursor enters this window.
@@ -2295,6 +2308,34 @@ public:
     */
     void draw();
 
+    /*!
+    \brief
+        Return whether the calling thread is building window geometry in
+        parallel with other threads; see
+        GUIContext::setGeometryBuildThreadCount.
+
+        Code reached from WindowRenderer::createRenderGeometry must not modify
+        state shared between windows on such a thread, for example by
+        rasterising a glyph or creating a texture. It calls
+        deferGeometryBuildToMainThread instead.
+    */
+    static bool isGeometryBuildWorker();
+
+    /*!
+    \brief
+        Have the geometry of the window being built on the calling worker
+        thread discarded and built again on the main thread, once all workers
+        are done. Geometry built after this call may be incomplete.
+    */
+    static void deferGeometryBuildToMainThread();
+
+    /*!
+    \brief
+        Return whether the geometry being built on the calling thread was
+        deferred to the main thread, in which case it must not be cached.
+    */
+    static bool isGeometryBuildDeferred();
+
     /*!
     \brief
         Cause window to update itself and any attached children.  Client code
@@ -2829,6 +2870,7 @@ public:
     UDim getWidthOfAreaReservedForContentLowerBoundAsFuncOfElementWidth() const override;
     UDim getHeightOfAreaReservedForContentLowerBoundAsFuncOfElementHeight() const override;
     void adjustSizeToContent() override;
+    USize getSizeAdjustedToContent() const override;
     bool contentFitsForSpecifiedElementSize(const Sizef& element_size) const override;
     bool contentFits() const override;
 
@@ -3339,6 +3381,13 @@ protected:
     */
     virtual void drawSelf(const RenderingContext& ctx);
 
+    /*!
+    \brief
+        Draw the attached child windows, in z-order. Subclasses may override
+        this to skip children that can not be visible.
+    */
+    virtual void drawChildren();
+
     /*!
     \brief
         Perform drawing operations concerned with generating and buffering
@@ -3351,6 +3400,27 @@ protected:
     */
     void bufferGeometry(const RenderingContext& ctx);
 
+    /*!
+    \brief
+        First step of rebuilding the geometry: destroys the old geometry and
+        fires EventRenderingStarted.
+    */
+    void beginGeometryBuild();
+
+    /*!
+    \brief
+        Second step of rebuilding the geometry: has the WindowRenderer, or
+        populateGeometryBuffer, create the geometry and the overlay geometry.
+    */
+    void populateGeometry();
+
+    /*!
+    \brief
+        Last step of rebuilding the geometry: positions, clips and fades the
+        geometry, fires EventRenderingEnded and clears the redraw flag.
+    */
+    void endGeometryBuild();
+
     /*!
     \brief
         Perform drawing operations concerned with positioning, clipping and
@@ -3369,6 +3439,20 @@ protected:
     */
     void destroyGeometryBuffers();
 
+    //! Destroys the overlay geometry buffers of this Window.
+    void destroyOverlayGeometryBuffers();
+
+    /*!
+    \brief
+        Recreate the overlay geometry via the WindowRenderer.
+
+    \return
+        - true if the overlay geometry was recreated.
+        - false if the WindowRenderer requires the whole geometry of the
+          window to be recreated instead.
+    */
+    bool bufferOverlayGeometry();
+
     /*!
     \brief
         Update the rendering cache.
@@ -3672,10 +3756,14 @@ protected:
     WindowRenderer* d_windowRenderer;
     //! List of geometry buffers that cache the geometry drawn by this Window.
     std::vector<GeometryBuffer*> d_geometryBuffers;
+    //! List of geometry buffers drawn on top of d_geometryBuffers, recreated independently.
+    std::vector<GeometryBuffer*> d_overlayGeometryBuffers;
     //! RenderingSurface owned by this window (may be 0)
     RenderingSurface* d_surface;
     //! true if window geometry cache needs to be regenerated.
     mutable bool d_needsRedraw;
+    //! true if only the overlay geometry cache needs to be regenerated.
+    bool d_needsOverlayRedraw;
     //! holds setting for automatic creation of of surface (RenderingWindow)
     bool d_autoRenderingWindow;
     //! holds setting for stencil buffer usage in texture caching
@@ -3824,6 +3912,9 @@ private:
 
     void updatePivot();
 
+    //! Mark the calling thread as a geometry build worker, or not.
+    static void setGeometryBuildWorker(bool worker);
+
     //! connection for event listener for font render size changes.
     Event::ScopedConnection d_fontRenderSizeChangeConnection;
 };
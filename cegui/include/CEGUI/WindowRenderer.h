@@ -32,6 +32,7 @@
 #include "CEGUI/Window.h"
 #include "CEGUI/Property.h"
 #include <vector>
+#include <list>
 #include <utility>
 
 #if defined(_MSC_VER)
@@ -43,6 +44,8 @@
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+class StateImagery;
+
 /*!
 \brief
     Base-class for the assignable WindowRenderer object
@@ -85,6 +88,41 @@ public:
     */
     virtual void createRenderGeometry() = 0;
 
+    /*!
+    \brief
+        Creates the overlay render geometry: small, frequently changing imagery
+        drawn on top of the geometry from createRenderGeometry, such as a caret.
+
+        It is called after every createRenderGeometry, and on its own after
+        Window::invalidateOverlay, so that changes to the overlay do not
+        require the rest of the widget geometry to be recreated.
+
+        WindowRenderers without an overlay keep the default implementation,
+        which returns false so that invalidating the overlay recreates the
+        whole window geometry.
+
+    \return
+        - true if the overlay geometry was created.
+        - false if the overlay can not be recreated on its own in the current
+          state, in which case the whole window geometry is recreated.
+    */
+    virtual bool createOverlayRenderGeometry() { return false; }
+
+    /*!
+    \brief
+        Returns whether createRenderGeometry and createOverlayRenderGeometry
+        may run on a worker thread while other windows build their geometry,
+        which GUIContext::setGeometryBuildThreadCount enables.
+
+        A WindowRenderer can return true if building its geometry only reads
+        the window, its ancestors and the look, and only modifies the window's
+        own geometry. Shared caches it reaches, such as fonts, images and the
+        state geometry cache, check Window::isGeometryBuildWorker themselves.
+        The default implementation returns false, so the geometry is always
+        built on the main thread.
+    */
+    virtual bool isGeometryBuildThreadSafe() const { return false; }
+
     /*!
     \brief
         Returns the factory type name of this window renderer.
@@ -210,6 +248,18 @@ public:
     */
     virtual void adjustSizeToContent();
 
+    /*!
+    \brief
+        Return the size "adjustSizeToContent" would give the window, without
+        changing the window.
+
+        See the documentaion for "Window::getSizeAdjustedToContent" for more
+        details.
+
+    \see Window::getSizeAdjustedToContent
+    */
+    virtual USize getSizeAdjustedToContent() const;
+
     /*!
     \brief
         Return whether setting the window size to "window_size" would make the
@@ -235,6 +285,63 @@ public:
     */
     virtual bool contentFits() const;
 
+    /*!
+    \brief
+        Set whether the geometry created for each state imagery is kept and
+        reused when the window returns to that state, instead of being
+        recreated on every state change.
+
+        Only window renderers that render their state imagery through
+        renderStateImagery make use of the cache. Cached geometry is reused
+        while the window size, text, font, rendered string parser and display
+        size are unchanged, no image has been destroyed or redefined and no
+        glyph geometry has changed; it is discarded when a Falagard property
+        that causes a redraw is written, when the look'n'feel or font render
+        size changes, and when clearStateGeometryCache is called.
+    */
+    void setStateGeometryCacheEnabled(bool setting);
+
+    //! Return whether geometry is cached per state imagery.
+    bool isStateGeometryCacheEnabled() const { return d_stateGeometryCacheEnabled; }
+
+    /*!
+    \brief
+        Set the maximum number of vertices held by the state geometry cache.
+        The least recently used states are discarded to stay within the limit.
+    */
+    void setStateGeometryCacheVertexLimit(std::size_t limit);
+
+    //! Return the maximum number of vertices held by the state geometry cache.
+    std::size_t getStateGeometryCacheVertexLimit() const { return d_stateGeometryCacheVertexLimit; }
+
+    //! Return the number of vertices currently held by the state geometry cache.
+    std::size_t getStateGeometryCacheVertexCount() const { return d_stateGeometryCacheVertexCount; }
+
+    /*!
+    \brief
+        Discard all cached state geometry and invalidate the window. This
+        must be called after changing anything the state imagery depends on
+        that the cache does not track, such as the area or texture of an
+        existing image.
+    */
+    void clearStateGeometryCache();
+
+    //! Return the number of geometry rebuilds avoided by the state geometry cache.
+    std::size_t getStateGeometryCacheHitCount() const { return d_stateGeometryCacheHits; }
+
+    //! Return the number of times state geometry had to be created.
+    std::size_t getStateGeometryCacheMissCount() const { return d_stateGeometryCacheMisses; }
+
+    //! Reset the hit and miss counts of the state geometry cache.
+    void resetStateGeometryCacheStatistics();
+
+    /*!
+    \brief
+        Return whether \a buffer is owned by the state geometry cache, in
+        which case the window must not destroy it.
+    */
+    bool isStateGeometryCacheBuffer(const GeometryBuffer& buffer) const;
+
 protected:
     /*************************************************************************
         Implementation methods
@@ -290,6 +397,13 @@ protected:
     */
     virtual void onLookNFeelUnassigned() {}
 
+    /*!
+    \brief
+        Render the given state imagery for the window, reusing the geometry
+        from the state geometry cache when it is enabled and holds it.
+    */
+    void renderStateImagery(const StateImagery& imagery);
+
     /*************************************************************************
         Implementation data
     **************************************************************************/
@@ -303,11 +417,51 @@ protected:
     typedef std::vector<PropertyEntry> PropertyList;
     PropertyList d_properties;  //!< The list of properties that this windowrenderer will be handling.
 
+    //! Geometry created for a state imagery, with what it was created for.
+    struct StateGeometry
+    {
+        String d_imageryName;
+        Sizef d_windowSize;
+        Sizef d_displaySize;
+        String d_text;
+        const Font* d_font;
+        const RenderedStringParser* d_stringParser;
+        unsigned int d_imageGeneration;
+        unsigned int d_glyphGeometryGeneration;
+        std::vector<GeometryBuffer*> d_buffers;
+        std::size_t d_vertexCount;
+    };
+
+    //! type used for the state geometry cache, most recently used first.
+    typedef std::list<StateGeometry> StateGeometryList;
+
+    //! whether geometry is cached per state imagery.
+    bool d_stateGeometryCacheEnabled;
+    //! maximum number of vertices held by the state geometry cache.
+    std::size_t d_stateGeometryCacheVertexLimit;
+    //! number of vertices currently held by the state geometry cache.
+    std::size_t d_stateGeometryCacheVertexCount;
+    //! number of times cached state geometry was reused.
+    std::size_t d_stateGeometryCacheHits;
+    //! number of times state geometry had to be created.
+    std::size_t d_stateGeometryCacheMisses;
+    //! geometry cached per state imagery.
+    StateGeometryList d_stateGeometryCache;
+
     // Window is friend so it can manipulate our 'd_window' member directly.
     // We don't want users fiddling with this so no public interface.
     friend class Window;
 
 private:
+    //! Remove the cached geometry from the window and destroy it.
+    void releaseStateGeometryCache();
+
+    //! Discard least recently used cache entries until \a vertex_count more fit.
+    bool makeRoomInStateGeometryCache(std::size_t vertex_count);
+
+    //! Return whether the window is currently drawing the given cache entry.
+    bool isStateGeometryInUse(const StateGeometry& entry) const;
+
     WindowRenderer& operator=(const WindowRenderer&) { return *this; }
 };
 
@@ -54,6 +54,7 @@ namespace CEGUI
         FalagardDefault(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryBuildThreadSafe() const override { return true; }
     };
 
 } // End of  CEGUI namespace section
@@ -152,6 +152,7 @@ public:
     HorizontalTextFormatting getTextFormatting() const;
 
     void createRenderGeometry() override;
+    bool createOverlayRenderGeometry() override;
 
     // overridden from EditboxWindowRenderer base class.
     size_t getTextIndexFromPosition(const glm::vec2& pt) const override;
@@ -186,6 +187,22 @@ protected:
     */
     float textOffsetVisual(const Rectf& text_area, const float text_extent) const;
 
+    /*!
+    \brief
+        Return the logical text offset that keeps the caret in view, setting
+        \a extent_to_caret_visual to the visual extent of the text before it.
+    */
+    float calculateCaretTextOffset(const ImagerySection& caret_imagery,
+                                   const String& visual_text,
+                                   const Rectf& text_area,
+                                   const float text_extent,
+                                   float& extent_to_caret_visual);
+
+    //! helper to draw the text, with the selection imagery under it.
+    void renderText(const WidgetLookFeel& wlf,
+                    const String& text,
+                    const Rectf& text_area,
+                    float text_offset);
     void createRenderGeometryForTextWithoutBidi(const WidgetLookFeel& wlf,
                           const String& text,
                           const Rectf& text_area,
@@ -207,6 +224,8 @@ protected:
 
     //! x rendering offset used last time we drew the widget.
     float d_lastTextOffset;
+    //! true if the text is rendered with the overlay, because it has a selection.
+    bool d_textInOverlay;
     //! true if the caret imagery should blink.
     bool d_blinkCaret;
     //! time-out in seconds used for blinking the caret.
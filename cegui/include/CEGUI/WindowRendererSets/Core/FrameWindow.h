@@ -70,6 +70,7 @@ namespace CEGUI
         FalagardFrameWindow(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryBuildThreadSafe() const override { return true; }
         Rectf getUnclippedInnerRect(void) const override;
     };
 
@@ -66,6 +66,7 @@ namespace CEGUI
         FalagardListHeaderSegment(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryBuildThreadSafe() const override { return true; }
     };
 
 } // End of  CEGUI namespace section
@@ -95,6 +95,7 @@ public:
 
     Rectf getTextRenderArea(void) const override;
     void createRenderGeometry() override;
+    bool createOverlayRenderGeometry() override;
     void update(float elapsed) override;
 
     //! return whether the blinking caret is enabled.
@@ -137,6 +138,9 @@ protected:
     */
     void cacheTextLines(const Rectf& dest_area);
 
+    //! return whether the text is coloured by a selection, and so is rendered with the overlay.
+    bool isTextSelectionRendered() const;
+
     /*!
     \brief
         Set the given ColourRect to the colour to be used for rendering Editbox
@@ -188,6 +192,8 @@ protected:
     float d_caretBlinkElapsed;
     //! true if caret should be shown.
     bool d_showCaret;
+    //! true if the text is rendered with the overlay, because it has a selection.
+    bool d_textInOverlay;
 };
 
 } // End of  CEGUI namespace section
@@ -80,6 +80,7 @@ namespace CEGUI
         void setReversed(bool setting);
 
         void createRenderGeometry() override;
+        bool isGeometryBuildThreadSafe() const override { return true; }
 
     protected:
         // settings to make this class universal.
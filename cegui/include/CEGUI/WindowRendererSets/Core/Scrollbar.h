@@ -76,6 +76,7 @@ namespace CEGUI
         void setVertical(bool setting);
 
         void createRenderGeometry() override;
+        bool isGeometryBuildThreadSafe() const override { return true; }
         void performChildWindowLayout() override;
 
     protected:
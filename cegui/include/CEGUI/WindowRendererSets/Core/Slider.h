@@ -78,6 +78,7 @@ namespace CEGUI
         void setReversedDirection(bool setting);
 
         void createRenderGeometry() override;
+        bool isGeometryBuildThreadSafe() const override { return true; }
         void performChildWindowLayout() override;
 
     protected:
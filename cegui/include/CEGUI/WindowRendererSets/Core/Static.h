@@ -101,6 +101,7 @@ namespace CEGUI
         void    setBackgroundEnabled(bool setting);
 
         void createRenderGeometry() override;
+        bool isGeometryBuildThreadSafe() const override { return true; }
 
         /*!
         \brief
@@ -81,6 +81,7 @@ namespace CEGUI
         const Image* getImage(void) const   {return d_image;}
 
         void createRenderGeometry() override;
+        bool isGeometryBuildThreadSafe() const override { return true; }
 
     protected:
         // implementation data
@@ -32,6 +32,7 @@
 #include "CEGUI/falagard/Enums.h"
 #include "CEGUI/ColourRect.h"
 #include <vector>
+#include <unordered_map>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -321,6 +322,8 @@ namespace CEGUI
         // overridden from base class
         bool handleFontRenderSizeChange(const Font* const font) override;
         void createRenderGeometry(void) override;
+        // formatting the text updates state of this renderer and the scrollbars.
+        bool isGeometryBuildThreadSafe() const override { return false; }
 
         /*!
         \brief
@@ -459,6 +462,17 @@ namespace CEGUI
         */
         void adjustSizeToContent() override;
 
+        /*!
+        \brief
+            Return the size "adjustSizeToContent" would give the widget,
+            without resizing it.
+
+            When word-wrapping is involved, the size is found by bisection
+            over text measurements (see "contentFitsForSpecifiedWindowSize"),
+            so no intermediate sizes are applied to the widget.
+        */
+        USize getSizeAdjustedToContent() const override;
+
         /*!
         \brief
             Return whether the size is automatically adjusted to the content
@@ -480,6 +494,10 @@ namespace CEGUI
             the whole widget content (the text) visible, without the need for
             scrollbars, and without the need to split a word between 2 or more
             lines.
+
+            This formats the text for the text area the widget would have at
+            that size, without resizing the widget. The results are cached per
+            text area width until the text, font or formatting changes.
         */
         bool contentFitsForSpecifiedWindowSize(const Sizef& window_size) const override;
 
@@ -504,6 +522,30 @@ namespace CEGUI
         void invalidateFormatting();
 
     protected:
+        //! Extents of the text when formatted for a given text area width.
+        struct TextMeasurement
+        {
+            //! Horizontal and vertical extent of the formatted text.
+            Sizef d_extent;
+            //! Whether a word had to be split between 2 or more lines.
+            bool d_wordSplit;
+        };
+
+        /*!
+        \brief
+            Return the extents of the text formatted with the horizontal
+            formatting for a text area \a area_width pixels wide, without
+            touching the formatting used for rendering.
+        */
+        const TextMeasurement& measureText(float area_width) const;
+
+        //! Discard the results cached by "measureText".
+        void invalidateTextMeasurements() const;
+
+        //! Create a formatter for the window's text using \a formatting.
+        FormattedRenderedString* createFormattedRenderedString(
+            HorizontalTextFormatting formatting) const;
+
         /*!
         \brief
             Update string formatting, scrollbars visibility and actual vertical
@@ -618,17 +660,26 @@ namespace CEGUI
         */
         mutable bool d_formatValid;
 
+        //! Formatter used by "measureText", separate from d_formattedRenderedString.
+        mutable FormattedRenderedString* d_measuredRenderedString;
+
+        //! Results of "measureText", keyed by text area width.
+        mutable std::unordered_map<float, TextMeasurement> d_textMeasurements;
+
     private:
         Scrollbar* getVertScrollbarWithoutUpdate() const;
         Scrollbar* getHorzScrollbarWithoutUpdate() const;
         Rectf getTextRenderAreaWithoutUpdate() const;
         const ComponentArea& getTextComponentAreaWithoutUpdate() const;
+        const ComponentArea& getTextComponentArea(bool horz_scrollbar_visible,
+                                                  bool vert_scrollbar_visible) const;
         Sizef getDocumentSizeWithoutUpdate() const;
-        void adjustSizeToContent_wordWrap_keepingAspectRatio(const LeftAlignedRenderedString& orig_str,
-          USize& size_func, float content_max_width, float window_max_width,
-          float epsilon);
-        void adjustSizeToContent_wordWrap_notKeepingAspectRatio(USize& size_func, float content_max_width,
-          float window_max_width, float epsilon);
+        USize getElementSizeLowerBoundAsFuncOfTextAreaSize(bool horz_scrollbar_visible,
+                                                           bool vert_scrollbar_visible) const;
+        USize getSizeAdjustedToContent_wordWrap_keepingAspectRatio(const USize& size_func,
+          const Sizef& content_max_size, float window_max_width, float epsilon) const;
+        USize getSizeAdjustedToContent_wordWrap_notKeepingAspectRatio(const USize& size_func,
+          float content_max_width, float window_max_width, float epsilon) const;
         void adjustSizeToContent_direct();
     };
 
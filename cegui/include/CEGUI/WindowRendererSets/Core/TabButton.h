@@ -56,6 +56,7 @@ namespace CEGUI
         FalagardTabButton(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryBuildThreadSafe() const override { return true; }
     };
 
 } // End of  CEGUI namespace section
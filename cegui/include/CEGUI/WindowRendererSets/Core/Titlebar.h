@@ -55,6 +55,7 @@ namespace CEGUI
         FalagardTitlebar(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryBuildThreadSafe() const override { return true; }
     };
 
 } // End of  CEGUI namespace section
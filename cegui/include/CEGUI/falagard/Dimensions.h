@@ -32,6 +32,7 @@
 #include "../UDim.h"
 #include "../Rectf.h"
 #include "../XMLSerializer.h"
+#include "../ImageHandle.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -326,8 +327,8 @@ protected:
     void writeXMLElementName_impl(XMLSerializer& xml_stream) const override;
     void writeXMLElementAttributes_impl(XMLSerializer& xml_stream) const override;
 
-    //! name of the Image.
-    String d_imageName;
+    //! name of the Image, caching the Image it refers to.
+    ImageHandle d_imageName;
 };
 
 //! ImageDimBase subclass that accesses an image fetched via a property.
@@ -28,6 +28,7 @@
 #define _CEGUIFalagardPropertyBase_h_
 
 #include "CEGUI/TypedProperty.h"
+#include "CEGUI/WindowRenderer.h"
 #include "CEGUI/falagard/PropertyDefinitionBase.h"
 
 namespace CEGUI
@@ -63,7 +64,15 @@ protected:
             static_cast<Window*>(receiver)->performChildWindowLayout();
 
         if (d_writeCausesRedraw)
-            static_cast<Window*>(receiver)->invalidate();
+        {
+            Window* const window = static_cast<Window*>(receiver);
+
+            // geometry cached for other states may depend on the value.
+            if (WindowRenderer* const wr = window->getWindowRenderer())
+                wr->clearStateGeometryCache();
+
+            window->invalidate();
+        }
 
         if (!d_eventFiredOnWrite.empty())
         {
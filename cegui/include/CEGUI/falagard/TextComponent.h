@@ -33,6 +33,8 @@
 #include "../FormattedRenderedString.h"
 #include "CEGUI/falagard/FormattingSetting.h"
 
+#include <mutex>
+
 #if defined(_MSC_VER)
 #  pragma warning(push)
 #  pragma warning(disable : 4251)
@@ -375,6 +377,8 @@ public:
     mutable RefCounted<FormattedRenderedString> d_formattedRenderedString;
     //! Tracks last used horizontal formatting (in order to detect changes)
     mutable HorizontalTextFormatting d_lastHorzFormatting;
+    //! guards the formatting state above when windows are drawn in parallel.
+    mutable std::mutex d_formattingMutex;
 
     String               d_font;            //!< name of font to use.
     //! Vertical formatting to be applied when rendering the image component.
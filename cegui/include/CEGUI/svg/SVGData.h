@@ -31,8 +31,13 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/String.h"
 #include "CEGUI/svg/SVGPaintStyle.h"
+#include "CEGUI/GeometryBuffer.h"
 
 #include <vector>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <tuple>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -43,6 +48,8 @@
 namespace CEGUI
 {
 class SVGBasicShape;
+class BitmapImage;
+class Texture;
 
 /*!
 \brief
@@ -174,6 +181,131 @@ public:
     */
     void setHeight(float height);
 
+    /*!
+    \brief
+        The tesselated geometry of one GeometryBuffer, stored in the local
+        coordinates of the SVG document so it can be re-emitted for any
+        destination area, clipping area and alpha.
+    */
+    struct TesselatedGeometry
+    {
+        //! The raw vertex data of the buffer.
+        std::vector<float> d_vertexData;
+        //! The transformation of the shape the geometry belongs to.
+        glm::mat4 d_customTransform;
+        //! The fill rule that is used when rendering the geometry.
+        PolygonFillRule d_fillRule;
+        //! The number of vertices rendered after the stencil buffer was filled.
+        unsigned int d_postStencilVertexCount;
+    };
+
+    //! The tesselated geometry of all shapes for one set of tesselation settings.
+    typedef std::vector<TesselatedGeometry> TesselatedGeometryList;
+
+    /*!
+    \brief
+        Returns the cached tesselation of the shapes for the given scale factor
+        and anti-aliasing mode and counts the lookup as a cache hit or miss.
+
+    \return
+        Pointer to the cached geometry or nullptr if the shapes have not been
+        tesselated with these settings yet.
+    */
+    const TesselatedGeometryList* getCachedTesselation(const glm::vec2& scale_factor,
+                                                       bool anti_aliasing) const;
+
+    /*!
+    \brief
+        Stores the tesselation of the shapes for the given scale factor and
+        anti-aliasing mode, so that later SVGImage renders can skip tesselating.
+
+    \return
+        Reference to the cached geometry.
+    */
+    const TesselatedGeometryList& cacheTesselation(const glm::vec2& scale_factor,
+                                                   bool anti_aliasing,
+                                                   TesselatedGeometryList geometry) const;
+
+    /*!
+    \brief
+        Discards all cached tesselations and rasterisations. This is done
+        automatically when shapes are added or destroyed, but must be called
+        manually after modifying the shapes returned by getShapes.
+    */
+    void invalidateTesselationCache();
+
+    /*!
+    \brief
+        Returns the cached rasterisation of an image area at a pixel size and
+        marks it as the most recently used one.
+
+    \return
+        Pointer to a BitmapImage rendering the rasterised texture, or nullptr
+        if the image area has not been rasterised at this size yet.
+    */
+    const BitmapImage* getCachedRasterisation(const Rectf& image_area,
+                                              const Sizef& pixel_size,
+                                              bool anti_aliasing) const;
+
+    /*!
+    \brief
+        Creates a texture from the rasterised pixels of an image area and caches
+        it. Room is made as described for makeRoomForRasterisation.
+
+    \param rgba_pixels
+        The pixels of the rasterisation, as created by the SVGRasteriser.
+
+    \return
+        Pointer to a BitmapImage rendering the rasterised texture, or nullptr
+        if the rasterisation does not fit into the budget.
+    */
+    const BitmapImage* cacheRasterisation(const Rectf& image_area,
+                                          const Sizef& pixel_size,
+                                          bool anti_aliasing,
+                                          const std::vector<std::uint8_t>& rgba_pixels) const;
+
+    /*!
+    \brief
+        Makes room for a rasterisation of the given size by evicting the least
+        recently used rasterisations of all SVGData objects. Rasterisations
+        that GeometryBuffers still render with are never evicted here, so no
+        cached rendering has to be invalidated while geometry is being built.
+
+    \return
+        true if a rasterisation of \a bytes now fits into the budget.
+    */
+    static bool makeRoomForRasterisation(std::size_t bytes);
+
+    /*!
+    \brief
+        Sets the maximum number of bytes of texture memory that the rasterisations
+        of all SVGData objects may use together. If rasterisations still in use
+        must be evicted to meet a lower budget, all cached rendering is
+        invalidated once.
+    */
+    static void setRasterisationBudget(std::size_t bytes);
+
+    //! Returns the maximum number of bytes of texture memory used for rasterisations.
+    static std::size_t getRasterisationBudget();
+
+    //! Returns the number of bytes of texture memory currently used for rasterisations.
+    static std::size_t getRasterisationMemoryUsage();
+
+    /*!
+    \brief
+        Destroys the textures of rasterisations that were evicted or invalidated.
+        They are kept alive until then, since GeometryBuffers queued for
+        rendering in the current frame may still use them. The System calls
+        this once all GUIContexts have been rendered.
+    */
+    static void destroyRetiredRasterisations();
+
+    //! Returns how often a cached tesselation could be reused.
+    std::size_t getTesselationCacheHits() const;
+
+    //! Returns how often the shapes had to be tesselated anew.
+    std::size_t getTesselationCacheMisses() const;
+
 protected:
     // implement chained xml handler abstract interface
     void elementStartLocal(const String& element,
@@ -269,6 +401,61 @@ protected:
     //! The basic shapes that were added to the SVGData
     std::vector<SVGBasicShape*> d_svgBasicShapes;
 
+    //! Key of the tesselation cache: scale factor x, scale factor y and anti-aliasing mode.
+    typedef std::tuple<float, float, bool> TesselationKey;
+    //! The cached tesselations of the shapes.
+    mutable std::map<TesselationKey, TesselatedGeometryList> d_tesselationCache;
+    //! Number of tesselation cache lookups that found a cached tesselation.
+    mutable std::size_t d_tesselationCacheHits;
+    //! Number of tesselation cache lookups that found no cached tesselation.
+    mutable std::size_t d_tesselationCacheMisses;
+
+    //! Key of the rasterisation cache: image area, pixel size and anti-aliasing mode.
+    typedef std::tuple<float, float, float, float, float, float, bool> RasterisationKey;
+
+    //! A texture holding a rasterised image area and the image rendering it.
+    struct Rasterisation
+    {
+        const SVGData* d_owner;
+        RasterisationKey d_key;
+        Texture* d_texture;
+        BitmapImage* d_image;
+        std::size_t d_byteSize;
+        std::list<Rasterisation*>::iterator d_usagePosition;
+    };
+
+    //! The cached rasterisations of this SVGData.
+    mutable std::map<RasterisationKey, Rasterisation*> d_rasterisations;
+
+    //! Rasterisations of all SVGData objects, the most recently used first.
+    static std::list<Rasterisation*> d_rasterisationUsage;
+    //! Maximum texture memory for the rasterisations of all SVGData objects.
+    static std::size_t d_rasterisationBudget;
+    //! Texture memory currently used by the rasterisations of all SVGData objects.
+    static std::size_t d_rasterisationMemoryUsage;
+
+    //! Rasterisations that are no longer cached but may still be queued for rendering.
+    static std::vector<Rasterisation*> d_retiredRasterisations;
+
+    //! Removes a rasterisation from the caches.
+    static void removeRasterisation(Rasterisation* rasterisation);
+
+    //! Destroys the texture and image of a rasterisation.
+    static void destroyRasterisation(Rasterisation* rasterisation);
+
+    /*!
+    \brief
+        Removes a rasterisation from the caches and retires it until the end
+        of the frame.
+
+    \return
+        Nothing.
+    */
+    static void retireRasterisation(Rasterisation* rasterisation);
+
+    //! Retires all rasterisations of this SVGData and invalidates cached rendering using them.
+    void retireRasterisations() const;
+
 private:
     /*!
     \brief
@@ -28,12 +28,12 @@
 #define _SVGImage_h_
 
 #include "CEGUI/Image.h"
+#include "CEGUI/svg/SVGData.h"
 
 #include <glm/glm.hpp>
 
 namespace CEGUI
 {
-class SVGData;
 
 /*!
 \brief
@@ -66,6 +66,22 @@ public:
         bool d_antiAliasing;
     };
 
+    /*!
+    \brief
+        Policies for choosing the pixel size at which the image is rasterised
+        when rasterisation is used. Coarser sizes let differently sized
+        renders share one texture, at the cost of some resampling.
+    */
+    enum class RasterSizePolicy : int
+    {
+        //! Rasterise at the destination size, rounded up to whole pixels.
+        Exact,
+        //! Round the destination size up to a multiple of the raster size step.
+        Step,
+        //! Round the destination size up to the next power of two.
+        PowerOfTwo
+    };
+
     SVGImage(const String& name);
     SVGImage(const String& name, SVGData& svg_data);
     SVGImage(const XMLAttributes& attributes);
@@ -114,7 +130,56 @@ public:
     */
     void setUseGeometryAntialiasing(bool use_geometry_antialiasing);
 
+    /*!
+    \brief
+        Returns if the image is rasterised into a texture on the CPU and rendered
+        as a textured quad instead of as tesselated geometry.
+    */
+    bool getUsesRasterisation() const;
+
+    /*!
+    \brief
+        Sets if the image is rasterised into a texture on the CPU and rendered as
+        a textured quad instead of as tesselated geometry. This is much cheaper to
+        render for static images drawn at a few sizes, especially ones using fill
+        rules. The textures are shared through the SVGData and limited by
+        SVGData::setRasterisationBudget; renders that do not fit the budget or
+        the maximum texture size fall back to geometry.
+    */
+    void setUseRasterisation(bool use_rasterisation);
+
+    //! Returns the policy for choosing the pixel size of rasterisations.
+    RasterSizePolicy getRasterSizePolicy() const;
+
+    //! Sets the policy for choosing the pixel size of rasterisations.
+    void setRasterSizePolicy(RasterSizePolicy policy);
+
+    //! Returns the step, in pixels, used by the RasterSizePolicy::Step policy.
+    unsigned int getRasterSizeStep() const;
+
+    //! Sets the step, in pixels, used by the RasterSizePolicy::Step policy.
+    void setRasterSizeStep(unsigned int step);
+
 protected:
+    //! Returns the tesselation of the SVGData's shapes, from the cache if possible.
+    const SVGData::TesselatedGeometryList& getTesselation(
+        const SVGImageRenderSettings& render_settings) const;
+
+    //! Creates GeometryBuffers from a tesselation of the SVGData's shapes.
+    std::vector<GeometryBuffer*> createTesselatedRenderGeometry(
+        const SVGData::TesselatedGeometryList& tesselation,
+        const SVGImageRenderSettings& render_settings) const;
+
+    /*!
+    \brief
+        Returns the image rendering the rasterisation for the given destination
+        size, rasterising it if needed, or nullptr if it can not be rasterised.
+    */
+    const BitmapImage* getRasterisation(const Sizef& dest_size) const;
+
+    //! Returns the pixel size to rasterise at for one dimension of the destination.
+    float getRasterSize(float dest_size) const;
+
     /*!
         \brief
         Reference to the SVGData used as basis for drawing. The SVGData can be shared
@@ -130,6 +195,15 @@ protected:
         an alpha-blended transition to defeat aliasing artefacts
     */
     bool d_useGeometryAntialiasing;
+
+    //! Determines if the image is rendered as a rasterised texture.
+    bool d_useRasterisation;
+
+    //! Policy for choosing the pixel size of rasterisations.
+    RasterSizePolicy d_rasterSizePolicy;
+
+    //! Step, in pixels, used by the RasterSizePolicy::Step policy.
+    unsigned int d_rasterSizeStep;
 };
 
 }
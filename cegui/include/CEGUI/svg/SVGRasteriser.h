@@ -0,0 +1,128 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    CPU rasteriser for tesselated SVG geometry
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _SVGRasteriser_h_
+#define _SVGRasteriser_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/svg/SVGData.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace CEGUI
+{
+/*!
+\brief
+    Defines a static class that rasterises the tesselated geometry of SVG shapes
+    into an RGBA pixel buffer on the CPU.
+
+    The rasteriser reproduces what the Renderers do with the GeometryBuffers
+    created by the SVGTesselator: plain geometry is alpha-blended, while
+    geometry using a PolygonFillRule first marks the covered pixels in a
+    stencil and then draws the post-stencil vertices where the stencil test
+    passes. Since no Renderer is involved it can also be used headless.
+*/
+class CEGUIEXPORT SVGRasteriser
+{
+public:
+    /*!
+    \brief
+        Rasterises tesselated SVG geometry into a pixel buffer.
+
+    \param geometry
+        The tesselated geometry, with vertex positions in SVG document
+        coordinates and the layout of coloured vertices.
+    \param scale_factor
+        The scale that transforms SVG document coordinates into pixels.
+    \param origin
+        The pixel position, after scaling, that maps to the top-left pixel
+        of the buffer.
+    \param width
+        The width of the pixel buffer.
+    \param height
+        The height of the pixel buffer.
+    \param rgba_pixels
+        Receives width * height pixels with 8 bit red, green, blue and alpha
+        channels in that order. Alpha is not premultiplied.
+    */
+    static void rasterise(const SVGData::TesselatedGeometryList& geometry,
+                          const glm::vec2& scale_factor,
+                          const glm::vec2& origin,
+                          unsigned int width,
+                          unsigned int height,
+                          std::vector<std::uint8_t>& rgba_pixels);
+
+private:
+    //! Operation applied to the pixels covered by a triangle.
+    enum class PixelOperation : int
+    {
+        //! Blend the interpolated vertex colour onto the pixel.
+        Blend,
+        //! Blend the colour only where the stencil test passes.
+        BlendStencilled,
+        //! Invert the stencil value.
+        StencilInvert,
+        //! Increment or decrement the stencil value depending on the winding.
+        StencilWinding
+    };
+
+    //! State shared by all triangles rasterised into one pixel buffer.
+    struct RasterTarget
+    {
+        unsigned int d_width;
+        unsigned int d_height;
+        std::vector<glm::vec4> d_colours;
+        std::vector<std::uint8_t> d_stencil;
+        PolygonFillRule d_fillRule;
+    };
+
+    //! Rasterises the vertices [first, last) of one GeometryBuffer's vertex data.
+    static void rasteriseTriangles(RasterTarget& target,
+                                   const std::vector<glm::vec2>& positions,
+                                   const std::vector<glm::vec4>& colours,
+                                   std::size_t first, std::size_t last,
+                                   PixelOperation operation);
+
+    //! Rasterises a single triangle.
+    static void rasteriseTriangle(RasterTarget& target,
+                                  const glm::vec2* positions,
+                                  const glm::vec4* colours,
+                                  PixelOperation operation);
+
+    //! Returns whether the stencil test passes for the given stencil value.
+    static bool isStencilTestPassing(PolygonFillRule fill_rule, std::uint8_t stencil_value);
+
+    //! Blends a straight-alpha colour over a straight-alpha destination.
+    static void blendColour(glm::vec4& destination, const glm::vec4& source);
+};
+
+}
+
+#endif
@@ -30,6 +30,7 @@
 #define _CEGUIListView_h_
 
 #include "CEGUI/views/ItemView.h"
+#include "CEGUI/ImageHandle.h"
 #include <vector>
 
 #if defined (_MSC_VER)
@@ -53,8 +54,8 @@ namespace CEGUI
 struct CEGUIEXPORT ListViewItemRenderingState
 {
     RenderedString d_string;
-    //! The name of the image that represents the icon
-    String d_icon;
+    //! The image that represents the icon, resolved when first rendered
+    ImageHandle d_icon;
     Sizef d_size;
     bool d_isSelected;
     ModelIndex d_index;
@@ -32,6 +32,7 @@
 #include "CEGUI/EventArgs.h"
 #include "CEGUI/InputEvent.h"
 #include "CEGUI/views/ItemView.h"
+#include "CEGUI/ImageHandle.h"
 #include <vector>
 
 #if defined (_MSC_VER)
@@ -93,8 +94,8 @@ public:
     size_t d_totalChildCount;
 
     String d_text;
-    //! The name of the image that represents the icon
-    String d_icon;
+    //! The image that represents the icon, resolved when first rendered
+    ImageHandle d_icon;
     RenderedString d_string;
     Sizef d_size;
     bool d_isSelected;
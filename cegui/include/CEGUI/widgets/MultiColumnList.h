@@ -757,9 +757,28 @@ public:
     /*!
     \brief
         Return, in pixels, the height of the highest item in the given row.
+
+        Row heights are measured once and cached until the row's items are
+        replaced, the font changes or handleUpdatedItemData is called.
     */
     float   getHighestRowItemHeight(unsigned int row_idx) const;
 
+    /*!
+    \brief
+        Return, in pixels, the distance from the top of the first row to the
+        top of the given row. Passing getRowCount() returns the total height
+        of all rows.
+    */
+    float   getRowOffset(unsigned int row_idx) const;
+
+    /*!
+    \brief
+        Return the index of the first row whose bottom edge lies below the
+        given distance, in pixels, from the top of the first row; or
+        getRowCount() if there is no such row.
+    */
+    unsigned int getRowAtOffset(float offset) const;
+
     /*!
     \brief
         Get whether or not column auto-sizing (autoSizeColumnHeader()) will use
@@ -1684,6 +1703,8 @@ protected:
 		RowItems	d_items;
 		unsigned int		d_sortColumn;
 		unsigned int		d_rowID;
+		//! cached height of the row, negative if it needs to be measured.
+		mutable float	d_height = -1.0f;
 
 		// operators
 		ListboxItem* const& operator[](unsigned int idx) const	{return d_items[idx];}
@@ -1724,6 +1745,17 @@ protected:
 	typedef std::vector<ListRow> ListItemGrid;
 	ListItemGrid	d_grid;			//!< Holds the list box data.
 
+    //! offsets of the top of each row from the first one, plus the total height.
+    mutable std::vector<float> d_rowOffsets;
+    //! whether d_rowOffsets is up to date with the rows and their heights.
+    mutable bool d_rowOffsetsValid;
+
+    //! Forget the cached heights of all rows so they are measured again.
+    void invalidateRowHeights();
+
+    //! Recalculate d_rowOffsets if needed.
+    void updateRowOffsets() const;
+
     //! whether header size will be considered when auto-sizing columns.
     bool d_autoSizeColumnUsesHeader;
 
@@ -232,6 +232,29 @@ public:
     */
     void setContentPaneAutoSized(bool setting);
 
+    /*!
+    \brief
+        Return whether children of the content pane that are outside the
+        viewable area are culled.
+    */
+    bool isContentCullingEnabled(void) const;
+
+    /*!
+    \brief
+        Set whether children of the content pane that are outside the viewable
+        area are culled. While enabled, such children are not drawn and
+        scrolling only updates the children that are, or were, in view, so it
+        costs the same however much content the pane holds.
+
+    \see
+        ScrolledContainer::setContentCullingEnabled
+
+    \param setting
+        - true to cull the children outside the viewable area.
+        - false to update and draw all children.
+    */
+    void setContentCullingEnabled(bool setting);
+
     /*!
     \brief
         Return the current content pane area for the ScrollablePane.
@@ -445,6 +468,15 @@ public:
     void initialiseComponents(void) override;
     void destroy(void) override;
 
+    /*!
+    \brief
+        Begin initialisation, which also batches the content changes of the
+        content pane until endInitialisation is called. Use this around adding
+        many child windows, so the scrollbars are only configured once.
+    */
+    void beginInitialisation(void) override;
+    void endInitialisation(void) override;
+
 protected:
     /*!
     \brief
@@ -30,6 +30,8 @@
 #include "../Window.h"
 #include "../WindowFactory.h"
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -130,9 +132,53 @@ public:
         Rect object that describes the pixel extents of the attached
         child windows.  This is effectively the smallest bounding box
         that could contain all the attached windows.
+
+    \note
+        The extents are tracked as children are added, moved, sized and
+        removed, so this is usually cheap. The children are only scanned
+        again after the child on an edge of the extents moved inwards or
+        was removed.
     */
     Rectf getChildExtentsArea(void) const;
 
+    /*!
+    \brief
+        Return whether children outside the visible area are culled.
+    */
+    bool isContentCullingEnabled(void) const;
+
+    /*!
+    \brief
+        Set whether children outside the visible area are culled.
+
+        While enabled, children whose area lies outside the area clipped by
+        the parent are not drawn, and moving the container without resizing
+        it - which is how the ScrollablePane scrolls - only updates the screen
+        areas of the children that are, or were, in view. The other children
+        are updated once they come into view, so scrolling costs the same
+        however much content there is.
+
+    \note
+        While enabled, the screen area of a child that stayed out of view
+        during scrolling is not updated until it comes into view again.
+        Children that are not clipped by this window are always updated and
+        drawn.
+
+    \param setting
+        - true to cull the children outside the visible area.
+        - false to update and draw all children.
+    */
+    void setContentCullingEnabled(bool setting);
+
+    /*!
+    \brief
+        End initialisation, firing EventContentChanged once if the content
+        changed since beginInitialisation was called. Between the two calls
+        the notification is deferred, so adding many children in one batch
+        only updates the scrollable pane once.
+    */
+    void endInitialisation(void) override;
+
     const CachedRectf& getClientChildContentArea() const override;
     const CachedRectf& getNonClientChildContentArea() const override;
 
@@ -174,9 +220,55 @@ protected:
     //! handles notifications about child windows being sized.
     bool handleChildMoved(const EventArgs& e);
 
+    /*!
+    \brief
+        Call onContentChanged, or defer it until endInitialisation while a
+        batch of changes is in progress.
+    */
+    void notifyContentChanged();
+
+    //! Return the pixel area the child \a wnd contributes to the extents.
+    Rectf getChildArea(const Window& wnd) const;
+
+    /*!
+    \brief
+        Return the area, relative to this window, in which children can be
+        visible. It is grown by a pixel on each side to allow for the pixel
+        alignment of the children's screen areas.
+    */
+    Rectf getViewArea() const;
+
+    //! Return whether a child with the pixel area \a area may be visible.
+    static bool isInViewArea(const Rectf& area, const Rectf& view_area);
+
+    /*!
+    \brief
+        Rebuild the list of children in view. If \a notify_entering is true,
+        the screen area of the children that were not in view is updated.
+    */
+    void updateChildrenInView(bool notify_entering);
+
+    //! Add the child \a wnd to the list of children in view if it is in view.
+    void updateChildInView(Window& wnd);
+
+    /*!
+    \brief
+        Update the tracked extents for a child that was added, moved or sized.
+        If the child was on an edge of the extents and moved inwards, the
+        extents are recomputed lazily by the next getChildExtentsArea call.
+    */
+    void updateChildExtents(Window& wnd);
+
+    //! Update the tracked extents for a child that is being removed.
+    void removeChildExtents(const Window& wnd);
+
+    //! Return whether \a area lies on an edge of the tracked extents.
+    bool isOnChildExtentsEdge(const Rectf& area) const;
+
     // overridden from Window.
     void drawSelf(const RenderingContext&) override
     {}
+    void drawChildren() override;
     Rectf getInnerRectClipper_impl() const override;
 
     void setArea_impl(const UVector2& pos, const USize& size, bool topLeftSizing=false, bool fireEvents=true,
@@ -197,6 +289,40 @@ protected:
     
     CachedRectf d_clientChildContentArea;
 
+    //! Area a child contributed to the extents when it was last updated.
+    struct ChildArea
+    {
+        Window* d_window;
+        Rectf d_area;
+    };
+    //! type definition for collection used to track the area of each child.
+    typedef std::vector<ChildArea> ChildAreaList;
+    //! Area of each child, kept contiguous so recomputing the extents is cheap.
+    mutable ChildAreaList d_childAreas;
+    //! Index of each child's entry in d_childAreas.
+    std::unordered_map<const Window*, size_t> d_childAreaIndices;
+    //! Cached extents of the child windows.
+    mutable Rectf d_childExtents;
+    //! Pixel size of this window that the child areas were fetched for.
+    mutable Sizef d_childExtentsPixelSize;
+    //! true if d_childExtents is up to date.
+    mutable bool d_childExtentsValid;
+    //! true if onContentChanged is due once the current batch has ended.
+    bool d_contentChangePending;
+
+    //! true if children outside the visible area are culled.
+    bool d_contentCullingEnabled;
+    //! true while this window is being moved without being sized.
+    bool d_movingContent;
+    //! type definition for collection used to track the children in view.
+    typedef std::vector<Window*> ChildInViewList;
+    /*!
+        Children whose screen areas are kept up to date while scrolling,
+        sorted by address. Holds every child that has been in view since the
+        container was last moved.
+    */
+    ChildInViewList d_childrenInView;
+
 private:
     void addScrolledContainerProperties(void);
     void makeSureChildUsesAbsoluteArea(const Element* child) const;
@@ -118,7 +118,7 @@ std::vector<GeometryBuffer*> BitmapImage::createRenderGeometry(const ImageRender
     if(render_settings.d_clippingEnabled)
         buffer.setClippingRegion(*render_settings.d_clipArea);
     buffer.setTexture("texture0", d_texture);
-    buffer.appendGeometry(vbuffer, 6);
+    buffer.appendQuad(vbuffer);
     buffer.setAlpha(render_settings.d_alpha);
 
     std::vector<GeometryBuffer*> geomBuffers;
@@ -148,7 +148,7 @@ void BitmapImage::addToRenderGeometry(
     TexturedColouredVertex vbuffer[6];
     createTexturedQuadVertices(vbuffer, colours, finalRect, texRect);
 
-    geomBuffer.appendGeometry(vbuffer, 6);
+    geomBuffer.appendQuad(vbuffer);
 }
 
 
@@ -26,6 +26,7 @@
  ***************************************************************************/
 #include "CEGUI/CentredRenderedString.h"
 #include "CEGUI/RenderedString.h"
+#include "CEGUI/Profiler.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -39,6 +40,8 @@ CentredRenderedString::CentredRenderedString(const RenderedString& string) :
 //----------------------------------------------------------------------------//
 void CentredRenderedString::format(const Window* ref_wnd, const Sizef& area_size)
 {
+    CEGUI_PROFILE_ZONE("FormattedRenderedString::format");
+
     d_offsets.clear();
 
     for (size_t i = 0; i < d_renderedString->getLineCount(); ++i)
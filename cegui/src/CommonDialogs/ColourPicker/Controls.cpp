@@ -136,8 +136,15 @@ ColourPickerControls::ColourPickerControls(const String& type, const String& nam
     d_colourPickerAlphaSliderImageHeight(60),
     d_colourPickerControlsTextureSize(512),
     d_draggingColourPickerIndicator(false),
-    d_colourPickingTexture(new RGB_Colour[d_colourPickerControlsTextureSize *
-                                          d_colourPickerControlsTextureSize]),
+    d_colourPickingImageData(d_colourPickerPickingImageWidth *
+                             d_colourPickerPickingImageHeight),
+    d_colourSliderImageData(d_colourPickerColourSliderImageWidth *
+                            d_colourPickerColourSliderImageHeight),
+    d_alphaSliderImageData(d_colourPickerAlphaSliderImageWidth *
+                           d_colourPickerAlphaSliderImageHeight),
+    d_colourPickingImageChanged(true),
+    d_colourSliderImageChanged(true),
+    d_alphaSliderImageChanged(true),
     d_ignoreEvents(false),
     d_regexMatcher(*System::getSingleton().createRegexMatcher())
 {
@@ -195,19 +202,8 @@ HSV_Colour ColourPickerControls::getColourPickingPositionColourHSV(float xAbs,
 
     if (d_sliderMode != SliderMode::HSV_H)
     {
-        float xCoord = (xRel - 0.5f) * 2.0f;
-        float yCoord = (yRel - 0.5f) * 2.0f;
-
-        float angle = std::atan2(yCoord, xCoord);
-
-        if (angle < 0.0f)
-            angle += 2.0f * 3.1415926535897932384626433832795f;
-
-        angle /= 2.0f * 3.1415926535897932384626433832795f;
-        colour.H = angle;
-
-        float length = std::sqrt(xCoord * xCoord + yCoord * yCoord);
-        float value = std::min(length, 1.0f);
+        float value;
+        getColourWheelPosition(xAbs, yAbs, colour.H, value);
 
         if (d_sliderMode != SliderMode::HSV_S)
         {
@@ -230,6 +226,50 @@ HSV_Colour ColourPickerControls::getColourPickingPositionColourHSV(float xAbs,
     return colour;
 }
 
+//----------------------------------------------------------------------------//
+void ColourPickerControls::getColourWheelPosition(float xAbs, float yAbs,
+                                                  float& hue,
+                                                  float& radius) const
+{
+    float xRel = xAbs / static_cast<float>(d_colourPickerPickingImageWidth - 1);
+    float yRel = yAbs / static_cast<float>(d_colourPickerPickingImageHeight - 1);
+
+    float xCoord = (xRel - 0.5f) * 2.0f;
+    float yCoord = (yRel - 0.5f) * 2.0f;
+
+    float angle = std::atan2(yCoord, xCoord);
+
+    if (angle < 0.0f)
+        angle += 2.0f * 3.1415926535897932384626433832795f;
+
+    hue = angle / (2.0f * 3.1415926535897932384626433832795f);
+
+    float length = std::sqrt(xCoord * xCoord + yCoord * yCoord);
+    radius = std::min(length, 1.0f);
+}
+
+//----------------------------------------------------------------------------//
+void ColourPickerControls::initColourWheel()
+{
+    if (!d_colourWheelHue.empty())
+        return;
+
+    const size_t count = d_colourPickingImageData.size();
+    d_colourWheelHue.resize(count);
+    d_colourWheelRadius.resize(count);
+
+    for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
+    {
+        for (int x = 0; x < d_colourPickerPickingImageWidth; ++x)
+        {
+            const int i = d_colourPickerPickingImageWidth * y + x;
+
+            getColourWheelPosition(static_cast<float>(x), static_cast<float>(y),
+                                   d_colourWheelHue[i], d_colourWheelRadius[i]);
+        }
+    }
+}
+
 //----------------------------------------------------------------------------//
 glm::vec2 ColourPickerControls::getColourPickingColourPosition()
 {
@@ -398,6 +438,21 @@ void ColourPickerControls::initColourPickerControlsImageSet()
     getColourPickerAlphaSlider()->setProperty(
         "ScrollImage", baseName + '/' + ColourPickerControlsAlphaSliderTextureImageName);
 
+    // size the texture once; the images are then uploaded to their areas only.
+    // It is RGBA, as not all renderers can blit to a texture of another format.
+    const std::vector<std::uint8_t> blank(
+        d_colourPickerControlsTextureSize * d_colourPickerControlsTextureSize * 4);
+
+    d_colourPickerControlsTextureTarget->getTexture().loadFromMemory(
+        blank.data(),
+        Sizef(static_cast<float>(d_colourPickerControlsTextureSize),
+              static_cast<float>(d_colourPickerControlsTextureSize)),
+        Texture::PixelFormat::Rgba);
+
+    d_colourPickingImageChanged = true;
+    d_colourSliderImageChanged = true;
+    d_alphaSliderImageChanged = true;
+
     refreshColourPickerControlsTextures();
 }
 
@@ -430,17 +485,59 @@ void ColourPickerControls::refreshColourPickerControlsTextures()
 //----------------------------------------------------------------------------//
 void ColourPickerControls::reloadColourPickerControlsTexture()
 {
-    d_colourPickerControlsTextureTarget->getTexture().loadFromMemory(
-        d_colourPickingTexture,
-        Sizef(static_cast<float>(d_colourPickerControlsTextureSize),
-              static_cast<float>(d_colourPickerControlsTextureSize)),
-        Texture::PixelFormat::Rgb);
+    if (d_colourPickingImageChanged)
+    {
+        blitColourImage(d_colourPickingImageData,
+            Rectf(glm::vec2(0.0f, 0.0f),
+                  Sizef(static_cast<float>(d_colourPickerPickingImageWidth),
+                        static_cast<float>(d_colourPickerPickingImageHeight))));
+        d_colourPickingImageChanged = false;
+    }
+
+    if (d_colourSliderImageChanged)
+    {
+        blitColourImage(d_colourSliderImageData,
+            Rectf(glm::vec2(static_cast<float>(d_colourPickerPickingImageWidth +
+                                               d_colourPickerImageOffset), 0.0f),
+                  Sizef(static_cast<float>(d_colourPickerColourSliderImageWidth),
+                        static_cast<float>(d_colourPickerColourSliderImageHeight))));
+        d_colourSliderImageChanged = false;
+    }
+
+    if (d_alphaSliderImageChanged)
+    {
+        blitColourImage(d_alphaSliderImageData,
+            Rectf(glm::vec2(0.0f, static_cast<float>(d_colourPickerPickingImageHeight +
+                                                     d_colourPickerImageOffset)),
+                  Sizef(static_cast<float>(d_colourPickerAlphaSliderImageWidth),
+                        static_cast<float>(d_colourPickerAlphaSliderImageHeight))));
+        d_alphaSliderImageChanged = false;
+    }
 
     getColourPickerImageSlider()->invalidate();
     getColourPickerAlphaSlider()->invalidate();
     getColourPickerStaticImage()->invalidate();
 }
 
+//----------------------------------------------------------------------------//
+void ColourPickerControls::blitColourImage(
+    const std::vector<RGB_Colour>& image_data, const Rectf& area)
+{
+    d_blitPixels.resize(image_data.size() * 4);
+
+    std::uint8_t* dst = d_blitPixels.data();
+    for (const RGB_Colour& colour : image_data)
+    {
+        *dst++ = colour.r;
+        *dst++ = colour.g;
+        *dst++ = colour.b;
+        *dst++ = 0xFF;
+    }
+
+    d_colourPickerControlsTextureTarget->getTexture().blitFromMemory(
+        d_blitPixels.data(), area);
+}
+
 //----------------------------------------------------------------------------//
 void ColourPickerControls::initialiseComponents()
 {
@@ -603,9 +700,6 @@ void ColourPickerControls::destroy( void )
         d_colourPickerIndicator = nullptr;
     }
 
-    delete[] d_colourPickingTexture;
-    d_colourPickingTexture = nullptr;
-
     System::getSingleton().destroyRegexMatcher(&d_regexMatcher);
 
     Window::destroy();
@@ -1214,79 +1308,129 @@ void ColourPickerControls::onAcceptButtonClicked(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void ColourPickerControls::refreshColourPickingImage()
 {
+    const int width = d_colourPickerPickingImageWidth;
+
+    // colour components of one row, converted to RGB in a single batch.
+    std::vector<float> c0(width);
+    std::vector<float> c1(width);
+    std::vector<float> c2(width);
+
     if (d_sliderMode &
             (LAB_L | LAB_A | SliderMode::LAB_B))
     {
         for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
         {
-            for (int x = 0; x < d_colourPickerPickingImageWidth; ++x)
+            for (int x = 0; x < width; ++x)
             {
-                int i = d_colourPickerControlsTextureSize * y + x;
-
                 Lab_Colour colour =
                     getColourPickingPositionColourLAB(static_cast<float>(x),
                                                       static_cast<float>(y));
 
-                d_colourPickingTexture[i] = RGB_Colour(colour);
+                c0[x] = colour.L;
+                c1[x] = colour.a;
+                c2[x] = colour.b;
             }
+
+            ColourPickerConversions::labToRGB(c0.data(), c1.data(), c2.data(),
+                &d_colourPickingImageData[width * y], width);
         }
     }
-    else if (d_sliderMode &
-             (SliderMode::HSV_H | SliderMode::HSV_S | SliderMode::HSV_V))
+    else if (d_sliderMode == SliderMode::HSV_H)
     {
         for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
         {
-            for (int x = 0; x < d_colourPickerPickingImageWidth; ++x)
+            for (int x = 0; x < width; ++x)
             {
-                int i = d_colourPickerControlsTextureSize * y + x;
-
                 HSV_Colour colour =
                     getColourPickingPositionColourHSV(static_cast<float>(x),
                                                       static_cast<float>(y));
 
-                d_colourPickingTexture[i] = RGB_Colour(colour);
+                c0[x] = colour.H;
+                c1[x] = colour.S;
+                c2[x] = colour.V;
             }
+
+            ColourPickerConversions::hsvToRGB(c0.data(), c1.data(), c2.data(),
+                &d_colourPickingImageData[width * y], width);
+        }
+    }
+    else if (d_sliderMode &
+             (SliderMode::HSV_S | SliderMode::HSV_V))
+    {
+        // the hue and the varying component come from the cached wheel.
+        initColourWheel();
+
+        const float selected = (d_sliderMode == SliderMode::HSV_S) ?
+            d_selectedColourHSV.S : d_selectedColourHSV.V;
+        std::fill(c0.begin(), c0.end(), selected);
+
+        for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
+        {
+            const float* hue = &d_colourWheelHue[width * y];
+            const float* radius = &d_colourWheelRadius[width * y];
+
+            if (d_sliderMode == SliderMode::HSV_S)
+                ColourPickerConversions::hsvToRGB(hue, c0.data(), radius,
+                    &d_colourPickingImageData[width * y], width);
+            else
+                ColourPickerConversions::hsvToRGB(hue, radius, c0.data(),
+                    &d_colourPickingImageData[width * y], width);
         }
     }
+
+    d_colourPickingImageChanged = true;
 }
 
 //----------------------------------------------------------------------------//
 void ColourPickerControls::refreshColourSliderImage()
 {
+    const int width = d_colourPickerColourSliderImageWidth;
+    const int height = d_colourPickerColourSliderImageHeight;
+
+    // the slider only varies vertically, so one column is converted and
+    // then repeated across the width.
+    std::vector<float> c0(height);
+    std::vector<float> c1(height);
+    std::vector<float> c2(height);
+    std::vector<RGB_Colour> column(height);
+
     if (d_sliderMode &
             (LAB_L | LAB_A | SliderMode::LAB_B))
     {
-        for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
+        for (int y = 0; y < height; ++y)
         {
-            for (int x = 0; x < d_colourPickerColourSliderImageWidth; ++x)
-            {
-                int i = d_colourPickerControlsTextureSize * y +
-                        (x + d_colourPickerPickingImageWidth + 2);
-
-                Lab_Colour colour = getColourSliderPositionColourLAB(
-                    y / static_cast<float>(d_colourPickerPickingImageHeight - 1));
+            Lab_Colour colour = getColourSliderPositionColourLAB(
+                y / static_cast<float>(height - 1));
 
-                d_colourPickingTexture[i] = RGB_Colour(colour);
-            }
+            c0[y] = colour.L;
+            c1[y] = colour.a;
+            c2[y] = colour.b;
         }
+
+        ColourPickerConversions::labToRGB(c0.data(), c1.data(), c2.data(),
+                                          column.data(), height);
     }
     else if (d_sliderMode &
              (SliderMode::HSV_H | SliderMode::HSV_S | SliderMode::HSV_V))
     {
-        for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
+        for (int y = 0; y < height; ++y)
         {
-            for (int x = 0; x < d_colourPickerColourSliderImageWidth; ++x)
-            {
-                int i = d_colourPickerControlsTextureSize * y +
-                        (x + d_colourPickerPickingImageWidth + 2);
-
-                HSV_Colour colour = getColourSliderPositionColourHSV(
-                    y / static_cast<float>(d_colourPickerPickingImageHeight - 1));
+            HSV_Colour colour = getColourSliderPositionColourHSV(
+                y / static_cast<float>(height - 1));
 
-                d_colourPickingTexture[i] = RGB_Colour(colour);
-            }
+            c0[y] = colour.H;
+            c1[y] = colour.S;
+            c2[y] = colour.V;
         }
+
+        ColourPickerConversions::hsvToRGB(c0.data(), c1.data(), c2.data(),
+                                          column.data(), height);
     }
+
+    for (int y = 0; y < height; ++y)
+        std::fill_n(&d_colourSliderImageData[width * y], width, column[y]);
+
+    d_colourSliderImageChanged = true;
 }
 
 //----------------------------------------------------------------------------//
@@ -1296,13 +1440,13 @@ void ColourPickerControls::refreshAlphaSliderImage()
     {
         for (int x = 0; x < d_colourPickerAlphaSliderImageWidth; ++x)
         {
-            int i = x + d_colourPickerControlsTextureSize *
-                (y + d_colourPickerImageOffset + d_colourPickerPickingImageHeight);
+            int i = x + d_colourPickerAlphaSliderImageWidth * y;
 
-            RGB_Colour curColour = getAlphaSliderPositionColour(x, y);
-            d_colourPickingTexture[i] = curColour;
+            d_alphaSliderImageData[i] = getAlphaSliderPositionColour(x, y);
         }
     }
+
+    d_alphaSliderImageChanged = true;
 }
 
 //----------------------------------------------------------------------------//
@@ -34,6 +34,38 @@
 namespace CEGUI
 {
 
+//----------------------------------------------------------------------------//
+// number of colours the batch conversions process at a time.
+static const size_t ConversionBlockSize = 64;
+
+//----------------------------------------------------------------------------//
+// Branch free selection of \a a if \a condition holds, else \a b. Under the
+// default floating point rules compilers will not turn a ternary on floats
+// into a vector select, so the batch conversions blend with a 0 or 1 mask
+// instead; the products are exact, so the result is exactly a or b.
+static inline float blend(bool condition, float a, float b)
+{
+    const float mask = static_cast<float>(static_cast<int>(condition));
+    return mask * a + (1.0f - mask) * b;
+}
+
+//----------------------------------------------------------------------------//
+// Convert a colour component to a byte, clamping it to the range [0, 1].
+static inline unsigned char toByte(float value)
+{
+    const int byte = static_cast<int>(255.0f * value);
+    return static_cast<unsigned char>(byte < 0 ? 0 : (byte > 255 ? 255 : byte));
+}
+
+//----------------------------------------------------------------------------//
+// Interleave the separately converted components into RGB_Colours.
+static void storeRGB(const unsigned char* r, const unsigned char* g,
+                     const unsigned char* b, RGB_Colour* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        out[i] = RGB_Colour(r[i], g[i], b[i]);
+}
+
 //----------------------------------------------------------------------------//
 const float ColourPickerConversions::Xn(0.95047f);
 const float ColourPickerConversions::Yn(1.00000f);
@@ -146,9 +178,9 @@ RGB_Colour ColourPickerConversions::toRGB(float L, float a, float b)
     float vz = vy - b / 200.0f;
 
     {
-        float vx3 = pow(vx, 3);
-        float vy3 = pow(vy, 3);
-        float vz3 = pow(vz, 3);
+        float vx3 = vx * vx * vx;
+        float vy3 = vy * vy * vy;
+        float vz3 = vz * vz * vz;
 
         if (vy3 > LAB_COMPARE_VALUE_CONST)
             vy = vy3;
@@ -182,6 +214,86 @@ RGB_Colour ColourPickerConversions::toRGB(float L, float a, float b)
                       static_cast<unsigned char>(255.0f * vb));
 }
 
+//----------------------------------------------------------------------------//
+void ColourPickerConversions::labToRGB(const float* L, const float* a,
+                                       const float* b, RGB_Colour* out,
+                                       size_t count)
+{
+    unsigned char red[ConversionBlockSize];
+    unsigned char green[ConversionBlockSize];
+    unsigned char blue[ConversionBlockSize];
+
+    for (size_t start = 0; start < count; start += ConversionBlockSize)
+    {
+        const size_t block = std::min(ConversionBlockSize, count - start);
+
+        for (size_t i = 0; i < block; ++i)
+        {
+            const float vy = (L[start + i] + 16.0f) / 116.0f;
+            const float vx = a[start + i] / 500.0f + vy;
+            const float vz = vy - b[start + i] / 200.0f;
+
+            const float vx3 = vx * vx * vx;
+            const float vy3 = vy * vy * vy;
+            const float vz3 = vz * vz * vz;
+
+            const float x = Xn * blend(vx3 > LAB_COMPARE_VALUE_CONST, vx3,
+                                        (vx - 16.0f / 116.0f) / 7.787f);
+            const float y = blend(vy3 > LAB_COMPARE_VALUE_CONST, vy3,
+                                   (vy - 16.0f / 116.0f) / 7.787f);
+            const float z = Zn * blend(vz3 > LAB_COMPARE_VALUE_CONST, vz3,
+                                        (vz - 16.0f / 116.0f) / 7.787f);
+
+            red[i] = toByte(x *  3.2406f + y * -1.5372f + z * -0.4986f);
+            green[i] = toByte(x * -0.9689f + y *  1.8758f + z *  0.0415f);
+            blue[i] = toByte(x *  0.0557f + y * -0.2040f + z *  1.0570f);
+        }
+
+        storeRGB(red, green, blue, out + start, block);
+    }
+}
+
+//----------------------------------------------------------------------------//
+// Weight of the chroma subtracted from the value for a colour channel, a
+// trapezoid over the hue sector k in the range [0, 6).
+static inline float hueWeight(float k)
+{
+    const float weight = blend(k < 4.0f - k, k, 4.0f - k);
+    return blend(weight < 0.0f, 0.0f, blend(weight > 1.0f, 1.0f, weight));
+}
+
+//----------------------------------------------------------------------------//
+void ColourPickerConversions::hsvToRGB(const float* H, const float* S,
+                                       const float* V, RGB_Colour* out,
+                                       size_t count)
+{
+    unsigned char red[ConversionBlockSize];
+    unsigned char green[ConversionBlockSize];
+    unsigned char blue[ConversionBlockSize];
+
+    for (size_t start = 0; start < count; start += ConversionBlockSize)
+    {
+        const size_t block = std::min(ConversionBlockSize, count - start);
+
+        for (size_t i = 0; i < block; ++i)
+        {
+            // the channels use the hue offset by 5, 3 and 1 sectors.
+            const float h = H[start + i] * 6.0f;
+            const float chroma = V[start + i] * S[start + i];
+
+            const float kr = h + 5.0f - blend(h + 5.0f >= 6.0f, 6.0f, 0.0f);
+            const float kg = h + 3.0f - blend(h + 3.0f >= 6.0f, 6.0f, 0.0f);
+            const float kb = h + 1.0f - blend(h + 1.0f >= 6.0f, 6.0f, 0.0f);
+
+            red[i] = toByte(V[start + i] - chroma * hueWeight(kr));
+            green[i] = toByte(V[start + i] - chroma * hueWeight(kg));
+            blue[i] = toByte(V[start + i] - chroma * hueWeight(kb));
+        }
+
+        storeRGB(red, green, blue, out + start, block);
+    }
+}
+
 //----------------------------------------------------------------------------//
 RGB_Colour ColourPickerConversions::toRGB(const CEGUI::Colour& colour)
 {
@@ -34,12 +34,8 @@ CompositeResourceProvider::CompositeResourceProvider() : CEGUI::ResourceProvider
 
 CompositeResourceProvider::~CompositeResourceProvider(void)
 {
-  ProviderIterator it=getIterator();
-  for(it.toStart(); !it.isAtEnd(); ++it)
-  {
-    delete it.getCurrentValue();
-    d_providerlist.erase (it.getCurrentKey());
-  }
+  for (Providermap::iterator it = d_providerlist.begin(); it != d_providerlist.end(); ++it)
+    delete it->second;
 }
 
 void CompositeResourceProvider::add(ResourceProvider *prov,const String& name)
@@ -49,22 +45,61 @@ void CompositeResourceProvider::add(ResourceProvider *prov,const String& name)
 
 void CompositeResourceProvider::remove(ResourceProvider *prov)
 {   
-  ProviderIterator it=getIterator();
-  for(it.toStart(); !it.isAtEnd(); ++it)
+  for (Providermap::iterator it = d_providerlist.begin(); it != d_providerlist.end();)
   {
-    if(it.getCurrentValue() == prov)
-      d_providerlist.erase (it.getCurrentKey());
+    if (it->second == prov)
+      it = d_providerlist.erase(it);
+    else
+      ++it;
   }
+  d_fileIndices.erase(prov);
 }
 
 void CompositeResourceProvider::remove(const String& name)
 {
-  d_providerlist.erase(name);
+  Providermap::iterator it = d_providerlist.find(name);
+  if (it == d_providerlist.end())
+    return;
+  d_fileIndices.erase(it->second);
+  d_providerlist.erase(it);
 }
 ResourceProvider* CompositeResourceProvider::get(const String& name)
 {
   return d_providerlist.find(name)->second;
 }
+void CompositeResourceProvider::invalidateFileIndex()
+{
+  d_fileIndices.clear();
+}
+void CompositeResourceProvider::invalidateFileIndex(const String& resourceGroup)
+{
+  for (auto& fileIndex : d_fileIndices)
+    fileIndex.second.erase(resourceGroup);
+}
+const std::unordered_set<String>& CompositeResourceProvider::getFileIndex(
+    ResourceProvider& prov, const String& resourceGroup)
+{
+  FileIndexMap& groups = d_fileIndices[&prov];
+  FileIndexMap::iterator it = groups.find(resourceGroup);
+  if (it == groups.end())
+  {
+    std::vector<String> names;
+    prov.getResourceGroupFileNames(names, "*", resourceGroup);
+    it = groups.emplace(resourceGroup,
+      std::unordered_set<String>(names.begin(), names.end())).first;
+  }
+  return it->second;
+}
+ResourceProvider* CompositeResourceProvider::findProvider(const String& filename,
+                                                          const String& resourceGroup)
+{
+  for (Providermap::iterator it = d_providerlist.begin(); it != d_providerlist.end(); ++it)
+  {
+    if (getFileIndex(*it->second, resourceGroup).count(filename))
+      return it->second;
+  }
+  return nullptr;
+}
 void CompositeResourceProvider::loadRawDataContainer(const String& filename,
                          RawDataContainer& output,
                          const String& resourceGroup)
@@ -72,21 +107,16 @@ void CompositeResourceProvider::loadRawDataContainer(const String& filename,
   if (filename.empty())
     throw InvalidRequestException(
       "Filename supplied for data loading must be valid");
-  ProviderIterator it=getIterator();
-  for(it.toStart(); !it.isAtEnd(); ++it)
+  ResourceProvider* prov = findProvider(filename, resourceGroup);
+  // the file may have been added since the group was indexed.
+  if (!prov)
   {
-    std::vector<String> out_vec;
-    it.getCurrentValue()->getResourceGroupFileNames(out_vec,filename,resourceGroup);
-    for (std::vector<String>::const_iterator vit = out_vec.begin(); vit != out_vec.end(); ++vit)
-    {
-      if(*vit == filename)
-      {
-        it.getCurrentValue()->loadRawDataContainer(filename,output,resourceGroup);
-        return;
-      }
-    }   
+    invalidateFileIndex(resourceGroup);
+    prov = findProvider(filename, resourceGroup);
   }
-  throw InvalidRequestException(filename + " does not exist");
+  if (!prov)
+    throw InvalidRequestException(filename + " does not exist");
+  prov->loadRawDataContainer(filename,output,resourceGroup);
 }
 
 size_t CompositeResourceProvider::getResourceGroupFileNames(std::vector<String>& out_vec,
@@ -0,0 +1,426 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Implements a signed distance field glyph atlas shared by font sizes
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/DistanceFieldGlyphAtlas.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/PropertyHelper.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+//! Squared distance used for pixels that have no nearest pixel yet.
+const float s_infinity = 1e20f;
+
+/*!
+    Squared euclidean distance transform of \a count values starting at
+    \a values, \a stride apart, as described by Felzenszwalb and Huttenlocher
+    in "Distance Transforms of Sampled Functions". The scratch buffers have to
+    hold count + 1 values.
+*/
+void distanceTransform1D(float* values, int count, int stride,
+                         float* f, int* v, float* z)
+{
+    for (int q = 0; q < count; ++q)
+        f[q] = values[q * stride];
+
+    int k = 0;
+    v[0] = 0;
+    z[0] = -s_infinity;
+    z[1] = s_infinity;
+
+    for (int q = 1; q < count; ++q)
+    {
+        float s;
+        for (;;)
+        {
+            const int r = v[k];
+            s = ((f[q] + static_cast<float>(q * q)) -
+                 (f[r] + static_cast<float>(r * r))) / static_cast<float>(2 * (q - r));
+
+            if (s > z[k] || k == 0)
+                break;
+
+            --k;
+        }
+
+        ++k;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = s_infinity;
+    }
+
+    k = 0;
+    for (int q = 0; q < count; ++q)
+    {
+        while (z[k + 1] < static_cast<float>(q))
+            ++k;
+
+        const float delta = static_cast<float>(q - v[k]);
+        values[q * stride] = delta * delta + f[v[k]];
+    }
+}
+
+//! Squared euclidean distance transform of a width * height grid.
+void distanceTransform2D(std::vector<float>& grid, int width, int height)
+{
+    const size_t scratchSize = static_cast<size_t>(std::max(width, height)) + 1;
+    std::vector<float> f(scratchSize);
+    std::vector<int> v(scratchSize);
+    std::vector<float> z(scratchSize + 1);
+
+    for (int x = 0; x < width; ++x)
+        distanceTransform1D(grid.data() + x, height, width, f.data(), v.data(), z.data());
+
+    for (int y = 0; y < height; ++y)
+        distanceTransform1D(grid.data() + y * width, width, 1, f.data(), v.data(), z.data());
+}
+
+//! Registry of the atlases, by resource group and file name.
+std::unordered_map<CEGUI::String, CEGUI::DistanceFieldGlyphAtlas*> s_atlases;
+}
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const unsigned int DistanceFieldGlyphAtlas::BaseSize(48);
+const unsigned int DistanceFieldGlyphAtlas::Spread(6);
+const unsigned int DistanceFieldGlyphAtlas::PageSize(512);
+// Pixels to put between glyphs
+static const int s_glyphPadding = 1;
+
+//----------------------------------------------------------------------------//
+DistanceFieldGlyphAtlas* DistanceFieldGlyphAtlas::acquire(
+    const String& filename, const String& resource_group)
+{
+    const String key(resource_group + "/" + filename);
+
+    auto it = s_atlases.find(key);
+    if (it == s_atlases.end())
+    {
+        DistanceFieldGlyphAtlas* atlas =
+            new DistanceFieldGlyphAtlas(filename, resource_group);
+
+        // bitmap fonts only have glyphs for their fixed sizes
+        if (!(atlas->d_face->face_flags & FT_FACE_FLAG_SCALABLE))
+        {
+            delete atlas;
+            return nullptr;
+        }
+
+        it = s_atlases.emplace(key, atlas).first;
+    }
+
+    ++it->second->d_refCount;
+    return it->second;
+}
+
+//----------------------------------------------------------------------------//
+void DistanceFieldGlyphAtlas::release(DistanceFieldGlyphAtlas& atlas)
+{
+    if (--atlas.d_refCount != 0)
+        return;
+
+    s_atlases.erase(atlas.d_key);
+    delete &atlas;
+}
+
+//----------------------------------------------------------------------------//
+size_t DistanceFieldGlyphAtlas::getAtlasCount()
+{
+    return s_atlases.size();
+}
+
+//----------------------------------------------------------------------------//
+DistanceFieldGlyphAtlas::DistanceFieldGlyphAtlas(const String& filename,
+                                                 const String& resource_group) :
+    d_key(resource_group + "/" + filename),
+    d_refCount(0),
+    d_library(nullptr),
+    d_face(nullptr),
+    d_shelfX(0),
+    d_shelfY(0),
+    d_shelfHeight(0),
+    d_uploadMinX(0),
+    d_uploadMinY(0),
+    d_uploadMaxX(0),
+    d_uploadMaxY(0)
+{
+    if (FT_Init_FreeType(&d_library) != 0)
+        throw GenericException("Failed to initialise FreeType for the "
+            "distance field glyph atlas of '" + filename + "'");
+
+    System::getSingleton().getResourceProvider()->loadRawDataContainer(
+        filename, d_fontData, resource_group);
+
+    if (FT_New_Memory_Face(d_library, d_fontData.getDataPtr(),
+            static_cast<FT_Long>(d_fontData.getSize()), 0, &d_face) != 0 ||
+        ((d_face->face_flags & FT_FACE_FLAG_SCALABLE) &&
+         FT_Set_Pixel_Sizes(d_face, 0, BaseSize) != 0))
+    {
+        if (d_face)
+            FT_Done_Face(d_face);
+        FT_Done_FreeType(d_library);
+        System::getSingleton().getResourceProvider()->unloadRawDataContainer(d_fontData);
+
+        throw GenericException("Failed to create the FreeType face for the "
+            "distance field glyph atlas of '" + filename + "'");
+    }
+}
+
+//----------------------------------------------------------------------------//
+DistanceFieldGlyphAtlas::~DistanceFieldGlyphAtlas()
+{
+    for (Texture* texture : d_textures)
+        System::getSingleton().getRenderer()->destroyTexture(*texture);
+
+    FT_Done_Face(d_face);
+    FT_Done_FreeType(d_library);
+    System::getSingleton().getResourceProvider()->unloadRawDataContainer(d_fontData);
+}
+
+//----------------------------------------------------------------------------//
+void DistanceFieldGlyphAtlas::generateDistanceField(const std::uint8_t* coverage,
+    int width, int height, int pitch, int spread, std::vector<std::uint8_t>& field)
+{
+    const int fieldWidth = width + 2 * spread;
+    const int fieldHeight = height + 2 * spread;
+    const size_t fieldSize = static_cast<size_t>(fieldWidth) * fieldHeight;
+
+    // squared distances to the nearest pixel inside and outside the outline
+    std::vector<float> toInside(fieldSize, s_infinity);
+    std::vector<float> toOutside(fieldSize, 0.0f);
+
+    for (int y = 0; y < height; ++y)
+    {
+        const std::uint8_t* row = coverage + y * pitch;
+        const size_t fieldRow = static_cast<size_t>(y + spread) * fieldWidth + spread;
+
+        for (int x = 0; x < width; ++x)
+        {
+            if (row[x] >= 128)
+            {
+                toInside[fieldRow + x] = 0.0f;
+                toOutside[fieldRow + x] = s_infinity;
+            }
+        }
+    }
+
+    distanceTransform2D(toInside, fieldWidth, fieldHeight);
+    distanceTransform2D(toOutside, fieldWidth, fieldHeight);
+
+    field.resize(fieldSize);
+    const float scale = 0.5f / static_cast<float>(spread);
+
+    for (int y = 0; y < fieldHeight; ++y)
+    {
+        for (int x = 0; x < fieldWidth; ++x)
+        {
+            const size_t i = static_cast<size_t>(y) * fieldWidth + x;
+
+            // signed distance from the edge, positive inside. The edge lies
+            // half way between the centres of an inside and an outside pixel.
+            float distance = toOutside[i] > 0.0f ?
+                std::sqrt(toOutside[i]) - 0.5f :
+                0.5f - std::sqrt(toInside[i]);
+
+            // the coverage of pixels on the edge tells where in them it lies
+            const int cx = x - spread;
+            const int cy = y - spread;
+            if (cx >= 0 && cx < width && cy >= 0 && cy < height)
+            {
+                const std::uint8_t c = coverage[cy * pitch + cx];
+                if (c > 0 && c < 255)
+                    distance = c / 255.0f - 0.5f;
+            }
+
+            const float value = std::min(std::max(0.5f + distance * scale, 0.0f), 1.0f);
+            field[i] = static_cast<std::uint8_t>(std::lround(value * 255.0f));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+const DistanceFieldGlyphAtlas::Glyph* DistanceFieldGlyphAtlas::getGlyph(
+    char32_t code_point)
+{
+    GlyphMap::const_iterator it = d_glyphs.find(code_point);
+    if (it != d_glyphs.end())
+        return &it->second;
+
+    if (FT_Get_Char_Index(d_face, code_point) == 0)
+        return nullptr;
+
+    Glyph& glyph = d_glyphs[code_point];
+    generateGlyph(code_point, glyph);
+    return &glyph;
+}
+
+//----------------------------------------------------------------------------//
+void DistanceFieldGlyphAtlas::generateGlyph(char32_t code_point, Glyph& glyph)
+{
+    // hinting is for one size only, the field is used for all of them
+    if (FT_Load_Char(d_face, code_point,
+            FT_LOAD_RENDER | FT_LOAD_NO_HINTING | FT_LOAD_TARGET_NORMAL) != 0)
+    {
+        return;
+    }
+
+    const FT_GlyphSlot slot = d_face->glyph;
+    glyph.d_advance = slot->linearHoriAdvance / 65536.0f;
+
+    const FT_Bitmap& bitmap = slot->bitmap;
+    if (bitmap.width == 0 || bitmap.rows == 0 ||
+        bitmap.pixel_mode != FT_PIXEL_MODE_GRAY)
+    {
+        return;
+    }
+
+    const int spread = static_cast<int>(Spread);
+    std::vector<std::uint8_t> field;
+    generateDistanceField(bitmap.buffer, static_cast<int>(bitmap.width),
+        static_cast<int>(bitmap.rows), bitmap.pitch, spread, field);
+
+    const int width = static_cast<int>(bitmap.width) + 2 * spread;
+    const int height = static_cast<int>(bitmap.rows) + 2 * spread;
+    int posX;
+    int posY;
+    allocate(width, height, posX, posY);
+
+    for (int y = 0; y < height; ++y)
+    {
+        argb_t* row = d_pageBuffer.data() + (posY + y) * PageSize + posX;
+        const std::uint8_t* src = field.data() + y * width;
+
+        for (int x = 0; x < width; ++x)
+            row[x] = Colour::calculateArgb(src[x], 0xFF, 0xFF, 0xFF);
+    }
+
+    if (d_uploadMaxX <= d_uploadMinX)
+    {
+        d_uploadMinX = posX;
+        d_uploadMinY = posY;
+        d_uploadMaxX = posX + width;
+        d_uploadMaxY = posY + height;
+    }
+    else
+    {
+        d_uploadMinX = std::min(d_uploadMinX, posX);
+        d_uploadMinY = std::min(d_uploadMinY, posY);
+        d_uploadMaxX = std::max(d_uploadMaxX, posX + width);
+        d_uploadMaxY = std::max(d_uploadMaxY, posY + height);
+    }
+
+    glyph.d_texture = d_textures.back();
+    glyph.d_area = Rectf(glm::vec2(posX, posY), Sizef(static_cast<float>(width),
+                                               static_cast<float>(height)));
+    glyph.d_offset = glm::vec2(slot->bitmap_left - spread,
+                               -slot->bitmap_top - spread);
+}
+
+//----------------------------------------------------------------------------//
+void DistanceFieldGlyphAtlas::allocate(int width, int height, int& x, int& y)
+{
+    const int pageSize = static_cast<int>(PageSize);
+
+    if (width > pageSize || height > pageSize)
+        throw InvalidRequestException("A glyph of '" + d_key + "' is too large "
+            "for the distance field glyph atlas.");
+
+    if (d_textures.empty())
+        createTexture();
+
+    if (d_shelfX + width > pageSize)
+    {
+        d_shelfX = 0;
+        d_shelfY += d_shelfHeight;
+        d_shelfHeight = 0;
+    }
+
+    if (d_shelfY + height > pageSize)
+        createTexture();
+
+    x = d_shelfX;
+    y = d_shelfY;
+    d_shelfX += width + s_glyphPadding;
+    d_shelfHeight = std::max(d_shelfHeight, height + s_glyphPadding);
+}
+
+//----------------------------------------------------------------------------//
+void DistanceFieldGlyphAtlas::createTexture()
+{
+    // glyphs not yet uploaded belong to the texture that is full now
+    flushUpload();
+
+    const String name("DistanceFieldGlyphAtlas/" + d_key + "/" +
+        PropertyHelper<std::uint32_t>::toString(
+            static_cast<std::uint32_t>(d_textures.size())));
+
+    const Sizef size(static_cast<float>(PageSize), static_cast<float>(PageSize));
+    Texture& texture = System::getSingleton().getRenderer()->createTexture(name, size);
+    d_textures.push_back(&texture);
+
+    // the padding between glyphs is sampled too, so it has to be defined
+    d_pageBuffer.assign(PageSize * PageSize, 0x00FFFFFF);
+    texture.loadFromMemory(d_pageBuffer.data(), size, Texture::PixelFormat::Rgba);
+
+    d_shelfX = d_shelfY = d_shelfHeight = 0;
+}
+
+//----------------------------------------------------------------------------//
+void DistanceFieldGlyphAtlas::flushUpload()
+{
+    if (d_uploadMaxX <= d_uploadMinX || d_uploadMaxY <= d_uploadMinY)
+        return;
+
+    const int width = d_uploadMaxX - d_uploadMinX;
+    const int height = d_uploadMaxY - d_uploadMinY;
+
+    std::vector<argb_t> areaData(width * height);
+    for (int y = 0; y < height; ++y)
+    {
+        const argb_t* row = d_pageBuffer.data() +
+            (d_uploadMinY + y) * PageSize + d_uploadMinX;
+        std::copy(row, row + width, areaData.data() + y * width);
+    }
+
+    const Rectf area(glm::vec2(d_uploadMinX, d_uploadMinY),
+        Sizef(static_cast<float>(width), static_cast<float>(height)));
+    d_textures.back()->blitFromMemory(areaData.data(), area);
+
+    d_uploadMinX = d_uploadMinY = d_uploadMaxX = d_uploadMaxY = 0;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -219,13 +219,6 @@ void Element::setPixelAligned(const bool setting)
 //----------------------------------------------------------------------------//
 Sizef Element::calculatePixelSize(bool skipAllPixelAlignment) const
 {
-    // calculate pixel sizes for everything, so we have a common format for
-    // comparisons.
-    Sizef absMin(CoordConverter::asAbsolute(d_minSize,
-        getRootContainerSize(), false));
-    Sizef absMax(CoordConverter::asAbsolute(d_maxSize,
-        getRootContainerSize(), false));
-
     Sizef base_size;
     if (skipAllPixelAlignment)
     {
@@ -240,7 +233,21 @@ Sizef Element::calculatePixelSize(bool skipAllPixelAlignment) const
                            getParentPixelSize());
     }
 
-    Sizef ret = CoordConverter::asAbsolute(getSize(), base_size, false);
+    return constrainPixelSize(
+        CoordConverter::asAbsolute(getSize(), base_size, false));
+}
+
+//----------------------------------------------------------------------------//
+Sizef Element::constrainPixelSize(const Sizef& size) const
+{
+    // calculate pixel sizes for everything, so we have a common format for
+    // comparisons.
+    Sizef absMin(CoordConverter::asAbsolute(d_minSize,
+        getRootContainerSize(), false));
+    Sizef absMax(CoordConverter::asAbsolute(d_maxSize,
+        getRootContainerSize(), false));
+
+    Sizef ret(size);
 
     // in case absMin components are larger than absMax ones,
     // max size takes precedence
@@ -423,11 +430,25 @@ UDim Element::getElementHeightLowerBoundAsFuncOfHeightOfAreaReservedForContent()
     return UDim(1.f /inverse.d_scale, -inverse.d_offset /inverse.d_scale);
 }
 
+//----------------------------------------------------------------------------//
+USize Element::getSizeAdjustedToContent() const
+{
+    return getSizeAdjustedToContent_direct();
+}
+
 //----------------------------------------------------------------------------//
 void Element::adjustSizeToContent_direct()
 {
     if (!isSizeAdjustedToContent())
         return;
+    setSize(getSizeAdjustedToContent_direct(), false);
+}
+
+//----------------------------------------------------------------------------//
+USize Element::getSizeAdjustedToContent_direct() const
+{
+    if (!isSizeAdjustedToContent())
+        return getSize();
     const float epsilon = adjustSizeToContent_getEpsilon();
     USize size_func(UDim(-1.f, -1.f), UDim(-1.f, -1.f));
     Sizef new_pixel_size(getPixelSize());
@@ -463,7 +484,7 @@ void Element::adjustSizeToContent_direct()
         new_size.d_width = UDim(0.f, new_pixel_size.d_width);
     if (isHeightAdjustedToContent()  ||  (getAspectMode() != AspectMode::Ignore))
         new_size.d_height = UDim(0.f, new_pixel_size.d_height);
-    setSize(new_size, false);
+    return new_size;
 }
 
 //----------------------------------------------------------------------------//
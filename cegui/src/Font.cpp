@@ -40,6 +40,7 @@ namespace CEGUI
 //----------------------------------------------------------------------------//
 const argb_t Font::DefaultColour = 0xFFFFFFFF;
 String Font::d_defaultResourceGroup;
+unsigned int Font::d_glyphGeometryGeneration = 0;
 
 //----------------------------------------------------------------------------//
 const String Font::EventNamespace("Font");
@@ -69,6 +70,8 @@ Font::Font(const String& name, const String& type_name, const String& filename,
 //----------------------------------------------------------------------------//
 Font::~Font()
 {
+    // geometry cached for this font refers to its glyph textures
+    ++d_glyphGeometryGeneration;
 }
 
 float Font::convertPointsToPixels(const float pointSize, const int dotsPerInch)
@@ -122,7 +125,8 @@ void Font::addFontProperties()
     );
 }
 
-float Font::getTextExtent(const String& text) const
+float Font::getTextExtent(const String& text,
+    DefaultParagraphDirection /*defaultParagraphDir*/) const
 {
     float cur_extent = 0.0f;
     float adv_extent = 0.0f;
@@ -172,7 +176,8 @@ void Font::getGlyphExtents(
 }
 
 //----------------------------------------------------------------------------//
-float Font::getTextAdvance(const String& text) const
+float Font::getTextAdvance(const String& text,
+    DefaultParagraphDirection /*defaultParagraphDir*/) const
 {
     float advance = 0.0f;
 
@@ -397,6 +402,11 @@ void Font::notifyDisplaySizeChanged(const Sizef& size)
     }
 }
 
+//----------------------------------------------------------------------------//
+void Font::processPendingGlyphs()
+{
+}
+
 //----------------------------------------------------------------------------//
 void Font::writeXMLToStream(XMLSerializer& xml_stream) const
 {
@@ -430,6 +440,8 @@ void Font::writeXMLToStream(XMLSerializer& xml_stream) const
 //----------------------------------------------------------------------------//
 void Font::onRenderSizeChanged(FontEventArgs& e)
 {
+    ++d_glyphGeometryGeneration;
+
     fireEvent(EventRenderSizeChanged, e, EventNamespace);
 }
 
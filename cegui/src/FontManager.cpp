@@ -206,6 +206,15 @@ void FontManager::notifyDisplaySizeChanged(const Sizef& size)
     for (; pos != end; ++pos)
         pos->second->notifyDisplaySizeChanged(size);
 }
+
+//----------------------------------------------------------------------------//
+void FontManager::processPendingGlyphs()
+{
+    for (FontRegistry::iterator pos = d_registeredFonts.begin();
+         pos != d_registeredFonts.end(); ++pos)
+        pos->second->processPendingGlyphs();
+}
+
 void FontManager::writeFontToStream(const String& name,
                                     OutStream& out_stream) const
 {
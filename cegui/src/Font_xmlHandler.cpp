@@ -53,6 +53,7 @@ const String Font_xmlHandler::FontSchemaName("Font.xsd");
 const String Font_xmlHandler::FontElement("Font");
 const String Font_xmlHandler::FontsElement("Fonts");
 const String Font_xmlHandler::MappingElement("Mapping");
+const String Font_xmlHandler::FallbackElement("Fallback");
 const String Font_xmlHandler::FontTypeAttribute("type");
 const String Font_xmlHandler::FontNameAttribute("name");
 const String Font_xmlHandler::FontFilenameAttribute("filename");
@@ -139,6 +140,9 @@ void Font_xmlHandler::elementStart(const String& element,
     // handle a Mapping element
     else if (element == MappingElement)
         elementMappingStart(attributes);
+    // handle a Fallback element
+    else if (element == FallbackElement)
+        elementFallbackStart(attributes);
     // anything else is a non-fatal error.
     else
         Logger::getSingleton().logEvent("Font_xmlHandler::elementStart: "
@@ -242,6 +246,26 @@ void Font_xmlHandler::elementMappingStart(const XMLAttributes& attributes)
             attributes.getValueAsFloat(MappingHorzAdvanceAttribute, -1.0f));
 }
 
+//----------------------------------------------------------------------------//
+void Font_xmlHandler::elementFallbackStart(const XMLAttributes& attributes)
+{
+    if (!d_font)
+        throw InvalidRequestException(
+            "Attempt to access null object.");
+
+    // double-check font type just in case - report issues as 'soft' errors
+    if (d_font->getTypeName() != FontTypeFreeType)
+        Logger::getSingleton().logEvent(
+            "Font_xmlHandler::elementFallbackStart: <Fallback> element is "
+            "only valid for FreeType type fonts.", LoggingLevel::Error);
+#ifdef CEGUI_HAS_FREETYPE
+    else
+        static_cast<FreeTypeFont*>(d_font)->addFallbackFont(
+            attributes.getValueAsString(FontFilenameAttribute),
+            attributes.getValueAsString(FontResourceGroupAttribute));
+#endif
+}
+
 //----------------------------------------------------------------------------//
 void Font_xmlHandler::createFreeTypeFont(const XMLAttributes& attributes)
 {
@@ -36,12 +36,23 @@
 #include "CEGUI/Font_xmlHandler.h"
 #include "CEGUI/SharedStringStream.h"
 #include "CEGUI/FreeTypeFontGlyph.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/Window.h"
 
 #ifdef CEGUI_USE_RAQM
 #include <raqm.h>
 #endif
 
+#include FT_ADVANCES_H
+
+#include <algorithm>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 namespace
 {
@@ -60,6 +71,12 @@ void adjustPenPositionForBearingDeltas(glm::vec2& penPosition,
         penPosition.x += 1.0f;
     }
 }
+
+bool isSupportedPixelMode(const FT_Bitmap& bitmap)
+{
+    return bitmap.pixel_mode == FT_PIXEL_MODE_GRAY ||
+           bitmap.pixel_mode == FT_PIXEL_MODE_MONO;
+}
 }
 
 
@@ -94,6 +111,260 @@ static const FreeTypeErrorDescription ftErrorDescs[] =
 static const std::vector<FreeTypeErrorDescription> freeTypeErrorDescriptions
     (ftErrorDescs, ftErrorDescs + sizeof(ftErrorDescs) / sizeof(FreeTypeErrorDescription) );
 
+//----------------------------------------------------------------------------//
+namespace
+{
+//! A fallback font and the number of FreeTypeFonts using it.
+struct SharedFallbackFont
+{
+    FreeTypeFont* d_font;
+    unsigned int d_refCount;
+};
+
+//! Fallback fonts by resource group, file name, pixel size and settings.
+std::unordered_map<String, SharedFallbackFont> s_fallbackFonts;
+
+/*!
+    Image of a glyph of a DistanceFieldGlyphAtlas, scaled from the atlas' base
+    size to the size of the font and rendered with the distance field shader.
+*/
+class DistanceFieldGlyphImage : public BitmapImage
+{
+public:
+    DistanceFieldGlyphImage(const String& name, Texture* texture,
+                            const Rectf& area, const glm::vec2& offset,
+                            float scale, const Sizef& native_res) :
+        BitmapImage(name, texture, area, offset, AutoScaledMode::Disabled,
+                    native_res)
+    {
+        d_scaledSize = area.getSize() * scale;
+        d_scaledOffset = offset * scale;
+    }
+
+    std::vector<GeometryBuffer*> createRenderGeometry(
+        const ImageRenderSettings& render_settings) const override
+    {
+        Rectf texRect;
+        Rectf finalRect;
+        if (!calculateAreas(render_settings.d_destArea,
+                            render_settings.d_clipArea, finalRect, texRect))
+        {
+            return std::vector<GeometryBuffer*>();
+        }
+
+        TexturedColouredVertex vbuffer[6];
+        createTexturedQuadVertices(vbuffer, render_settings.d_multiplyColours,
+                                   finalRect, texRect);
+
+        Renderer& renderer = *System::getSingleton().getRenderer();
+        GeometryBuffer& buffer = renderer.createGeometryBufferTextured(
+            renderer.createRenderMaterial(DefaultShaderType::DistanceField));
+
+        buffer.setClippingActive(render_settings.d_clippingEnabled);
+        if (render_settings.d_clippingEnabled)
+            buffer.setClippingRegion(*render_settings.d_clipArea);
+        buffer.setTexture("texture0", d_texture);
+        buffer.appendQuad(vbuffer);
+        buffer.setAlpha(render_settings.d_alpha);
+
+        return std::vector<GeometryBuffer*>(1, &buffer);
+    }
+
+    void addToRenderGeometry(GeometryBuffer& geomBuffer,
+        const Rectf& renderArea, const Rectf* clipArea,
+        const ColourRect& colours) const override
+    {
+        Rectf texRect;
+        Rectf finalRect;
+        if (!calculateAreas(renderArea, clipArea, finalRect, texRect))
+            return;
+
+        TexturedColouredVertex vbuffer[6];
+        createTexturedQuadVertices(vbuffer, colours, finalRect, texRect);
+        geomBuffer.appendQuad(vbuffer);
+    }
+
+private:
+    /*!
+        Like calculateTextureAreaAndRenderArea, but without aligning the
+        render area to pixels: distance fields are sampled smoothly at any
+        position, and aligning would change the size of small glyphs.
+        Returns false if the area is clipped entirely.
+    */
+    bool calculateAreas(const Rectf& destArea, const Rectf* clipArea,
+                        Rectf& finalRect, Rectf& texRect) const
+    {
+        Rectf dest(destArea);
+        dest.offset(d_scaledOffset);
+
+        finalRect = clipArea ? dest.getIntersection(*clipArea) : dest;
+        if (finalRect.getWidth() == 0 || finalRect.getHeight() == 0)
+            return false;
+
+        const glm::vec2& texelScale = d_texture->getTexelScaling();
+        const glm::vec2 texPerPix(d_imageArea.getWidth() / dest.getWidth(),
+                                  d_imageArea.getHeight() / dest.getHeight());
+        texRect = Rectf((d_imageArea + ((finalRect - dest) * texPerPix)) * texelScale);
+
+        return true;
+    }
+};
+}
+
+//----------------------------------------------------------------------------//
+struct FreeTypeFont::AsyncRasteriser
+{
+    AsyncRasteriser(const RawDataContainer& fontData, FT_UInt pixelHeight,
+                    bool antiAliased);
+    ~AsyncRasteriser();
+
+    void queue(char32_t codePoint);
+    void takeFinished(std::vector<GlyphBitmap>& finished);
+    size_t getPendingCount() const;
+    void waitUntilIdle();
+    //! Stops the worker thread after the glyph it is currently rasterising.
+    void stop();
+    void run();
+
+    //! FreeType library and face used by the worker thread only.
+    FT_Library d_library;
+    FT_Face d_face;
+    const bool d_antiAliased;
+
+    mutable std::mutex d_mutex;
+    //! Signalled when code points are queued or the worker has to stop.
+    std::condition_variable d_workAvailable;
+    //! Signalled when the worker has finished a glyph.
+    std::condition_variable d_glyphFinished;
+    std::deque<char32_t> d_queue;
+    std::vector<GlyphBitmap> d_finished;
+    //! Number of glyphs taken from the queue but not finished yet.
+    size_t d_inProgress;
+    bool d_stop;
+    std::thread d_thread;
+};
+
+//----------------------------------------------------------------------------//
+FreeTypeFont::AsyncRasteriser::AsyncRasteriser(const RawDataContainer& fontData,
+                                               FT_UInt pixelHeight,
+                                               bool antiAliased) :
+    d_library(nullptr),
+    d_face(nullptr),
+    d_antiAliased(antiAliased),
+    d_inProgress(0),
+    d_stop(false)
+{
+    // FreeType faces may not be used by several threads at once, so the
+    // worker gets a library and face of its own on the same font data.
+    if (FT_Init_FreeType(&d_library) != 0)
+        throw GenericException("Failed to initialise FreeType for "
+            "background glyph rasterisation");
+
+    if (FT_New_Memory_Face(d_library, fontData.getDataPtr(),
+            static_cast<FT_Long>(fontData.getSize()), 0, &d_face) != 0 ||
+        FT_Set_Pixel_Sizes(d_face, 0, pixelHeight) != 0)
+    {
+        if (d_face)
+            FT_Done_Face(d_face);
+        FT_Done_FreeType(d_library);
+
+        throw GenericException("Failed to create the FreeType face for "
+            "background glyph rasterisation");
+    }
+
+    d_thread = std::thread(&AsyncRasteriser::run, this);
+}
+
+//----------------------------------------------------------------------------//
+FreeTypeFont::AsyncRasteriser::~AsyncRasteriser()
+{
+    stop();
+
+    FT_Done_Face(d_face);
+    FT_Done_FreeType(d_library);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::AsyncRasteriser::queue(char32_t codePoint)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_queue.push_back(codePoint);
+    }
+
+    d_workAvailable.notify_one();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::AsyncRasteriser::takeFinished(std::vector<GlyphBitmap>& finished)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    finished.swap(d_finished);
+}
+
+//----------------------------------------------------------------------------//
+size_t FreeTypeFont::AsyncRasteriser::getPendingCount() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_queue.size() + d_inProgress + d_finished.size();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::AsyncRasteriser::waitUntilIdle()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_glyphFinished.wait(lock, [this]
+        { return d_stop || (d_queue.empty() && d_inProgress == 0); });
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::AsyncRasteriser::stop()
+{
+    if (!d_thread.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stop = true;
+    }
+
+    d_workAvailable.notify_one();
+    d_thread.join();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::AsyncRasteriser::run()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+
+    for (;;)
+    {
+        d_workAvailable.wait(lock, [this] { return d_stop || !d_queue.empty(); });
+
+        if (d_stop)
+            return;
+
+        GlyphBitmap bitmap;
+        bitmap.d_codePoint = d_queue.front();
+        d_queue.pop_front();
+        ++d_inProgress;
+        lock.unlock();
+
+        // glyphs in pixel modes we can not convert count as failing to load;
+        // the exception the render thread would get can not be thrown here.
+        if (loadGlyph(d_face, bitmap.d_codePoint, d_antiAliased) == 0 &&
+            isSupportedPixelMode(d_face->glyph->bitmap))
+        {
+            readGlyphBitmap(d_face, bitmap);
+        }
+
+        lock.lock();
+        d_finished.push_back(std::move(bitmap));
+        --d_inProgress;
+        d_glyphFinished.notify_all();
+    }
+}
+
 //----------------------------------------------------------------------------//
 FreeTypeFont::FreeTypeFont(
     const String& font_name,
@@ -153,6 +424,19 @@ void FreeTypeFont::addFreeTypeFontProperties()
         "Value is either true or false.",
         &FreeTypeFont::setAntiAliased, &FreeTypeFont::isAntiAliased, false
     );
+
+    CEGUI_DEFINE_PROPERTY(FreeTypeFont, bool,
+        "AsyncRasterisation", "This is a flag indicating whether glyphs are rasterised "
+        "on a background thread. Value is either true or false.",
+        &FreeTypeFont::setUseAsyncRasterisation, &FreeTypeFont::getUsesAsyncRasterisation, false
+    );
+
+    CEGUI_DEFINE_PROPERTY(FreeTypeFont, bool,
+        "DistanceField", "This is a flag indicating whether glyphs are rendered from "
+        "signed distance fields shared by all sizes of the font file. "
+        "Value is either true or false.",
+        &FreeTypeFont::setUseDistanceField, &FreeTypeFont::getUsesDistanceField, false
+    );
 }
 
 void FreeTypeFont::resizeAndUpdateTexture(Texture* texture, int newSize) const
@@ -180,8 +464,14 @@ void FreeTypeFont::resizeAndUpdateTexture(Texture* texture, int newSize) const
     //TODO: why always RGBA if we, and Freetype, only support greyscale?
     texture->loadFromMemory(d_lastTextureBuffer.data(), newTextureSize, Texture::PixelFormat::Rgba);
 
+    // the whole buffer was just uploaded
+    d_uploadMinX = d_uploadMinY = d_uploadMaxX = d_uploadMaxY = 0;
+
     System::getSingleton().getRenderer()->updateGeometryBufferTexCoords(texture,
         oldTextureSize / static_cast<float>(newSize));
+
+    // cached text geometry has the old texture coordinates
+    ++d_glyphGeometryGeneration;
 }
 
 void FreeTypeFont::createTextureSpaceForGlyphRasterisation(Texture* texture, int glyphWidth, int glyphHeight) const
@@ -207,23 +497,39 @@ void FreeTypeFont::createTextureSpaceForGlyphRasterisation(Texture* texture, int
 }
 
 void FreeTypeFont::addRasterisedGlyphToTextureAndSetupGlyphImage(
-    FreeTypeFontGlyph* glyph, Texture* texture, int glyphWidth, int glyphHeight,
+    FreeTypeFontGlyph* glyph, Texture* texture, const GlyphBitmap& bitmap,
     const TextureGlyphLine& glyphTexLine) const
 {
-    // Create the data containing the pixels of the glyph
-    FT_Bitmap& glyphBitmap = d_fontFace->glyph->bitmap;
-    std::vector<argb_t> subTextureData = createGlyphTextureData(glyphBitmap);
+    const int glyphWidth = bitmap.d_width;
+    const int glyphHeight = bitmap.d_height;
 
     // Update the cached texture data in memory
     size_t bufferDataGlyphPos = (glyphTexLine.d_lastYPos * d_lastTextureSize) + glyphTexLine.d_lastXPos;
     updateTextureBufferSubImage(d_lastTextureBuffer.data() + bufferDataGlyphPos,
-        glyphWidth, glyphHeight, subTextureData);
+        glyphWidth, glyphHeight, bitmap.d_pixels);
+
+    // The texture on the GPU is updated by flushGlyphAtlasUpload, so that
+    // glyphs rasterised together are uploaded together
+    if (glyphWidth > 0 && glyphHeight > 0)
+    {
+        const int maxX = glyphTexLine.d_lastXPos + glyphWidth;
+        const int maxY = glyphTexLine.d_lastYPos + glyphHeight;
 
-    // Update the sub-image in the texture on the GPU
-    glm::vec2 subImagePos(glyphTexLine.d_lastXPos, glyphTexLine.d_lastYPos);
-    Sizef subImageSize(static_cast<float>(glyphWidth), static_cast<float>(glyphHeight));
-    Rectf subImageArea(subImagePos, subImageSize);
-    texture->blitFromMemory(subTextureData.data(), subImageArea);
+        if (d_uploadMaxX <= d_uploadMinX)
+        {
+            d_uploadMinX = glyphTexLine.d_lastXPos;
+            d_uploadMinY = glyphTexLine.d_lastYPos;
+            d_uploadMaxX = maxX;
+            d_uploadMaxY = maxY;
+        }
+        else
+        {
+            d_uploadMinX = std::min(d_uploadMinX, glyphTexLine.d_lastXPos);
+            d_uploadMinY = std::min(d_uploadMinY, glyphTexLine.d_lastYPos);
+            d_uploadMaxX = std::max(d_uploadMaxX, maxX);
+            d_uploadMaxY = std::max(d_uploadMaxY, maxY);
+        }
+    }
 
     // Create a new image in the imageset
     const Rectf area(static_cast<float>(glyphTexLine.d_lastXPos),
@@ -231,16 +537,11 @@ void FreeTypeFont::addRasterisedGlyphToTextureAndSetupGlyphImage(
         static_cast<float>(glyphTexLine.d_lastXPos + glyphWidth),
         static_cast<float>(glyphTexLine.d_lastYPos + glyphHeight));
 
-   // This is the right bearing for bitmap glyphs, not d_fontFace->glyph->metrics.horiBearingX
-   const glm::vec2 offset(
-        d_fontFace->glyph->bitmap_left,
-        -d_fontFace->glyph->bitmap_top);
-
     const String name(PropertyHelper<std::uint32_t>::toString(glyph->getCodePoint()));
 
     BitmapImage* img = new BitmapImage(
         name, texture, area,
-        offset, AutoScaledMode::Disabled, d_nativeResolution);
+        bitmap.d_offset, AutoScaledMode::Disabled, d_nativeResolution);
     d_glyphImages.push_back(img);
 
     glyph->setImage(img);
@@ -287,7 +588,7 @@ void FreeTypeFont::findFittingSpotInGlyphTextureLines(
 }
 
 //----------------------------------------------------------------------------//
-void FreeTypeFont::rasterise(FreeTypeFontGlyph* glyph) const
+void FreeTypeFont::rasterise(FreeTypeFontGlyph* glyph, const GlyphBitmap& bitmap) const
 {
     if(d_glyphTextures.empty())
     {
@@ -295,8 +596,8 @@ void FreeTypeFont::rasterise(FreeTypeFontGlyph* glyph) const
     }
 
     // Go ahead, line by line, top-left to bottom-right
-    int glyphWidth = d_fontFace->glyph->bitmap.width;
-    int glyphHeight = d_fontFace->glyph->bitmap.rows;
+    int glyphWidth = bitmap.d_width;
+    int glyphHeight = bitmap.d_height;
 
     bool fittingLineWasFound = false;
     size_t fittingLineIndex = -1;
@@ -314,7 +615,7 @@ void FreeTypeFont::rasterise(FreeTypeFontGlyph* glyph) const
         Texture* texture = d_glyphTextures.back();
         createTextureSpaceForGlyphRasterisation(texture, glyphWidth, glyphHeight);
 
-        rasterise(glyph);
+        rasterise(glyph, bitmap);
         return;
     }
 
@@ -324,7 +625,7 @@ void FreeTypeFont::rasterise(FreeTypeFontGlyph* glyph) const
     Texture* texture = d_glyphTextures.back();
 
     addRasterisedGlyphToTextureAndSetupGlyphImage(glyph, texture,
-        glyphWidth, glyphHeight, glyphTexLine);
+        bitmap, glyphTexLine);
 
     // Advance to next position, add padding
     glyphTexLine.d_lastXPos += glyphWidth + s_glyphPadding;
@@ -354,6 +655,9 @@ bool FreeTypeFont::addNewLineIfFitting(unsigned int glyphHeight, unsigned int gl
 
 void FreeTypeFont::createGlyphAtlasTexture() const
 {
+    // glyphs not yet uploaded belong to the texture that is full now
+    flushGlyphAtlasUpload();
+
     std::uint32_t newTextureIndex = d_glyphTextures.size();
     const String texture_name(d_name + "_auto_glyph_images_texture_" +
         PropertyHelper<std::uint32_t>::toString(newTextureIndex));
@@ -430,12 +734,55 @@ void FreeTypeFont::updateTextureBufferSubImage(argb_t* destTextureData, unsigned
     }
 }
 
+//----------------------------------------------------------------------------//
+void FreeTypeFont::flushGlyphAtlasUpload() const
+{
+    if (d_distanceFieldAtlas)
+        d_distanceFieldAtlas->flushUpload();
+
+    if (d_uploadMaxX <= d_uploadMinX || d_uploadMaxY <= d_uploadMinY)
+        return;
+
+    const int width = d_uploadMaxX - d_uploadMinX;
+    const int height = d_uploadMaxY - d_uploadMinY;
+
+    std::vector<argb_t> areaData(width * height);
+    for (int y = 0; y < height; ++y)
+    {
+        const argb_t* row = d_lastTextureBuffer.data() +
+            (d_uploadMinY + y) * d_lastTextureSize + d_uploadMinX;
+        std::copy(row, row + width, areaData.data() + y * width);
+    }
+
+    const Rectf area(glm::vec2(d_uploadMinX, d_uploadMinY),
+        Sizef(static_cast<float>(width), static_cast<float>(height)));
+    d_glyphTextures.back()->blitFromMemory(areaData.data(), area);
+
+    d_uploadMinX = d_uploadMinY = d_uploadMaxX = d_uploadMaxY = 0;
+}
+
 //----------------------------------------------------------------------------//
 void FreeTypeFont::free()
 {
+#ifdef CEGUI_USE_RAQM
+    d_shapedTextCache.clear();
+#endif
+
+    releaseFallbackFonts(d_fallbackFonts);
+
+    if (d_distanceFieldAtlas)
+    {
+        DistanceFieldGlyphAtlas::release(*d_distanceFieldAtlas);
+        d_distanceFieldAtlas = nullptr;
+    }
+
     if (!d_fontFace)
         return;
 
+    // the worker uses the font data, so it has to stop first
+    delete d_asyncRasteriser;
+    d_asyncRasteriser = nullptr;
+
     for(auto codePointMapEntry : d_codePointToGlyphMap)
     {
         delete codePointMapEntry.second;
@@ -451,6 +798,7 @@ void FreeTypeFont::free()
     for (size_t i = 0; i < d_glyphTextures.size(); i++)
         System::getSingleton().getRenderer()->destroyTexture(*d_glyphTextures[i]);
     d_glyphTextures.clear();
+    d_uploadMinX = d_uploadMinY = d_uploadMaxX = d_uploadMaxY = 0;
 
     FT_Done_Face(d_fontFace);
     d_fontFace = nullptr;
@@ -545,8 +893,38 @@ void FreeTypeFont::tryToCreateFontWithClosestFontHeight(
 //----------------------------------------------------------------------------//
 void FreeTypeFont::updateFont()
 {
+    float fontScaleFactor = System::getSingleton().getRenderer()->getFontScale();
+    if (d_autoScaled != AutoScaledMode::Disabled)
+    {
+        fontScaleFactor *= d_vertScaling;
+    }
+    
+    unsigned int requestedFontSizeInPixels = static_cast<unsigned int>(
+        std::lround(getSizeInPixels() * fontScaleFactor));
+
+    // acquiring the shared fallback fonts and atlas before free() releases
+    // the current ones keeps their glyphs if they stay the same
+    std::vector<FreeTypeFont*> fallbackFonts;
+    try
+    {
+        for (const FallbackFontSource& source : d_fallbackSources)
+            fallbackFonts.push_back(
+                acquireFallbackFont(source, requestedFontSizeInPixels));
+    }
+    catch (...)
+    {
+        releaseFallbackFonts(fallbackFonts);
+        throw;
+    }
+
+    DistanceFieldGlyphAtlas* const distanceFieldAtlas = acquireDistanceFieldAtlas();
+
     free();
 
+    d_distanceFieldAtlas = distanceFieldAtlas;
+    d_fallbackFonts.swap(fallbackFonts);
+    d_fallbackPixelSize = requestedFontSizeInPixels;
+
     System::getSingleton().getResourceProvider()->loadRawDataContainer(
         d_filename, d_fontData, d_resourceGroup.empty() ?
             getDefaultResourceGroup() : d_resourceGroup);
@@ -554,15 +932,6 @@ void FreeTypeFont::updateFont()
     createFreetypeMemoryFace();
 
     checkUnicodeCharMapAvailability();
-    
-    float fontScaleFactor = System::getSingleton().getRenderer()->getFontScale();
-    if (d_autoScaled != AutoScaledMode::Disabled)
-    {
-        fontScaleFactor *= d_vertScaling;
-    }
-    
-    unsigned int requestedFontSizeInPixels = static_cast<unsigned int>(
-        std::lround(getSizeInPixels() * fontScaleFactor));
 
     FT_Error errorResult = FT_Set_Pixel_Sizes(d_fontFace, 0, requestedFontSizeInPixels);
     if(errorResult != 0)
@@ -595,6 +964,15 @@ void FreeTypeFont::updateFont()
     }
 
     initialiseGlyphMap();
+
+    d_distanceFieldScale = static_cast<float>(requestedFontSizeInPixels) /
+        static_cast<float>(DistanceFieldGlyphAtlas::BaseSize);
+
+    if (d_useAsyncRasterisation && !d_distanceFieldAtlas)
+    {
+        d_asyncRasteriser = new AsyncRasteriser(d_fontData,
+            d_fontFace->size->metrics.y_ppem, d_antiAliased);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -623,20 +1001,24 @@ void FreeTypeFont::initialiseGlyphMap()
 //----------------------------------------------------------------------------//
 void FreeTypeFont::prepareGlyph(FreeTypeFontGlyph* glyph) const
 {
-    if (glyph->isInitialised())
+    if (glyph->isInitialised() || glyph->isPending())
     {
         return;
     }
 
-    FT_Vector position;
-    position.x = 0L;
-    position.y = 0L;
-    FT_Set_Transform(d_fontFace, nullptr, &position);
+    if (d_distanceFieldAtlas)
+    {
+        prepareDistanceFieldGlyph(glyph);
+        return;
+    }
 
-    // Load the code point, "rendering" the glyph
-    FT_Int32 targetType = d_antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO;
-    auto loadBitmask = FT_LOAD_RENDER | FT_LOAD_FORCE_AUTOHINT | targetType;
-    FT_Error error = FT_Load_Char(d_fontFace, glyph->getCodePoint(), loadBitmask);
+    if (d_asyncRasteriser)
+    {
+        queueGlyph(glyph);
+        return;
+    }
+
+    FT_Error error = loadGlyph(d_fontFace, glyph->getCodePoint(), d_antiAliased);
 
     glyph->markAsInitialised();
 
@@ -645,23 +1027,243 @@ void FreeTypeFont::prepareGlyph(FreeTypeFontGlyph* glyph) const
         return;
     }
 
+    GlyphBitmap bitmap;
+    bitmap.d_codePoint = glyph->getCodePoint();
+    readGlyphBitmap(d_fontFace, bitmap);
+
+    addGlyphBitmap(glyph, bitmap);
+}
+
+//----------------------------------------------------------------------------//
+FT_Error FreeTypeFont::loadGlyph(FT_Face face, char32_t codePoint, bool antiAliased)
+{
+    FT_Vector position;
+    position.x = 0L;
+    position.y = 0L;
+    FT_Set_Transform(face, nullptr, &position);
+
+    // Load the code point, "rendering" the glyph
+    FT_Int32 targetType = antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO;
+    auto loadBitmask = FT_LOAD_RENDER | FT_LOAD_FORCE_AUTOHINT | targetType;
+    return FT_Load_Char(face, codePoint, loadBitmask);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::readGlyphBitmap(FT_Face face, GlyphBitmap& bitmap)
+{
+    const FT_GlyphSlot slot = face->glyph;
+
+    bitmap.d_loaded = true;
+    bitmap.d_width = static_cast<int>(slot->bitmap.width);
+    bitmap.d_height = static_cast<int>(slot->bitmap.rows);
+    // This is the right bearing for bitmap glyphs, not slot->metrics.horiBearingX
+    bitmap.d_offset = glm::vec2(slot->bitmap_left, -slot->bitmap_top);
+    bitmap.d_advance = slot->advance.x * static_cast<float>(s_conversionMultCoeff);
+    bitmap.d_lsbDelta = slot->lsb_delta;
+    bitmap.d_rsbDelta = slot->rsb_delta;
+    bitmap.d_pixels = createGlyphTextureData(slot->bitmap);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::addGlyphBitmap(FreeTypeFontGlyph* glyph,
+                                  const GlyphBitmap& bitmap) const
+{
     bool isRendered = glyph->getImage() != nullptr;
     if (!isRendered)
     {
 #ifdef CEGUI_USE_RAQM
         // Rasterise the 0 position glyph
-        rasterise(glyph);
+        rasterise(glyph, bitmap);
 
-        glyph->setLsbDelta(d_fontFace->glyph->lsb_delta);
-        glyph->setRsbDelta(d_fontFace->glyph->rsb_delta);        
+        glyph->setLsbDelta(bitmap.d_lsbDelta);
+        glyph->setRsbDelta(bitmap.d_rsbDelta);
 #else
-        rasterise(glyph);
+        rasterise(glyph, bitmap);
 #endif
     }
 
-    const float adv =
-        d_fontFace->glyph->advance.x * static_cast<float>(s_conversionMultCoeff);
-    glyph->setAdvance(adv);
+    glyph->setAdvance(bitmap.d_advance);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::queueGlyph(FreeTypeFontGlyph* glyph) const
+{
+    glyph->setPending(true);
+
+    // lay the glyph out with its unhinted advance until it is rasterised,
+    // which FreeType can read from the font's metrics without loading it.
+    FT_Fixed advance;
+    if (FT_Get_Advance(d_fontFace, glyph->getGlyphIndex(),
+                       FT_LOAD_NO_HINTING, &advance) == 0)
+    {
+        glyph->setAdvance(advance / 65536.0f);
+    }
+    else
+    {
+        glyph->setAdvance(d_fontFace->size->metrics.max_advance *
+                          static_cast<float>(s_conversionMultCoeff));
+    }
+
+    d_asyncRasteriser->queue(glyph->getCodePoint());
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::prepareDistanceFieldGlyph(FreeTypeFontGlyph* glyph) const
+{
+    glyph->markAsInitialised();
+
+    const DistanceFieldGlyphAtlas::Glyph* fieldGlyph =
+        d_distanceFieldAtlas->getGlyph(glyph->getCodePoint());
+    if (!fieldGlyph)
+        return;
+
+    glyph->setAdvance(fieldGlyph->d_advance * d_distanceFieldScale);
+
+    // glyphs without outline, like spaces, only take up space
+    if (!fieldGlyph->d_texture)
+        return;
+
+    BitmapImage* img = new DistanceFieldGlyphImage(
+        PropertyHelper<std::uint32_t>::toString(glyph->getCodePoint()),
+        fieldGlyph->d_texture, fieldGlyph->d_area, fieldGlyph->d_offset,
+        d_distanceFieldScale, d_nativeResolution);
+    d_glyphImages.push_back(img);
+
+    glyph->setImage(img);
+}
+
+//----------------------------------------------------------------------------//
+DistanceFieldGlyphAtlas* FreeTypeFont::acquireDistanceFieldAtlas() const
+{
+    if (!d_useDistanceField)
+        return nullptr;
+
+    if (!System::getSingleton().getRenderer()->supportsShaderType(
+            DefaultShaderType::DistanceField))
+    {
+        Logger::getSingleton().logEvent("FreeTypeFont '" + d_name + "': the "
+            "renderer can not render distance fields, bitmap glyphs are used.",
+            LoggingLevel::Warning);
+        return nullptr;
+    }
+
+    DistanceFieldGlyphAtlas* atlas = DistanceFieldGlyphAtlas::acquire(
+        d_filename, d_resourceGroup.empty() ?
+            getDefaultResourceGroup() : d_resourceGroup);
+
+    if (!atlas)
+        Logger::getSingleton().logEvent("FreeTypeFont '" + d_name + "': the "
+            "font is not scalable, bitmap glyphs are used.",
+            LoggingLevel::Warning);
+
+    return atlas;
+}
+
+//----------------------------------------------------------------------------//
+FreeTypeFont* FreeTypeFont::acquireFallbackFont(const FallbackFontSource& source,
+                                                unsigned int pixelSize) const
+{
+    const String resourceGroup(source.d_resourceGroup.empty() ?
+        getDefaultResourceGroup() : source.d_resourceGroup);
+
+    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
+    sstream << pixelSize << (d_antiAliased ? "/aa" : "/mono")
+            << (d_useDistanceField ? "/df" : "");
+    const String key(resourceGroup + "/" + source.d_filename + "/" + sstream.str());
+
+    auto found = s_fallbackFonts.find(key);
+    if (found != s_fallbackFonts.end())
+    {
+        ++found->second.d_refCount;
+        return found->second.d_font;
+    }
+
+    // Fallback fonts are not known to the FontManager. Their size is chosen
+    // so that updateFont arrives at the same pixel size as this font.
+    FreeTypeFont* font = new FreeTypeFont("FallbackFont/" + key,
+        pixelSize / System::getSingleton().getRenderer()->getFontScale(),
+        FontSizeUnit::Pixels, d_antiAliased, source.d_filename, resourceGroup);
+
+    try
+    {
+        font->setUseDistanceField(d_useDistanceField);
+    }
+    catch (...)
+    {
+        delete font;
+        throw;
+    }
+
+    const SharedFallbackFont shared = { font, 1 };
+    s_fallbackFonts.emplace(key, shared);
+
+    return font;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::releaseFallbackFont(FreeTypeFont* font)
+{
+    for (auto it = s_fallbackFonts.begin(); it != s_fallbackFonts.end(); ++it)
+    {
+        if (it->second.d_font != font)
+            continue;
+
+        if (!--it->second.d_refCount)
+        {
+            s_fallbackFonts.erase(it);
+            delete font;
+        }
+
+        return;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::releaseFallbackFonts(std::vector<FreeTypeFont*>& fonts)
+{
+    for (FreeTypeFont* font : fonts)
+        releaseFallbackFont(font);
+
+    fonts.clear();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::addFallbackFont(const String& filename,
+                                   const String& resource_group)
+{
+    const FallbackFontSource source = { filename, resource_group };
+
+    d_fallbackFonts.push_back(acquireFallbackFont(source, d_fallbackPixelSize));
+    d_fallbackSources.push_back(source);
+
+    // text may use glyphs of the new fallback now
+    FontEventArgs args(this);
+    onRenderSizeChanged(args);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::clearFallbackFonts()
+{
+    if (d_fallbackSources.empty())
+        return;
+
+    releaseFallbackFonts(d_fallbackFonts);
+    d_fallbackSources.clear();
+
+    FontEventArgs args(this);
+    onRenderSizeChanged(args);
+}
+
+//----------------------------------------------------------------------------//
+size_t FreeTypeFont::getFallbackFontCount() const
+{
+    return d_fallbackSources.size();
+}
+
+//----------------------------------------------------------------------------//
+const FreeTypeFont* FreeTypeFont::getFallbackFont(size_t index) const
+{
+    return index < d_fallbackFonts.size() ? d_fallbackFonts[index] : nullptr;
 }
 
 //----------------------------------------------------------------------------//
@@ -675,6 +1277,18 @@ void FreeTypeFont::writeXMLToStream_impl(XMLSerializer& xml_stream) const
     if (d_specificLineSpacing > 0.0f)
         xml_stream.attribute(Font_xmlHandler::FontLineSpacingAttribute,
                              PropertyHelper<float>::toString(d_specificLineSpacing));
+
+    for (const FallbackFontSource& source : d_fallbackSources)
+    {
+        xml_stream.openTag(Font_xmlHandler::FallbackElement)
+            .attribute(Font_xmlHandler::FontFilenameAttribute, source.d_filename);
+
+        if (!source.d_resourceGroup.empty())
+            xml_stream.attribute(Font_xmlHandler::FontResourceGroupAttribute,
+                                 source.d_resourceGroup);
+
+        xml_stream.closeTag();
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -797,6 +1411,7 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutAndCreateGlyphRenderGeometry(
     return layoutUsingRaqmAndCreateRenderGeometry(text, clip_rect, colours,
         space_extra, imgRenderSettings, defaultParagraphDir, penPosition);
 #else
+    CEGUI_UNUSED(defaultParagraphDir);
     return layoutUsingFreetypeAndCreateRenderGeometry(text, clip_rect, colours,
         space_extra, imgRenderSettings, penPosition);
 #endif
@@ -825,6 +1440,7 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingFreetypeAndCreateRenderGeo
 
     FT_Pos previousRsbDelta = 0;
     unsigned int previousGlyphIndex = 0;
+    const FreeTypeFont* previousGlyphFont = nullptr;
 
     size_t charCount = utf32Text.size();
     for (size_t i = 0; i < charCount; ++i)
@@ -837,12 +1453,13 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingFreetypeAndCreateRenderGeo
             continue;
         }
 
-        const FreeTypeFontGlyph* glyph = getPreparedGlyph(codePoint);
+        const FreeTypeFont* glyphFont;
+        const FreeTypeFontGlyph* glyph = getPreparedGlyph(codePoint, glyphFont);
         if (glyph == nullptr)
         {
             if(codePoint != UnicodeReplacementCharacter)
             {
-                glyph = getPreparedGlyph(UnicodeReplacementCharacter);
+                glyph = getPreparedGlyph(UnicodeReplacementCharacter, glyphFont);
             }
 
             if (glyph == nullptr)
@@ -855,26 +1472,33 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingFreetypeAndCreateRenderGeo
         adjustPenPositionForBearingDeltas(penPosition, previousRsbDelta, glyph);
         previousRsbDelta = glyph->getRsbDelta();
 
-        if (i >= 1)
+        // kerning pairs only exist between glyphs of the same face
+        if (glyphFont == previousGlyphFont)
         {
             FT_Vector kerning;
 
             unsigned int rightGlyphIndex = glyph->getGlyphIndex();
 
-            FT_Get_Kerning(d_fontFace, previousGlyphIndex, rightGlyphIndex,
-                FT_KERNING_DEFAULT, &kerning);
+            // distance field glyphs are placed at fractional positions
+            std::lock_guard<std::mutex> lock(glyphFont->d_fontFaceMutex);
+            FT_Get_Kerning(glyphFont->d_fontFace, previousGlyphIndex, rightGlyphIndex,
+                glyphFont->d_distanceFieldAtlas ? FT_KERNING_UNFITTED : FT_KERNING_DEFAULT,
+                &kerning);
 
             penPosition.x += kerning.x * s_conversionMultCoeff;
         }
         previousGlyphIndex = glyph->getGlyphIndex();
+        previousGlyphFont = glyphFont;
 
-        const Image* const image = glyph->getImage();
-
-        imgRenderSettings.d_destArea =
-            Rectf(penPosition, image->getRenderedSize());
+        // glyphs still being rasterised in the background only take up space
+        if (const Image* const image = glyph->getImage())
+        {
+            imgRenderSettings.d_destArea =
+                Rectf(penPosition, image->getRenderedSize());
 
-        addGlyphRenderGeometry(textGeometryBuffers, image, imgRenderSettings,
-            clip_rect, colours);
+            addGlyphRenderGeometry(textGeometryBuffers, image, imgRenderSettings,
+                clip_rect, colours);
+        }
 
         penPosition.x += glyph->getAdvance();
 
@@ -941,98 +1565,209 @@ raqm_t* createAndSetupRaqmTextObject(
     return raqmObject;
 }
 
+std::u32string convertToUtf32(const String& text)
+{
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
+    return String::convertUtf8ToUtf32(text);
+#elif (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32) 
+    return text.getString();
+#endif
 }
 
-std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingRaqmAndCreateRenderGeometry(
-    const String& text, const Rectf* clip_rect, const ColourRect& colours, 
-    const float space_extra, ImageRenderSettings imgRenderSettings, 
-    DefaultParagraphDirection defaultParagraphDir, glm::vec2& penPosition) const
-{
-    std::vector<GeometryBuffer*> textGeometryBuffers;
+}
 
-    penPosition.y += getBaseline();
+const ShapedTextCache::Run& FreeTypeFont::getShapedRun(
+    const std::u32string& text, DefaultParagraphDirection defaultParagraphDir) const
+{
+    std::lock_guard<std::mutex> lock(d_shapedTextCacheMutex);
 
-    if (text.empty())
+    if (const ShapedTextCache::Run* cachedRun = d_shapedTextCache.find(text, defaultParagraphDir))
     {
-        return textGeometryBuffers;
+        return *cachedRun;
     }
 
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
-    std::u32string utf32Text = String::convertUtf8ToUtf32(text);
-    size_t origTextLength = utf32Text.length();
-    const uint32_t* originalTextArray = reinterpret_cast<const std::uint32_t*>(utf32Text.c_str());
-#elif (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32) 
-    size_t origTextLength = text.length();
-    const uint32_t* originalTextArray = reinterpret_cast<const std::uint32_t*>(text.c_str());
-#endif
+    // shaping uses the face; windows built in parallel are redone on the
+    // main thread instead
+    if (Window::isGeometryBuildWorker())
+    {
+        static const ShapedTextCache::Run emptyRun;
+        Window::deferGeometryBuildToMainThread();
+        return emptyRun;
+    }
 
     raqm_t* raqmObject = createAndSetupRaqmTextObject(
-        originalTextArray, origTextLength, defaultParagraphDir, getFontFace());
+        reinterpret_cast<const std::uint32_t*>(text.c_str()), text.length(),
+        defaultParagraphDir, getFontFace());
 
     size_t count = 0;
-    raqm_glyph_t* glyphs = raqm_get_glyphs(raqmObject, &count);
+    const raqm_glyph_t* glyphs = raqm_get_glyphs(raqmObject, &count);
 
+    ShapedTextCache::Run run;
+    run.reserve(count);
     for (size_t i = 0; i < count; i++)
     {
-        raqm_glyph_t& currentGlyph = glyphs[i];
+        const ShapedTextCache::Glyph shapedGlyph = {
+            glyphs[i].index,
+            static_cast<unsigned int>(glyphs[i].cluster),
+            glyphs[i].x_advance * s_conversionMultCoeff,
+            glyphs[i].x_offset * s_conversionMultCoeff,
+            glyphs[i].y_offset * s_conversionMultCoeff };
+        run.push_back(shapedGlyph);
+    }
 
-        char32_t codePoint;
-        auto foundCodePointIter = d_indexToGlyphMap.find(currentGlyph.index);
-        if (foundCodePointIter != d_indexToGlyphMap.end())
-        {
-            codePoint = foundCodePointIter->second;
-        }
-        else
-        {
-            codePoint = UnicodeReplacementCharacter;
-        }
+    raqm_destroy(raqmObject);
+
+    return d_shapedTextCache.insert(text, defaultParagraphDir, std::move(run));
+}
+
+const FreeTypeFontGlyph* FreeTypeFont::getPreparedGlyphForIndex(unsigned int glyphIndex) const
+{
+    char32_t codePoint;
+    auto foundCodePointIter = d_indexToGlyphMap.find(glyphIndex);
+    if (foundCodePointIter != d_indexToGlyphMap.end())
+    {
+        codePoint = foundCodePointIter->second;
+    }
+    else
+    {
+        codePoint = UnicodeReplacementCharacter;
+    }
+
+    const FreeTypeFontGlyph* glyph = getPreparedGlyph(codePoint);
+    if (glyph == nullptr && codePoint != UnicodeReplacementCharacter)
+    {
+        glyph = getPreparedGlyph(UnicodeReplacementCharacter);
+    }
+
+    return glyph;
+}
 
+template <typename GlyphFunc>
+void FreeTypeFont::placeShapedGlyphs(const std::u32string& text,
+    DefaultParagraphDirection dir, float space_extra, float& penPositionX,
+    GlyphFunc glyphFunc) const
+{
+    for (const ShapedTextCache::Glyph& shapedGlyph : getShapedRun(text, dir))
+    {
         // Ignore new line characters
-        if (originalTextArray[currentGlyph.cluster] == '\n')
+        if (text[shapedGlyph.d_cluster] == '\n')
         {
             continue;
         }
 
-        const FreeTypeFontGlyph* glyph = getPreparedGlyph(codePoint);
-        if (glyph == nullptr)
+        // raqm shapes with our own face only; code points it has no glyph
+        // for come back as .notdef and are drawn from a fallback font with
+        // that font's unshaped advance
+        ShapedTextCache::Glyph placedGlyph = shapedGlyph;
+        const FreeTypeFontGlyph* glyph = nullptr;
+        if (shapedGlyph.d_index == 0 && !d_fallbackFonts.empty())
         {
-            if (codePoint != UnicodeReplacementCharacter)
-            {
-                glyph = getPreparedGlyph(UnicodeReplacementCharacter);
-            }
-
-            if (glyph == nullptr)
+            const FreeTypeFont* owner;
+            glyph = getPreparedGlyph(text[shapedGlyph.d_cluster], owner);
+            if (glyph != nullptr && owner != this)
             {
-                continue;
+                placedGlyph.d_advance = glyph->getAdvance();
+                placedGlyph.d_offsetX = 0.0f;
+                placedGlyph.d_offsetY = 0.0f;
             }
         }
 
-        const Image* const image = glyph->getImage();
+        if (glyph == nullptr)
+        {
+            glyph = getPreparedGlyphForIndex(shapedGlyph.d_index);
+        }
 
-        penPosition.x = std::round(penPosition.x);
-        
-        //The glyph pos will be rounded to full pixels internally
-        glm::vec2 renderGlyphPos(
-            penPosition.x + currentGlyph.x_offset * s_conversionMultCoeff,
-            penPosition.y + currentGlyph.y_offset * s_conversionMultCoeff);
+        if (glyph == nullptr)
+        {
+            continue;
+        }
 
-        imgRenderSettings.d_destArea =
-            Rectf(renderGlyphPos, image->getRenderedSize());
+        // every glyph starts on a full pixel
+        penPositionX = std::round(penPositionX);
 
-        addGlyphRenderGeometry(textGeometryBuffers, image, imgRenderSettings,
-            clip_rect, colours);
+        glyphFunc(*glyph, placedGlyph, penPositionX + placedGlyph.d_offsetX);
 
-        penPosition.x += currentGlyph.x_advance * s_conversionMultCoeff;
+        penPositionX += placedGlyph.d_advance;
 
-        if (codePoint == ' ')
+        if (text[shapedGlyph.d_cluster] == ' ')
         {
             // TODO: This is for justified text and probably wrong because the space was determined
             // without considering kerning
-            penPosition.x += space_extra;
+            penPositionX += space_extra;
         }
     }
+}
 
-    raqm_destroy(raqmObject);
+float FreeTypeFont::getTextExtent(const String& text,
+    DefaultParagraphDirection defaultParagraphDir) const
+{
+    if (text.empty())
+    {
+        return 0.0f;
+    }
+
+    float penPositionX = 0.0f;
+    float extent = 0.0f;
+    placeShapedGlyphs(convertToUtf32(text), defaultParagraphDir, 0.0f, penPositionX,
+        [&extent](const FreeTypeFontGlyph& glyph, const ShapedTextCache::Glyph&,
+                  float glyphPositionX)
+        {
+            extent = std::max(extent, glyphPositionX + glyph.getRenderedAdvance());
+        });
+
+    return std::max(penPositionX, extent);
+}
+
+float FreeTypeFont::getTextAdvance(const String& text,
+    DefaultParagraphDirection defaultParagraphDir) const
+{
+    if (text.empty())
+    {
+        return 0.0f;
+    }
+
+    float penPositionX = 0.0f;
+    placeShapedGlyphs(convertToUtf32(text), defaultParagraphDir, 0.0f, penPositionX,
+        [](const FreeTypeFontGlyph&, const ShapedTextCache::Glyph&, float) {});
+
+    return penPositionX;
+}
+
+std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingRaqmAndCreateRenderGeometry(
+    const String& text, const Rectf* clip_rect, const ColourRect& colours, 
+    const float space_extra, ImageRenderSettings imgRenderSettings, 
+    DefaultParagraphDirection defaultParagraphDir, glm::vec2& penPosition) const
+{
+    std::vector<GeometryBuffer*> textGeometryBuffers;
+
+    penPosition.y += getBaseline();
+
+    if (text.empty())
+    {
+        return textGeometryBuffers;
+    }
+
+    placeShapedGlyphs(convertToUtf32(text), defaultParagraphDir, space_extra, penPosition.x,
+        [&](const FreeTypeFontGlyph& glyph, const ShapedTextCache::Glyph& shapedGlyph,
+            float glyphPositionX)
+        {
+            // glyphs still being rasterised in the background only take up space
+            const Image* const image = glyph.getImage();
+            if (!image)
+            {
+                return;
+            }
+
+            //The glyph pos will be rounded to full pixels internally
+            const glm::vec2 renderGlyphPos(glyphPositionX,
+                                           penPosition.y + shapedGlyph.d_offsetY);
+
+            imgRenderSettings.d_destArea =
+                Rectf(renderGlyphPos, image->getRenderedSize());
+
+            addGlyphRenderGeometry(textGeometryBuffers, image, imgRenderSettings,
+                clip_rect, colours);
+        });
 
     return textGeometryBuffers;
 }
@@ -1040,13 +1775,31 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingRaqmAndCreateRenderGeometr
 
 bool FreeTypeFont::isCodepointAvailable(char32_t codePoint) const
 {
-    return d_codePointToGlyphMap.find(codePoint) != d_codePointToGlyphMap.end();
+    return getGlyphForCodepoint(codePoint) != nullptr;
 }
 
 
 FreeTypeFontGlyph* FreeTypeFont::getGlyphForCodepoint(const char32_t codepoint) const
 {
-    CodePointToGlyphMap::const_iterator pos = d_codePointToGlyphMap.find(codepoint);
+    if (FreeTypeFontGlyph* glyph = findOwnGlyph(codepoint))
+    {
+        return glyph;
+    }
+
+    for (const FreeTypeFont* fallbackFont : d_fallbackFonts)
+    {
+        if (FreeTypeFontGlyph* glyph = fallbackFont->findOwnGlyph(codepoint))
+        {
+            return glyph;
+        }
+    }
+
+    return nullptr;
+}
+
+FreeTypeFontGlyph* FreeTypeFont::findOwnGlyph(char32_t codePoint) const
+{
+    CodePointToGlyphMap::const_iterator pos = d_codePointToGlyphMap.find(codePoint);
     if (pos != d_codePointToGlyphMap.end())
     {
         return pos->second;
@@ -1065,15 +1818,173 @@ void FreeTypeFont::setInitialGlyphAtlasSize(int val)
     d_initialGlyphAtlasSize = val;
 }
 
+void FreeTypeFont::setUseAsyncRasterisation(bool use_async_rasterisation)
+{
+    if (use_async_rasterisation == d_useAsyncRasterisation)
+        return;
+
+    d_useAsyncRasterisation = use_async_rasterisation;
+
+    if (d_useAsyncRasterisation)
+    {
+        if (d_fontFace && !d_distanceFieldAtlas)
+        {
+            d_asyncRasteriser = new AsyncRasteriser(d_fontData,
+                d_fontFace->size->metrics.y_ppem, d_antiAliased);
+        }
+
+        return;
+    }
+
+    if (!d_asyncRasteriser)
+        return;
+
+    // keep what the worker finished; the rest is rasterised on demand again
+    d_asyncRasteriser->stop();
+    processPendingGlyphs();
+
+    for (char32_t codePoint : d_asyncRasteriser->d_queue)
+        findOwnGlyph(codePoint)->setPending(false);
+
+    delete d_asyncRasteriser;
+    d_asyncRasteriser = nullptr;
+}
+
+bool FreeTypeFont::getUsesAsyncRasterisation() const
+{
+    return d_useAsyncRasterisation;
+}
+
+void FreeTypeFont::prewarmGlyphs(const String& code_points)
+{
+#if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
+    for (size_t c = 0; c < code_points.length(); ++c)
+    {
+        if (FreeTypeFontGlyph* glyph = findOwnGlyph(code_points[c]))
+            prepareGlyph(glyph);
+    }
+#else
+    String::codepoint_iterator codePointIter(code_points.begin(),
+        code_points.begin(), code_points.end());
+    for (; !codePointIter.isAtEnd(); ++codePointIter)
+    {
+        if (FreeTypeFontGlyph* glyph = findOwnGlyph(*codePointIter))
+            prepareGlyph(glyph);
+    }
+#endif
+
+    flushGlyphAtlasUpload();
+}
+
+void FreeTypeFont::prewarmGlyphs(char32_t first, char32_t last)
+{
+    for (char32_t codePoint = first; codePoint <= last && codePoint >= first; ++codePoint)
+    {
+        if (FreeTypeFontGlyph* glyph = findOwnGlyph(codePoint))
+            prepareGlyph(glyph);
+    }
+
+    flushGlyphAtlasUpload();
+}
+
+size_t FreeTypeFont::getPendingGlyphCount() const
+{
+    return d_asyncRasteriser ? d_asyncRasteriser->getPendingCount() : 0;
+}
+
+void FreeTypeFont::waitForPendingGlyphs()
+{
+    if (!d_asyncRasteriser)
+        return;
+
+    d_asyncRasteriser->waitUntilIdle();
+    processPendingGlyphs();
+}
+
+void FreeTypeFont::processPendingGlyphs()
+{
+    if (!d_asyncRasteriser)
+        return;
+
+    std::vector<GlyphBitmap> finished;
+    d_asyncRasteriser->takeFinished(finished);
+
+    if (finished.empty())
+        return;
+
+    for (const GlyphBitmap& bitmap : finished)
+    {
+        FreeTypeFontGlyph* glyph = findOwnGlyph(bitmap.d_codePoint);
+        glyph->setPending(false);
+        glyph->markAsInitialised();
+
+        if (bitmap.d_loaded)
+            addGlyphBitmap(glyph, bitmap);
+    }
+
+    flushGlyphAtlasUpload();
+
+    // the glyphs have their images and final advances now
+    FontEventArgs args(this);
+    onRenderSizeChanged(args);
+}
+
+void FreeTypeFont::setUseDistanceField(bool use_distance_field)
+{
+    if (use_distance_field == d_useDistanceField)
+        return;
+
+    d_useDistanceField = use_distance_field;
+    updateFont();
+
+    FontEventArgs args(this);
+    onRenderSizeChanged(args);
+}
+
+bool FreeTypeFont::getUsesDistanceField() const
+{
+    return d_useDistanceField;
+}
+
+const DistanceFieldGlyphAtlas* FreeTypeFont::getDistanceFieldAtlas() const
+{
+    return d_distanceFieldAtlas;
+}
+
 const FreeTypeFontGlyph* FreeTypeFont::getPreparedGlyph(char32_t currentCodePoint) const
 {
-    FreeTypeFontGlyph* glyph = getGlyphForCodepoint(currentCodePoint);
+    const FreeTypeFont* glyphFont;
+    return getPreparedGlyph(currentCodePoint, glyphFont);
+}
 
-    if (glyph != nullptr)
+const FreeTypeFontGlyph* FreeTypeFont::getPreparedGlyph(char32_t codePoint,
+                                                        const FreeTypeFont*& owner) const
+{
+    owner = this;
+    FreeTypeFontGlyph* glyph = findOwnGlyph(codePoint);
+
+    for (size_t i = 0; glyph == nullptr && i < d_fallbackFonts.size(); ++i)
     {
-        prepareGlyph(glyph);
+        owner = d_fallbackFonts[i];
+        glyph = owner->findOwnGlyph(codePoint);
     }
 
+    if (glyph == nullptr)
+        return nullptr;
+
+    // glyphs are only rasterised and uploaded on the main thread
+    if (Window::isGeometryBuildWorker())
+    {
+        if (glyph->isInitialised() || glyph->isPending())
+            return glyph;
+
+        Window::deferGeometryBuildToMainThread();
+        return nullptr;
+    }
+
+    owner->prepareGlyph(glyph);
+    owner->flushGlyphAtlasUpload();
+
     return glyph;
 }
 
@@ -33,6 +33,10 @@ namespace CEGUI
 float FreeTypeFontGlyph::getRenderedAdvance(
 ) const
 {
+    // not rasterised yet, or the glyph failed to load
+    if (!getImage())
+        return getAdvance();
+
 #ifdef CEGUI_USE_RAQM
     //TODO: This is incorrect, the estimate based on the advance should not be used when raqm is on
     float sizeX = getImage()->getRenderedSize().d_width + getImage()->getRenderedOffset().x;
@@ -53,6 +57,16 @@ bool FreeTypeFontGlyph::isInitialised() const
     return d_initialised;
 }
 
+void FreeTypeFontGlyph::setPending(bool pending)
+{
+    d_pending = pending;
+}
+
+bool FreeTypeFontGlyph::isPending() const
+{
+    return d_pending;
+}
+
 void FreeTypeFontGlyph::setLsbDelta(const long lsbDelta)
 {
     d_lsbDelta = lsbDelta;
@@ -32,6 +32,15 @@
 #include "CEGUI/Window.h"
 #include "CEGUI/widgets/Tooltip.h"
 #include "CEGUI/SimpleTimer.h"
+#include "CEGUI/Profiler.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -45,6 +54,159 @@ const String GUIContext::EventRootWindowChanged("RootWindowChanged");
 const String GUIContext::EventRenderTargetChanged("RenderTargetChanged");
 const String GUIContext::EventDefaultFontChanged("DefaultFontChanged");
 
+//----------------------------------------------------------------------------//
+/*
+    Threads building window geometry. The windows are handed out in order
+    through a shared index, so a thread that finishes a cheap window simply
+    takes the next one. The thread calling build works along with the others.
+*/
+struct GUIContext::GeometryBuildPool
+{
+    explicit GeometryBuildPool(unsigned int worker_count);
+    ~GeometryBuildPool();
+
+    /*
+        Populate the geometry of \a windows and set \a built for those whose
+        build was not deferred to the main thread. Exceptions are rethrown
+        once all threads stopped.
+    */
+    void build(const std::vector<Window*>& windows, std::vector<char>& built);
+
+private:
+    void workerMain();
+    void runTasks();
+
+    std::vector<std::thread> d_workers;
+    std::mutex d_mutex;
+    std::condition_variable d_wake;
+    std::condition_variable d_done;
+    //! incremented to wake the workers for the next build.
+    unsigned int d_generation;
+    unsigned int d_busyWorkers;
+    bool d_stopping;
+
+    const std::vector<Window*>* d_windows;
+    std::vector<char>* d_built;
+    std::atomic<std::size_t> d_nextTask;
+    std::atomic<bool> d_failed;
+    std::exception_ptr d_exception;
+};
+
+//----------------------------------------------------------------------------//
+GUIContext::GeometryBuildPool::GeometryBuildPool(unsigned int worker_count) :
+    d_generation(0),
+    d_busyWorkers(0),
+    d_stopping(false),
+    d_windows(nullptr),
+    d_built(nullptr),
+    d_nextTask(0),
+    d_failed(false)
+{
+    d_workers.reserve(worker_count);
+    for (unsigned int i = 0; i < worker_count; ++i)
+        d_workers.emplace_back(&GeometryBuildPool::workerMain, this);
+}
+
+//----------------------------------------------------------------------------//
+GUIContext::GeometryBuildPool::~GeometryBuildPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stopping = true;
+    }
+    d_wake.notify_all();
+
+    for (std::thread& worker : d_workers)
+        worker.join();
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::GeometryBuildPool::build(const std::vector<Window*>& windows,
+                                          std::vector<char>& built)
+{
+    d_windows = &windows;
+    d_built = &built;
+    d_nextTask = 0;
+    d_failed = false;
+    d_exception = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_busyWorkers = static_cast<unsigned int>(d_workers.size());
+        ++d_generation;
+    }
+    d_wake.notify_all();
+
+    runTasks();
+    Window::setGeometryBuildWorker(false);
+
+    {
+        std::unique_lock<std::mutex> lock(d_mutex);
+        d_done.wait(lock, [this] { return d_busyWorkers == 0; });
+    }
+
+    if (d_exception)
+        std::rethrow_exception(d_exception);
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::GeometryBuildPool::workerMain()
+{
+    unsigned int generation = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(d_mutex);
+            d_wake.wait(lock, [this, generation]
+                { return d_stopping || d_generation != generation; });
+
+            if (d_stopping)
+                return;
+
+            generation = d_generation;
+        }
+
+        runTasks();
+
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            --d_busyWorkers;
+        }
+        d_done.notify_one();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::GeometryBuildPool::runTasks()
+{
+    const std::size_t task_count = d_windows->size();
+
+    for (;;)
+    {
+        const std::size_t task = d_nextTask.fetch_add(1);
+        if (task >= task_count || d_failed)
+            return;
+
+        // also forgets a deferral of the previous window
+        Window::setGeometryBuildWorker(true);
+
+        try
+        {
+            (*d_windows)[task]->populateGeometry();
+            (*d_built)[task] = !Window::isGeometryBuildDeferred();
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            if (!d_exception)
+                d_exception = std::current_exception();
+            d_failed = true;
+            return;
+        }
+    }
+}
+
 //----------------------------------------------------------------------------//
 GUIContext::GUIContext(RenderTarget& target) :
     RenderingSurface(target),
@@ -65,7 +227,9 @@ GUIContext::GUIContext(RenderTarget& target) :
             WindowManager::EventWindowDestroyed,
             Event::Subscriber(&GUIContext::windowDestroyedHandler, this))),
     d_semanticEventHandlers(),
-    d_windowNavigator(nullptr)
+    d_windowNavigator(nullptr),
+    d_geometryBuildThreadCount(1),
+    d_geometryBuildPool(nullptr)
 {
     resetWindowContainingCursor();
     initializeSemanticEventHandlers();
@@ -81,6 +245,8 @@ void GUIContext::resetWindowContainingCursor()
 //----------------------------------------------------------------------------//
 GUIContext::~GUIContext()
 {
+    delete d_geometryBuildPool;
+
     destroyDefaultTooltipWindowInstance();
     deleteSemanticEventHandlers();
 
@@ -274,9 +440,108 @@ void GUIContext::renderWindowHierarchyToSurfaces()
     if (rs.isRenderingWindow())
         static_cast<RenderingWindow&>(rs).getOwner().clearGeometry();
 
+    if (d_geometryBuildPool &&
+        System::getSingleton().getRenderer()->isGeometryBufferCreationThreadSafe())
+    {
+        buildWindowGeometryInParallel();
+    }
+
+    // queues all geometry and builds whatever was not built above.
     d_rootWindow->draw();
 }
 
+//----------------------------------------------------------------------------//
+void GUIContext::buildWindowGeometryInParallel()
+{
+    std::vector<Window*> windows;
+    collectGeometryBuildWindows(*d_rootWindow, windows);
+
+    // not worth waking the workers for
+    if (windows.size() < 2)
+        return;
+
+    // event handlers run here, before any geometry is built in parallel
+    for (Window* window : windows)
+        window->beginGeometryBuild();
+
+    updateGeometryBuildCaches(*d_rootWindow);
+
+    std::vector<char> built(windows.size(), 0);
+    d_geometryBuildPool->build(windows, built);
+
+    for (std::size_t i = 0; i < windows.size(); ++i)
+    {
+        Window& window = *windows[i];
+
+        if (!built[i])
+        {
+            window.destroyGeometryBuffers();
+            window.populateGeometry();
+        }
+
+        window.endGeometryBuild();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::collectGeometryBuildWindows(Window& window,
+                                             std::vector<Window*>& windows) const
+{
+    // follows Window::draw
+    if (!window.isEffectiveVisible())
+        return;
+
+    if (window.d_needsRedraw && window.d_windowRenderer &&
+        window.d_windowRenderer->isGeometryBuildThreadSafe())
+    {
+        windows.push_back(&window);
+    }
+
+    if (window.d_surface && !window.d_surface->isInvalidated())
+        return;
+
+    for (Window* child : window.d_drawList)
+        collectGeometryBuildWindows(*child, windows);
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::updateGeometryBuildCaches(const Window& window) const
+{
+    // geometry may refer to any window, visible or not
+    window.getUnclippedOuterRect().get();
+    window.getUnclippedInnerRect().get();
+    window.getClientChildContentArea().get();
+    window.getNonClientChildContentArea().get();
+    window.getOuterRectClipper();
+    window.getInnerRectClipper();
+    window.getTextVisual();
+
+    const std::size_t child_count = window.getChildCount();
+    for (std::size_t i = 0; i < child_count; ++i)
+        updateGeometryBuildCaches(*window.getChildAtIdx(i));
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::setGeometryBuildThreadCount(unsigned int count)
+{
+    if (count == d_geometryBuildThreadCount)
+        return;
+
+    delete d_geometryBuildPool;
+    d_geometryBuildPool = nullptr;
+
+    d_geometryBuildThreadCount = count;
+
+    if (count > 1)
+        d_geometryBuildPool = new GeometryBuildPool(count - 1);
+}
+
+//----------------------------------------------------------------------------//
+unsigned int GUIContext::getGeometryBuildThreadCount() const
+{
+    return d_geometryBuildThreadCount;
+}
+
 //----------------------------------------------------------------------------//
 Cursor& GUIContext::getCursor()
 {
@@ -513,6 +778,8 @@ bool GUIContext::injectInputEvent(const InputEvent& event)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectTimePulse(float timeElapsed)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectTimePulse");
+
     // if no visible active sheet, input can't be handled
     if (!d_rootWindow || !d_rootWindow->isEffectiveVisible())
         return false;
@@ -57,7 +57,10 @@ GeometryBuffer::GeometryBuffer(RefCounted<RenderMaterial> renderMaterial):
     d_clippingRegion(0, 0, 0, 0),
     d_preparedClippingRegion(0, 0, 0, 0),
     d_clippingActive(false),
-    d_alpha(1.0f)
+    d_alpha(1.0f),
+    d_quadIndexingSupported(false),
+    d_quadIndexed(false),
+    d_appendingIndexedQuad(false)
 {}
 
 //---------------------------------------------------------------------------//
@@ -164,6 +167,10 @@ void GeometryBuffer::appendGeometry(const TexturedColouredVertex* vertex_array,
 void GeometryBuffer::appendGeometry(const float* vertex_data,
                                     std::size_t array_size)
 {
+    // anything but an indexed quad turns the buffer into plain triangles.
+    if (d_quadIndexed && !d_appendingIndexedQuad)
+        expandIndexedQuads();
+
     d_vertexData.reserve(d_vertexData.size() + array_size);
     std::copy(vertex_data, vertex_data + array_size, std::back_inserter(d_vertexData));
 
@@ -171,6 +178,143 @@ void GeometryBuffer::appendGeometry(const float* vertex_data,
     d_vertexCount = d_vertexData.size() / getVertexAttributeElementCount();
 }
 
+//---------------------------------------------------------------------------//
+void GeometryBuffer::appendQuad(const TexturedColouredVertex* corners)
+{
+    if (!canAppendIndexedQuad())
+    {
+        // two triangles, split along the top-left to bottom-right diagonal.
+        const TexturedColouredVertex triangles[6] =
+            { corners[0], corners[1], corners[2],
+              corners[3], corners[0], corners[2] };
+
+        appendGeometry(triangles, 6);
+        return;
+    }
+
+    float vertexData[4 * 9];
+    float* vd = vertexData;
+    for (int i = 0; i < 4; ++i)
+    {
+        const TexturedColouredVertex& vertex = corners[i];
+        *vd++ = vertex.d_position.x;
+        *vd++ = vertex.d_position.y;
+        *vd++ = vertex.d_position.z;
+        *vd++ = vertex.d_colour.x;
+        *vd++ = vertex.d_colour.y;
+        *vd++ = vertex.d_colour.z;
+        *vd++ = vertex.d_colour.w;
+        *vd++ = vertex.d_texCoords.x;
+        *vd++ = vertex.d_texCoords.y;
+    }
+
+    d_quadIndexed = true;
+    d_appendingIndexedQuad = true;
+    appendGeometry(vertexData, 4 * 9);
+    d_appendingIndexedQuad = false;
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::appendQuads(const float* vertex_data, std::size_t quad_count)
+{
+    if (canAppendIndexedQuad() &&
+        d_vertexCount / 4 + quad_count <= MaxIndexedQuadCount)
+    {
+        d_quadIndexed = true;
+        d_appendingIndexedQuad = true;
+        appendGeometry(vertex_data, quad_count * 4 * 9);
+        d_appendingIndexedQuad = false;
+        return;
+    }
+
+    for (std::size_t i = 0; i < quad_count; ++i)
+    {
+        TexturedColouredVertex corners[4];
+        for (TexturedColouredVertex& vertex : corners)
+        {
+            vertex.d_position = glm::vec3(vertex_data[0], vertex_data[1], vertex_data[2]);
+            vertex.d_colour = glm::vec4(vertex_data[3], vertex_data[4],
+                                        vertex_data[5], vertex_data[6]);
+            vertex.d_texCoords = glm::vec2(vertex_data[7], vertex_data[8]);
+            vertex_data += 9;
+        }
+
+        appendQuad(corners);
+    }
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::canAppendIndexedQuad() const
+{
+    if (!d_quadIndexingSupported ||
+        d_polygonFillRule != PolygonFillRule::NoFilling ||
+        getVertexAttributeElementCount() != 9)
+        return false;
+
+    if (!d_quadIndexed)
+        return d_vertexData.empty();
+
+    return d_vertexCount / 4 < MaxIndexedQuadCount;
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::expandIndexedQuads()
+{
+    d_quadIndexed = false;
+
+    const std::size_t stride = getVertexAttributeElementCount();
+    const std::size_t quad_count = d_vertexCount / 4;
+    const std::vector<std::uint16_t>& indices = getQuadIndices();
+
+    VertexData triangles;
+    triangles.reserve(quad_count * 6 * stride);
+    for (std::size_t i = 0; i < quad_count * 6; ++i)
+    {
+        const float* vertex = &d_vertexData[indices[i] * stride];
+        triangles.insert(triangles.end(), vertex, vertex + stride);
+    }
+
+    d_vertexData.swap(triangles);
+    d_vertexCount = d_vertexData.size() / stride;
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isQuadIndexed() const
+{
+    return d_quadIndexed;
+}
+
+//---------------------------------------------------------------------------//
+std::size_t GeometryBuffer::getIndexCount() const
+{
+    return d_quadIndexed ? d_vertexCount / 4 * 6 : 0;
+}
+
+//---------------------------------------------------------------------------//
+const std::vector<std::uint16_t>& GeometryBuffer::getQuadIndices()
+{
+    // initialised once, also when buffers are built on several threads
+    static const std::vector<std::uint16_t> indices = []
+    {
+        std::vector<std::uint16_t> quadIndices;
+        quadIndices.reserve(MaxIndexedQuadCount * 6);
+        for (std::size_t quad = 0; quad < MaxIndexedQuadCount; ++quad)
+        {
+            const std::uint16_t first = static_cast<std::uint16_t>(quad * 4);
+            // corners are top-left, bottom-left, bottom-right, top-right.
+            quadIndices.push_back(first);
+            quadIndices.push_back(first + 1);
+            quadIndices.push_back(first + 2);
+            quadIndices.push_back(first + 3);
+            quadIndices.push_back(first);
+            quadIndices.push_back(first + 2);
+        }
+        return quadIndices;
+    }();
+
+    return indices;
+}
+
 //---------------------------------------------------------------------------//
 void GeometryBuffer::appendVertex(const TexturedColouredVertex& vertex)
 {
@@ -264,6 +408,11 @@ void GeometryBuffer::setRenderMaterial(RefCounted<RenderMaterial> render_materia
 void GeometryBuffer::setStencilRenderingActive(PolygonFillRule fill_rule)
 {
     d_polygonFillRule = fill_rule;
+
+    // stencil rendering draws plain triangles; appending nothing lets
+    // renderers pick up the expanded vertex data.
+    if (d_quadIndexed && fill_rule != PolygonFillRule::NoFilling)
+        appendGeometry(static_cast<const float*>(nullptr), 0);
 }
 
 //---------------------------------------------------------------------------//
@@ -272,6 +421,24 @@ void GeometryBuffer::setStencilPostRenderingVertexCount(unsigned int vertex_coun
     d_postStencilVertexCount = vertex_count;
 }
 
+//---------------------------------------------------------------------------//
+PolygonFillRule GeometryBuffer::getStencilFillRule() const
+{
+    return d_polygonFillRule;
+}
+
+//---------------------------------------------------------------------------//
+unsigned int GeometryBuffer::getStencilPostRenderingVertexCount() const
+{
+    return d_postStencilVertexCount;
+}
+
+//---------------------------------------------------------------------------//
+const std::vector<float>& GeometryBuffer::getVertexData() const
+{
+    return d_vertexData;
+}
+
 //----------------------------------------------------------------------------//
 void GeometryBuffer::setRenderEffect(RenderEffect* effect)
 {
@@ -340,6 +507,12 @@ void GeometryBuffer::setCustomTransform(const glm::mat4x4& transformation)
     }
 }
 
+//----------------------------------------------------------------------------//
+const glm::mat4x4& GeometryBuffer::getCustomTransform() const
+{
+    return d_customTransform;
+}
+
 void GeometryBuffer::setClippingRegion(const Rectf& region)
 {
     d_clippingRegion = region;
@@ -383,6 +556,7 @@ std::size_t GeometryBuffer::getVertexCount() const
 void GeometryBuffer::reset()
 {
     d_vertexData.clear();
+    d_quadIndexed = false;
     d_clippingActive = true;
 }
 
@@ -472,16 +646,13 @@ void GeometryBuffer::updateTextureCoordinates(const Texture* texture, const floa
     }
 
 
+    // scaled in place, so quad indexed buffers stay indexed.
     size_t vertexCount = d_vertexData.size() / 9;
     for(size_t i = 0; i < vertexCount; ++i)
     {
         d_vertexData[i * 9 + 7] *= scaleFactor;
         d_vertexData[i * 9 + 8] *= scaleFactor;
     }
-
-    VertexData tempVertexData = d_vertexData;
-    d_vertexData.clear();
-    appendGeometry(tempVertexData.data(), tempVertexData.size());
 }
 
 }
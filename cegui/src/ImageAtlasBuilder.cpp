@@ -0,0 +1,508 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Implementation of the ImageAtlasBuilder
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ImageAtlasBuilder.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/System.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/PropertyHelper.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/Logger.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <cstring>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// Number of pixels each source is extruded by on every side, so that bilinear
+// filtering at an image's edge never samples a neighbouring image.
+static const unsigned int AtlasPadding = 1;
+
+//----------------------------------------------------------------------------//
+/*!
+    Texture implementation that just keeps a RGBA copy of whatever an
+    ImageCodec loads into it. Used to decode image files on the CPU.
+*/
+class DecodedImageTexture : public Texture
+{
+public:
+    DecodedImageTexture(std::vector<std::uint8_t>& pixels) :
+        d_pixels(pixels),
+        d_size(0, 0),
+        d_texelScaling(0, 0)
+    {}
+
+    const String& getName() const override { return d_name; }
+    const Sizef& getSize() const override { return d_size; }
+    const Sizef& getOriginalDataSize() const override { return d_size; }
+    const glm::vec2& getTexelScaling() const override { return d_texelScaling; }
+
+    void loadFromFile(const String&, const String&) override
+    {
+        throw InvalidRequestException("Not supported by this texture type.");
+    }
+
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                        PixelFormat pixel_format) override;
+
+    void blitFromMemory(const void*, const Rectf&) override {}
+    void blitToMemory(void*) override {}
+
+    bool isPixelFormatSupported(const PixelFormat fmt) const override
+    {
+        return fmt == PixelFormat::Rgba || fmt == PixelFormat::Rgb ||
+               fmt == PixelFormat::Rgba4444 || fmt == PixelFormat::Rgb565;
+    }
+
+private:
+    std::vector<std::uint8_t>& d_pixels;
+    String d_name;
+    Sizef d_size;
+    glm::vec2 d_texelScaling;
+};
+
+//----------------------------------------------------------------------------//
+void DecodedImageTexture::loadFromMemory(const void* buffer,
+                                         const Sizef& buffer_size,
+                                         PixelFormat pixel_format)
+{
+    if (!isPixelFormatSupported(pixel_format))
+        throw InvalidRequestException(
+            "Data was supplied in an unsupported pixel format.");
+
+    const size_t count = static_cast<size_t>(buffer_size.d_width) *
+                         static_cast<size_t>(buffer_size.d_height);
+    d_pixels.resize(count * 4);
+    d_size = buffer_size;
+
+    const std::uint8_t* src = static_cast<const std::uint8_t*>(buffer);
+    const std::uint16_t* src16 = static_cast<const std::uint16_t*>(buffer);
+    std::uint8_t* dst = d_pixels.data();
+
+    switch (pixel_format)
+    {
+    case PixelFormat::Rgba:
+        std::memcpy(dst, src, count * 4);
+        break;
+
+    case PixelFormat::Rgb:
+        for (size_t i = 0; i < count; ++i, src += 3, dst += 4)
+        {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = 0xFF;
+        }
+        break;
+
+    case PixelFormat::Rgba4444:
+        for (size_t i = 0; i < count; ++i, dst += 4)
+        {
+            const std::uint16_t p = src16[i];
+            dst[0] = static_cast<std::uint8_t>(((p >> 12) & 0xF) * 17);
+            dst[1] = static_cast<std::uint8_t>(((p >> 8) & 0xF) * 17);
+            dst[2] = static_cast<std::uint8_t>(((p >> 4) & 0xF) * 17);
+            dst[3] = static_cast<std::uint8_t>((p & 0xF) * 17);
+        }
+        break;
+
+    case PixelFormat::Rgb565:
+        for (size_t i = 0; i < count; ++i, dst += 4)
+        {
+            const std::uint16_t p = src16[i];
+            dst[0] = static_cast<std::uint8_t>(((p >> 11) & 0x1F) * 255 / 31);
+            dst[1] = static_cast<std::uint8_t>(((p >> 5) & 0x3F) * 255 / 63);
+            dst[2] = static_cast<std::uint8_t>((p & 0x1F) * 255 / 31);
+            dst[3] = 0xFF;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+//----------------------------------------------------------------------------//
+ImageAtlasBuilder::ImageAtlasBuilder(const String& name,
+                                     const Sizef& page_size,
+                                     const Sizef& max_source_size) :
+    d_name(name),
+    d_pageWidth(static_cast<unsigned int>(page_size.d_width)),
+    d_pageHeight(static_cast<unsigned int>(page_size.d_height)),
+    d_maxSourceSize(max_source_size),
+    d_rejectedCount(0)
+{
+    // a source must always fit on an empty page, padding included.
+    d_maxSourceSize.d_width = std::min(d_maxSourceSize.d_width,
+        static_cast<float>(d_pageWidth - 2 * AtlasPadding));
+    d_maxSourceSize.d_height = std::min(d_maxSourceSize.d_height,
+        static_cast<float>(d_pageHeight - 2 * AtlasPadding));
+
+    d_statistics.d_texturesBefore = 0;
+    d_statistics.d_texturesAfter = 0;
+    d_statistics.d_pageCount = 0;
+    d_statistics.d_fillRatio = 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+ImageAtlasBuilder::~ImageAtlasBuilder()
+{
+    for (Source* source : d_sources)
+        delete source;
+}
+
+//----------------------------------------------------------------------------//
+bool ImageAtlasBuilder::addImageFile(BitmapImage& image,
+                                     const String& filename,
+                                     const String& resource_group)
+{
+    Renderer& renderer = *System::getSingleton().getRenderer();
+
+    Source* source = new Source();
+    source->d_image = &image;
+
+    const bool decoded = decodeSource(*source, filename, resource_group);
+
+    if (decoded)
+    {
+        source->d_texture = &renderer.createTexture(image.getName());
+        source->d_texture->loadFromMemory(source->d_pixels.data(),
+            Sizef(static_cast<float>(source->d_width),
+                  static_cast<float>(source->d_height)),
+            Texture::PixelFormat::Rgba);
+    }
+    else
+    {
+        // let the renderer load it, or report why it can not be loaded
+        source->d_texture = &renderer.createTexture(image.getName(), filename,
+                                                    resource_group);
+    }
+
+    image.setTexture(source->d_texture);
+    image.setImageArea(Rectf(glm::vec2(0.0f, 0.0f),
+                             source->d_texture->getOriginalDataSize()));
+
+    if (!decoded || !fitsAtlas(*source))
+    {
+        delete source;
+        ++d_rejectedCount;
+        return false;
+    }
+
+    d_sources.push_back(source);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool ImageAtlasBuilder::addTexture(Texture& texture, const String& filename,
+                                   const String& resource_group)
+{
+    Source* source = new Source();
+    source->d_texture = &texture;
+    source->d_image = nullptr;
+
+    if (!decodeSource(*source, filename, resource_group) || !fitsAtlas(*source))
+    {
+        delete source;
+        ++d_rejectedCount;
+        return false;
+    }
+
+    d_sources.push_back(source);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool ImageAtlasBuilder::decodeSource(Source& source, const String& filename,
+                                     const String& resource_group) const
+{
+    System& system = System::getSingleton();
+    ResourceProvider* const provider = system.getResourceProvider();
+
+    RawDataContainer data;
+    provider->loadRawDataContainer(filename, data, resource_group);
+
+    DecodedImageTexture decoded(source.d_pixels);
+    const bool loaded = system.getImageCodec().load(data, &decoded) != nullptr;
+
+    provider->unloadRawDataContainer(data);
+
+    if (!loaded)
+        return false;
+
+    const Sizef& size = decoded.getSize();
+    source.d_width = static_cast<unsigned int>(size.d_width);
+    source.d_height = static_cast<unsigned int>(size.d_height);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool ImageAtlasBuilder::fitsAtlas(const Source& source) const
+{
+    return source.d_width <= d_maxSourceSize.d_width &&
+           source.d_height <= d_maxSourceSize.d_height;
+}
+
+//----------------------------------------------------------------------------//
+void ImageAtlasBuilder::discardImage(const Image& image)
+{
+    for (std::vector<Source*>::iterator i = d_sources.begin(); i != d_sources.end(); ++i)
+    {
+        if ((*i)->d_image == &image)
+        {
+            System::getSingleton().getRenderer()->destroyTexture(*(*i)->d_texture);
+            delete *i;
+            d_sources.erase(i);
+            return;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ImageAtlasBuilder::discardTexture(const Texture& texture)
+{
+    for (std::vector<Source*>::iterator i = d_sources.begin(); i != d_sources.end(); ++i)
+    {
+        if ((*i)->d_texture == &texture)
+        {
+            delete *i;
+            d_sources.erase(i);
+            return;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t ImageAtlasBuilder::getPendingSourceCount() const
+{
+    return d_sources.size();
+}
+
+//----------------------------------------------------------------------------//
+const ImageAtlasBuilder::Statistics& ImageAtlasBuilder::build()
+{
+    const size_t first_page = d_pages.size();
+    const size_t page_count = packSources();
+
+    for (size_t p = 0; p < page_count; ++p)
+        createPage(first_page + p);
+
+    rewriteImages(d_sources);
+
+    size_t used_area = 0;
+    for (const Source* source : d_sources)
+        used_area += static_cast<size_t>(source->d_width) * source->d_height;
+
+    const size_t page_area = static_cast<size_t>(d_pageWidth) * d_pageHeight;
+
+    d_statistics.d_texturesBefore = d_sources.size() + d_rejectedCount;
+    d_statistics.d_texturesAfter = page_count + d_rejectedCount;
+    d_statistics.d_pageCount = page_count;
+    d_statistics.d_fillRatio = page_count ?
+        static_cast<float>(used_area) / static_cast<float>(page_area * page_count) :
+        0.0f;
+
+    Logger::getSingleton().logEvent("[ImageAtlasBuilder] Atlas '" + d_name +
+        "' packed " + PropertyHelper<std::uint32_t>::toString(
+            static_cast<std::uint32_t>(d_statistics.d_texturesBefore)) +
+        " textures into " + PropertyHelper<std::uint32_t>::toString(
+            static_cast<std::uint32_t>(d_statistics.d_texturesAfter)) +
+        ", fill ratio: " + PropertyHelper<float>::toString(d_statistics.d_fillRatio));
+
+    for (Source* source : d_sources)
+        delete source;
+
+    d_sources.clear();
+    d_rejectedCount = 0;
+
+    return d_statistics;
+}
+
+//----------------------------------------------------------------------------//
+size_t ImageAtlasBuilder::packSources()
+{
+    if (d_sources.empty())
+        return 0;
+
+    // simple shelf packing: tallest sources first, filling rows left to right.
+    std::vector<Source*> sorted(d_sources);
+    std::sort(sorted.begin(), sorted.end(),
+              [](const Source* a, const Source* b)
+              { return a->d_height > b->d_height; });
+
+    size_t page = d_pages.size();
+    unsigned int shelf_y = 0;
+    unsigned int shelf_height = 0;
+    unsigned int x = 0;
+
+    for (Source* source : sorted)
+    {
+        const unsigned int w = source->d_width + 2 * AtlasPadding;
+        const unsigned int h = source->d_height + 2 * AtlasPadding;
+
+        // start a new shelf when the current one is full.
+        if (x + w > d_pageWidth)
+        {
+            shelf_y += shelf_height;
+            shelf_height = 0;
+            x = 0;
+        }
+
+        // start a new page when the shelf does not fit vertically.
+        if (shelf_y + h > d_pageHeight)
+        {
+            ++page;
+            shelf_y = 0;
+            shelf_height = 0;
+            x = 0;
+        }
+
+        source->d_page = page;
+        source->d_x = x + AtlasPadding;
+        source->d_y = shelf_y + AtlasPadding;
+
+        x += w;
+        shelf_height = std::max(shelf_height, h);
+    }
+
+    return page - d_pages.size() + 1;
+}
+
+//----------------------------------------------------------------------------//
+void ImageAtlasBuilder::createPage(size_t page_index)
+{
+    std::vector<std::uint8_t> pixels(
+        static_cast<size_t>(d_pageWidth) * d_pageHeight * 4, 0);
+    const size_t stride = static_cast<size_t>(d_pageWidth) * 4;
+
+    for (const Source* source : d_sources)
+    {
+        if (source->d_page != page_index || !source->d_width || !source->d_height)
+            continue;
+
+        const size_t row_size = static_cast<size_t>(source->d_width) * 4;
+
+        // copy the rows, extruding the first and last pixel of each row.
+        for (unsigned int row = 0; row < source->d_height; ++row)
+        {
+            const std::uint8_t* src = &source->d_pixels[row * row_size];
+            std::uint8_t* dst = &pixels[(source->d_y + row) * stride +
+                                        source->d_x * 4];
+
+            std::memcpy(dst, src, row_size);
+
+            for (unsigned int p = 1; p <= AtlasPadding; ++p)
+            {
+                std::memcpy(dst - p * 4, src, 4);
+                std::memcpy(dst + row_size + (p - 1) * 4, src + row_size - 4, 4);
+            }
+        }
+
+        // extrude the first and last rows, including the padded columns.
+        const size_t padded_row = row_size + 2 * AtlasPadding * 4;
+        const size_t left = (source->d_x - AtlasPadding) * 4;
+
+        for (unsigned int p = 1; p <= AtlasPadding; ++p)
+        {
+            std::memcpy(&pixels[(source->d_y - p) * stride + left],
+                        &pixels[source->d_y * stride + left], padded_row);
+            std::memcpy(&pixels[(source->d_y + source->d_height - 1 + p) * stride + left],
+                        &pixels[(source->d_y + source->d_height - 1) * stride + left],
+                        padded_row);
+        }
+    }
+
+    const Sizef page_size(static_cast<float>(d_pageWidth),
+                          static_cast<float>(d_pageHeight));
+
+    Texture& page = System::getSingleton().getRenderer()->createTexture(
+        d_name + "/AtlasPage" + PropertyHelper<std::uint32_t>::toString(
+            static_cast<std::uint32_t>(page_index)), page_size);
+
+    page.loadFromMemory(pixels.data(), page_size, Texture::PixelFormat::Rgba);
+    d_pages.push_back(&page);
+}
+
+//----------------------------------------------------------------------------//
+void ImageAtlasBuilder::rewriteImages(const std::vector<Source*>& sources)
+{
+    std::unordered_map<const Texture*, const Source*> texture_sources;
+
+    for (const Source* source : sources)
+        texture_sources[source->d_texture] = source;
+
+    if (texture_sources.empty())
+        return;
+
+    // move every image that used one of the atlased textures onto its page.
+    ImageManager::ImageIterator iter = ImageManager::getSingleton().getIterator();
+    for (; !iter.isAtEnd(); ++iter)
+    {
+        BitmapImage* const image = dynamic_cast<BitmapImage*>(iter.getCurrentValue().first);
+
+        if (!image)
+            continue;
+
+        auto found = texture_sources.find(image->getTexture());
+        if (found == texture_sources.end())
+            continue;
+
+        Rectf area(image->getImageArea());
+        area.offset(glm::vec2(static_cast<float>(found->second->d_x),
+                              static_cast<float>(found->second->d_y)));
+        image->setImageArea(area);
+        image->setTexture(d_pages[found->second->d_page]);
+    }
+
+    Renderer* const renderer = System::getSingleton().getRenderer();
+    for (const auto& texture_source : texture_sources)
+        renderer->destroyTexture(*const_cast<Texture*>(texture_source.first));
+}
+
+//----------------------------------------------------------------------------//
+const ImageAtlasBuilder::Statistics& ImageAtlasBuilder::getStatistics() const
+{
+    return d_statistics;
+}
+
+//----------------------------------------------------------------------------//
+const std::vector<Texture*>& ImageAtlasBuilder::getPages() const
+{
+    return d_pages;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,88 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Handle caching the Image registered under a name
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ImageHandle.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/Window.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+ImageHandle::ImageHandle() :
+    d_image(nullptr),
+    d_generation(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+ImageHandle::ImageHandle(const String& name) :
+    d_name(name),
+    d_image(nullptr),
+    d_generation(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+void ImageHandle::setName(const String& name)
+{
+    if (name == d_name)
+        return;
+
+    d_name = name;
+    d_image = nullptr;
+}
+
+//----------------------------------------------------------------------------//
+ImageHandle& ImageHandle::operator=(const String& name)
+{
+    setName(name);
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+Image& ImageHandle::get() const
+{
+    const unsigned int generation = ImageManager::getImageGeneration();
+
+    if (!d_image || d_generation != generation)
+    {
+        // handles are shared by windows built in parallel; only the main
+        // thread updates the cached pointer
+        if (Window::isGeometryBuildWorker())
+            return ImageManager::getSingleton().get(d_name);
+
+        d_image = &ImageManager::getSingleton().get(d_name);
+        d_generation = generation;
+    }
+
+    return *d_image;
+}
+
+//----------------------------------------------------------------------------//
+} // End of  CEGUI namespace section
+
@@ -25,6 +25,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/ImageManager.h"
+#include "CEGUI/ImageAtlasBuilder.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/SharedStringStream.h"
@@ -52,18 +53,7 @@ template<> ImageManager* Singleton<ImageManager>::ms_Singleton = nullptr;
 //----------------------------------------------------------------------------//
 String ImageManager::d_imagesetDefaultResourceGroup;
 
-//----------------------------------------------------------------------------//
-// predicate functor class to match items using a given prefix string.
-class ImagePrefixMatchPred
-{
-    const String d_prefix;
-
-public:
-    ImagePrefixMatchPred(const String& prefix) : d_prefix(prefix + '/') {}
-
-    bool operator()(const std::pair<String, std::pair<Image*, ImageFactory*> >& v)
-    { return v.first.find(d_prefix) == 0; }
-};
+unsigned int ImageManager::d_imageGeneration = 0;
 
 //----------------------------------------------------------------------------//
 // Internal Strings holding XML element and attribute names
@@ -101,9 +91,16 @@ static SVGData* s_SVGData = nullptr;
 static CEGUI::String s_imagesetType = "";
 static AutoScaledMode s_autoScaled = AutoScaledMode::Disabled;
 static Sizef s_nativeResolution(640.0f, 480.0f);
+static String s_imagesetFilename;
+static String s_imagesetResourceGroup;
+static bool s_imagesetTextureCreated = false;
 
 //----------------------------------------------------------------------------//
-ImageManager::ImageManager()
+ImageManager::ImageManager() :
+    d_imageAtlasingEnabled(false),
+    d_imageAtlasPageSize(1024.0f, 1024.0f),
+    d_imageAtlasMaxSourceSize(256.0f, 256.0f),
+    d_pendingImageAtlas(nullptr)
 {
     String addressStr = SharedStringstream::GetPointerAddressAsString(this);
 
@@ -121,6 +118,13 @@ ImageManager::~ImageManager()
 {
     destroyAll();
 
+    delete d_pendingImageAtlas;
+
+    // pages still used by images that were moved elsewhere.
+    for (const auto& page : d_imageAtlasPages)
+        System::getSingleton().getRenderer()->destroyTexture(
+            *const_cast<Texture*>(page.first));
+
     while (!d_factories.empty())
         removeImageType(d_factories.begin()->first);
 
@@ -166,7 +170,7 @@ Image& ImageManager::create(const String& type, const String& name)
 
     ImageFactory* factory = i->second;
     Image& image = factory->create(name);
-    d_images[name] = std::make_pair(&image, factory);
+    addImage(image, factory);
 
         String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
 
@@ -212,7 +216,7 @@ Image& ImageManager::create(const XMLAttributes& attributes)
         throw InvalidRequestException(message);
     }
 
-    d_images[name] = std::make_pair(&image, factory);
+    addImage(image, factory);
 
     String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
     Logger::getSingleton().logEvent(
@@ -222,6 +226,20 @@ Image& ImageManager::create(const XMLAttributes& attributes)
     return image;
 }
 
+//----------------------------------------------------------------------------//
+void ImageManager::addImage(Image& image, ImageFactory* factory)
+{
+    const String& name = image.getName();
+
+    d_images[name] = std::make_pair(&image, factory);
+
+    for (String::size_type pos = name.find('/'); pos != String::npos;
+         pos = name.find('/', pos + 1))
+    {
+        d_imageCollections[name.substr(0, pos)][name] = &image;
+    }
+}
+
 //----------------------------------------------------------------------------//
 void ImageManager::destroy(Image& image)
 {
@@ -243,10 +261,37 @@ void ImageManager::destroy(ImageMap::iterator& iter)
     Logger::getSingleton().logEvent(
         "[ImageManager] Deleted image: " + iter->first);
 
+    if (d_pendingImageAtlas)
+        d_pendingImageAtlas->discardImage(*iter->second.first);
+
+    const Texture* atlas_page = nullptr;
+    const auto atlased = d_atlasedImages.find(iter->second.first);
+    if (atlased != d_atlasedImages.end())
+    {
+        atlas_page = atlased->second;
+        d_atlasedImages.erase(atlased);
+    }
+
+    const String& name = iter->first;
+
+    for (String::size_type pos = name.find('/'); pos != String::npos;
+         pos = name.find('/', pos + 1))
+    {
+        const auto collection = d_imageCollections.find(name.substr(0, pos));
+        collection->second.erase(name);
+
+        if (collection->second.empty())
+            d_imageCollections.erase(collection);
+    }
+
     // use the stored factory to destroy the image it created.
     iter->second.second->destroy(*iter->second.first);
 
     d_images.erase(iter);
+    ++d_imageGeneration;
+
+    if (atlas_page)
+        releaseImageAtlasPage(*atlas_page);
 }
 
 //----------------------------------------------------------------------------//
@@ -303,24 +348,59 @@ void ImageManager::destroyImageCollection(const String& prefix,
     Logger::getSingleton().logEvent(
         "[ImageManager] Destroying image collection with prefix: " + prefix);
 
-    ImagePrefixMatchPred p(prefix);
-
-    ImageMap::iterator i;
-    while ((i = std::find_if(d_images.begin(), d_images.end(), p)) != d_images.end())
-        destroy(i);
+    const auto collection = d_imageCollections.find(prefix);
+    if (collection != d_imageCollections.end())
+    {
+        // copy the names; destroying the last image erases the collection.
+        std::vector<String> names;
+        names.reserve(collection->second.size());
+        for (const auto& entry : collection->second)
+            names.push_back(entry.first);
+
+        for (const String& name : names)
+            destroy(name);
+    }
 
     if (delete_texture)
-        System::getSingleton().getRenderer()->destroyTexture(prefix);
+    {
+        Renderer* const renderer = System::getSingleton().getRenderer();
+
+        if (d_pendingImageAtlas && renderer->isTextureDefined(prefix))
+            d_pendingImageAtlas->discardTexture(renderer->getTexture(prefix));
+
+        renderer->destroyTexture(prefix);
+    }
 }
 
 //----------------------------------------------------------------------------//
 void ImageManager::addBitmapImageFromFile(const String& name, const String& filename,
                                     const String& resource_group)
 {
+    const String& group = resource_group.empty() ?
+        d_imagesetDefaultResourceGroup : resource_group;
+
+    if (d_imageAtlasingEnabled)
+    {
+        BitmapImage& image = static_cast<BitmapImage&>(create("BitmapImage", name));
+
+        try
+        {
+            // the image keeps a texture of its own if it is too large for the
+            // atlas, and uses it until the atlas is built otherwise.
+            getPendingImageAtlas().addImageFile(image, filename, group);
+        }
+        catch (...)
+        {
+            destroy(name);
+            throw;
+        }
+
+        return;
+    }
+
     // create texture from image
     Texture* tex = &System::getSingleton().getRenderer()->
-        createTexture(name, filename,
-            resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group);
+        createTexture(name, filename, group);
 
     BitmapImage& image = static_cast<BitmapImage&>(create("BitmapImage", name));
     image.setTexture(tex);
@@ -328,6 +408,125 @@ void ImageManager::addBitmapImageFromFile(const String& name, const String& file
     image.setImageArea(rect);
 }
 
+//----------------------------------------------------------------------------//
+void ImageManager::setImageAtlasingEnabled(bool enabled)
+{
+    d_imageAtlasingEnabled = enabled;
+}
+
+//----------------------------------------------------------------------------//
+bool ImageManager::isImageAtlasingEnabled() const
+{
+    return d_imageAtlasingEnabled;
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::setImageAtlasPageSize(const Sizef& size)
+{
+    d_imageAtlasPageSize = size;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& ImageManager::getImageAtlasPageSize() const
+{
+    return d_imageAtlasPageSize;
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::setImageAtlasMaxSourceSize(const Sizef& size)
+{
+    d_imageAtlasMaxSourceSize = size;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& ImageManager::getImageAtlasMaxSourceSize() const
+{
+    return d_imageAtlasMaxSourceSize;
+}
+
+//----------------------------------------------------------------------------//
+ImageAtlasBuilder& ImageManager::getPendingImageAtlas()
+{
+    if (!d_pendingImageAtlas)
+    {
+        static std::uint32_t atlasNumber = 0;
+
+        d_pendingImageAtlas = new ImageAtlasBuilder(
+            "ImageAtlas" + PropertyHelper<std::uint32_t>::toString(atlasNumber++),
+            d_imageAtlasPageSize, d_imageAtlasMaxSourceSize);
+    }
+
+    return *d_pendingImageAtlas;
+}
+
+//----------------------------------------------------------------------------//
+ImageAtlasStatistics ImageManager::buildImageAtlas()
+{
+    ImageAtlasStatistics stats = { 0, 0, 0, 0.0f };
+
+    if (!d_pendingImageAtlas)
+        return stats;
+
+    stats = d_pendingImageAtlas->build();
+
+    const std::vector<Texture*>& pages = d_pendingImageAtlas->getPages();
+    for (const Texture* page : pages)
+        d_imageAtlasPages[page] = 0;
+
+    delete d_pendingImageAtlas;
+    d_pendingImageAtlas = nullptr;
+
+    // count the images on each new page, so it goes with the last of them.
+    if (!pages.empty())
+    {
+        for (const ImageMap::value_type& entry : d_images)
+        {
+            const BitmapImage* const image =
+                dynamic_cast<const BitmapImage*>(entry.second.first);
+
+            if (!image || d_atlasedImages.count(image))
+                continue;
+
+            const auto page = d_imageAtlasPages.find(image->getTexture());
+            if (page == d_imageAtlasPages.end())
+                continue;
+
+            ++page->second;
+            d_atlasedImages[image] = page->first;
+        }
+    }
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::releaseImageAtlasPage(const Texture& page)
+{
+    const auto found = d_imageAtlasPages.find(&page);
+
+    if (found == d_imageAtlasPages.end() || --found->second != 0)
+        return;
+
+    // images may have been pointed at the page since it was built.
+    for (const ImageMap::value_type& entry : d_images)
+    {
+        const BitmapImage* const image =
+            dynamic_cast<const BitmapImage*>(entry.second.first);
+
+        if (image && image->getTexture() == &page && !d_atlasedImages.count(image))
+        {
+            ++found->second;
+            d_atlasedImages[image] = &page;
+        }
+    }
+
+    if (found->second != 0)
+        return;
+
+    d_imageAtlasPages.erase(found);
+    System::getSingleton().getRenderer()->destroyTexture(const_cast<Texture&>(page));
+}
+
 //----------------------------------------------------------------------------//
 void ImageManager::notifyDisplaySizeChanged(const Sizef& size)
 {
@@ -353,6 +552,19 @@ ImageManager::ImageIterator ImageManager::getIterator() const
     return ImageIterator(d_images.begin(), d_images.end());
 }
 
+//----------------------------------------------------------------------------//
+ImageManager::ImageCollectionIterator ImageManager::getCollectionIterator(
+    const String& prefix) const
+{
+    static const ImageCollection noImages;
+
+    const auto collection = d_imageCollections.find(prefix);
+    const ImageCollection& images = (collection == d_imageCollections.end()) ?
+        noImages : collection->second;
+
+    return ImageCollectionIterator(images.begin(), images.end());
+}
+
 //----------------------------------------------------------------------------//
 void ImageManager::elementStartLocal(const String& element,
                                      const XMLAttributes& attributes)
@@ -373,7 +585,22 @@ void ImageManager::elementEndLocal(const String& element)
     // ensure that everything is reset to default values when the Imageset ends
     if (element == ImagesetElement)
     {
+        // queue small bitmap imagesets for packing into an atlas.
+        if (d_imageAtlasingEnabled && s_imagesetTextureCreated && s_texture)
+        {
+            const Sizef& size = s_texture->getOriginalDataSize();
+
+            if (size.d_width <= d_imageAtlasMaxSourceSize.d_width &&
+                size.d_height <= d_imageAtlasMaxSourceSize.d_height)
+            {
+                getPendingImageAtlas().addTexture(*s_texture, s_imagesetFilename,
+                    s_imagesetResourceGroup.empty() ? d_imagesetDefaultResourceGroup :
+                    s_imagesetResourceGroup);
+            }
+        }
+
         s_texture = nullptr;
+        s_imagesetTextureCreated = false;
         s_SVGData = nullptr;
         s_imagesetType = "";
     }
@@ -404,6 +631,9 @@ void ImageManager::elementImagesetStart(const XMLAttributes& attributes)
 
     validateImagesetFileVersion(attributes);
 
+    s_imagesetFilename = filename;
+    s_imagesetResourceGroup = resource_group;
+
     if(s_imagesetType == "BitmapImage")
         retrieveImagesetTexture(name, filename, resource_group);
     else if(s_imagesetType == "SVGImage")
@@ -505,6 +735,7 @@ void ImageManager::retrieveImagesetTexture(const String& name, const String& fil
         Logger::getSingleton().logEvent(
             "[ImageManager] WARNING: Using existing texture: " + name);
         s_texture = &renderer->getTexture(name);
+        s_imagesetTextureCreated = false;
     }
     else
     {
@@ -512,6 +743,7 @@ void ImageManager::retrieveImagesetTexture(const String& name, const String& fil
         s_texture = &renderer->createTexture(name, filename,
             resource_group.empty() ? d_imagesetDefaultResourceGroup :
             resource_group);
+        s_imagesetTextureCreated = true;
     }
 }
 
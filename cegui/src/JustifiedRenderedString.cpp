@@ -26,6 +26,7 @@
  ***************************************************************************/
 #include "CEGUI/JustifiedRenderedString.h"
 #include "CEGUI/RenderedString.h"
+#include "CEGUI/Profiler.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -40,6 +41,8 @@ JustifiedRenderedString::JustifiedRenderedString(const RenderedString& string) :
 void JustifiedRenderedString::format(const Window* ref_wnd,
                                      const Sizef& area_size)
 {
+    CEGUI_PROFILE_ZONE("FormattedRenderedString::format");
+
     d_spaceExtras.clear();
 
     for (size_t i = 0; i < d_renderedString->getLineCount(); ++i)
@@ -40,6 +40,8 @@ void RenderedStringWordWrapper<JustifiedRenderedString>::format(
                                                         const Window* ref_wnd,
                                                         const Sizef& area_size)
 {
+    CEGUI_PROFILE_ZONE("RenderedStringWordWrapper::format");
+
     deleteFormatters();
 
     RenderedString rstring, lstring;
@@ -26,6 +26,7 @@
  ***************************************************************************/
 #include "CEGUI/LeftAlignedRenderedString.h"
 #include "CEGUI/RenderedString.h"
+#include "CEGUI/Profiler.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -41,6 +42,8 @@ LeftAlignedRenderedString::LeftAlignedRenderedString(
 void LeftAlignedRenderedString::format(const Window* /*ref_wnd*/,
                                        const Sizef& /*area_size*/)
 {
+    CEGUI_PROFILE_ZONE("FormattedRenderedString::format");
+
 }
 
 //----------------------------------------------------------------------------//
@@ -35,9 +35,15 @@
 
 #include "minizip/unzip.h"
 
+#include <condition_variable>
 #include <fstream>
+#include <mutex>
+#include <unordered_map>
+#include <cstring>
 
 #if defined (__WIN32__) || defined(_WIN32)
+#   include "CEGUI/System.h"
+#   include <windows.h>
 #   include <shlwapi.h>
 #   define FNMATCH(p, s)    PathMatchSpec(s, p)
 #   ifdef _MSC_VER
@@ -46,26 +52,339 @@
 #else
 #   include <fnmatch.h>
 #   define FNMATCH(p, s)    fnmatch(p, s, FNM_PATHNAME)
+#   if !defined(__ANDROID__)
+#       define CEGUI_MINIZIP_USE_MMAP
+#       include <sys/mman.h>
+#       include <sys/stat.h>
+#       include <fcntl.h>
+#       include <unistd.h>
+#   endif
 #endif
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+// zip format constants needed to locate stored (uncompressed) entry data
+// directly inside the memory mapped archive.
+static const std::uint32_t ZIP_LOCAL_HEADER_SIGNATURE = 0x04034b50;
+static const std::uint32_t ZIP_CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+static const size_t ZIP_LOCAL_HEADER_SIZE = 30;
+static const size_t ZIP_CENTRAL_HEADER_SIZE = 46;
+
+//----------------------------------------------------------------------------//
+static std::uint16_t readLittleEndian16(const std::uint8_t* p)
+{
+    return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+}
+
+//----------------------------------------------------------------------------//
+static std::uint32_t readLittleEndian32(const std::uint8_t* p)
+{
+    return static_cast<std::uint32_t>(p[0]) |
+           (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) |
+           (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+//----------------------------------------------------------------------------//
+// Return the key \a name is indexed under. unzLocateFile, which the index
+// replaces, compares names ignoring ASCII case on Windows, so keys are folded
+// there to keep archives that relied on it loading.
+static String getEntryKey(const String& name)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    String key(name);
+    for (auto& c : key)
+        if (c >= 'A' && c <= 'Z')
+            c = c - 'A' + 'a';
+
+    return key;
+#else
+    return name;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// Return whether \a name starts with \a prefix, ignoring ASCII case where
+// getEntryKey does.
+static bool hasEntryPrefix(const String& name, const String& prefix)
+{
+    if (name.length() < prefix.length())
+        return false;
+
+#if defined(__WIN32__) || defined(_WIN32)
+    for (size_t i = 0; i < prefix.length(); ++i)
+    {
+        auto a = name[i];
+        auto b = prefix[i];
+        if (a >= 'A' && a <= 'Z')
+            a = a - 'A' + 'a';
+        if (b >= 'A' && b <= 'Z')
+            b = b - 'A' + 'a';
+        if (a != b)
+            return false;
+    }
+
+    return true;
+#else
+    return name.compare(0, prefix.length(), prefix) == 0;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// Information about a single file in the archive, collected once when the
+// archive is set so that look-ups do not need to scan the central directory.
+struct ArchiveEntry
+{
+    //! position of the entry's central directory record, for unzGoToFilePos64.
+    unz64_file_pos d_position;
+    //! size of the entry's data once extracted.
+    std::uint64_t d_uncompressedSize;
+    //! offset into the mapped archive of the entry's raw data, when the entry
+    //! is stored (not compressed, not encrypted); 0 otherwise.
+    std::uint64_t d_storedDataOffset;
+};
+
 //----------------------------------------------------------------------------//
 // Impl struct: mainly used in order to keep unzip.h out of the public headers.
 struct MinizipResourceProvider::Impl
 {
     Impl(const bool loadLocal) :
         d_zfile(0),
-        d_loadLocal(loadLocal)
+        d_loadLocal(loadLocal),
+        d_busyHandleCount(0),
+        d_mappedData(nullptr),
+        d_mappedSize(0)
+#if defined(__WIN32__) || defined(_WIN32)
+        , d_fileHandle(INVALID_HANDLE_VALUE),
+        d_mappingHandle(0)
+#endif
     {
     }
 
+    unzFile openHandle() const;
+    unzFile acquireHandle();
+    void releaseHandle(unzFile handle);
+    void closeHandles();
+
+    void mapArchive();
+    void unmapArchive();
+    std::uint64_t findStoredDataOffset(std::uint64_t centralHeaderPos) const;
+
+    typedef std::unordered_map<String, ArchiveEntry> EntryMap;
+
+    //! handle used to build the index, kept in the pool afterwards.
     unzFile d_zfile;
     String  d_archive;
     bool    d_loadLocal;
+
+    //! index of all entries in the archive, keyed by getEntryKey of their
+    //! full path within it.
+    EntryMap d_entries;
+    //! names of all entries, in central directory order.
+    std::vector<String> d_entryNames;
+
+    //! archive handles not currently in use by any thread.
+    std::vector<unzFile> d_freeHandles;
+    //! number of handles currently taken out of the pool by loading threads.
+    size_t d_busyHandleCount;
+    std::mutex d_handlesMutex;
+    std::condition_variable d_handleReleased;
+
+    //! read-only view of the whole archive, or nullptr if mapping failed.
+    const std::uint8_t* d_mappedData;
+    size_t d_mappedSize;
+#if defined(__WIN32__) || defined(_WIN32)
+    HANDLE d_fileHandle;
+    HANDLE d_mappingHandle;
+#endif
 };
 
+//----------------------------------------------------------------------------//
+unzFile MinizipResourceProvider::Impl::openHandle() const
+{
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
+    return unzOpen64(d_archive.c_str());
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    return unzOpen64(String::convertUtf32ToUtf8(d_archive.getString()).c_str());
+#endif
+}
+
+//----------------------------------------------------------------------------//
+unzFile MinizipResourceProvider::Impl::acquireHandle()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_handlesMutex);
+
+        ++d_busyHandleCount;
+
+        if (!d_freeHandles.empty())
+        {
+            unzFile handle = d_freeHandles.back();
+            d_freeHandles.pop_back();
+            return handle;
+        }
+    }
+
+    // all pooled handles are busy in other threads; open another one.
+    unzFile handle = openHandle();
+
+    if (handle == 0)
+    {
+        releaseHandle(0);
+        throw FileIOException("'" + d_archive + "' could not be reopened");
+    }
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------//
+void MinizipResourceProvider::Impl::releaseHandle(unzFile handle)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_handlesMutex);
+
+        if (handle != 0)
+            d_freeHandles.push_back(handle);
+
+        --d_busyHandleCount;
+    }
+
+    d_handleReleased.notify_all();
+}
+
+//----------------------------------------------------------------------------//
+void MinizipResourceProvider::Impl::closeHandles()
+{
+    std::unique_lock<std::mutex> lock(d_handlesMutex);
+
+    // handles taken by loads still running in other threads come back to the
+    // pool when those loads finish; wait for them so that they get closed too.
+    d_handleReleased.wait(lock, [this] { return d_busyHandleCount == 0; });
+
+    bool errorOccured = false;
+    for (unzFile handle : d_freeHandles)
+        errorOccured |= (unzClose(handle) != UNZ_OK);
+
+    d_freeHandles.clear();
+    d_zfile = 0;
+
+    // do not throw an exception as this is called from the destructor!
+    if (errorOccured && CEGUI::Logger::getSingletonPtr())
+    {
+        CEGUI::Logger::getSingleton().logEvent(
+            "MinizipResourceProvider::closeArchive: '" +
+            d_archive + "' error upon closing", LoggingLevel::Error);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void MinizipResourceProvider::Impl::mapArchive()
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    d_fileHandle = CreateFileW(
+        System::getStringTranscoder().stringToStdWString(d_archive).c_str(),
+        GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, 0);
+
+    if (d_fileHandle == INVALID_HANDLE_VALUE)
+        return;
+
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(d_fileHandle, &size) && size.QuadPart > 0)
+    {
+        d_mappingHandle = CreateFileMappingW(d_fileHandle, 0, PAGE_READONLY,
+                                             0, 0, 0);
+
+        if (d_mappingHandle)
+        {
+            d_mappedData = static_cast<const std::uint8_t*>(
+                MapViewOfFile(d_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+            d_mappedSize = static_cast<size_t>(size.QuadPart);
+        }
+    }
+
+    if (!d_mappedData)
+        unmapArchive();
+#elif defined(CEGUI_MINIZIP_USE_MMAP)
+#   if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    const int fd = open(String::convertUtf32ToUtf8(d_archive.getString()).c_str(), O_RDONLY);
+#   else
+    const int fd = open(d_archive.c_str(), O_RDONLY);
+#   endif
+
+    if (fd == -1)
+        return;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        void* const data = mmap(0, static_cast<size_t>(fileStat.st_size),
+                                PROT_READ, MAP_SHARED, fd, 0);
+
+        if (data != MAP_FAILED)
+        {
+            d_mappedData = static_cast<const std::uint8_t*>(data);
+            d_mappedSize = static_cast<size_t>(fileStat.st_size);
+        }
+    }
+
+    // the mapping stays valid after the descriptor is closed.
+    close(fd);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void MinizipResourceProvider::Impl::unmapArchive()
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    if (d_mappedData)
+        UnmapViewOfFile(d_mappedData);
+
+    if (d_mappingHandle)
+        CloseHandle(d_mappingHandle);
+
+    if (d_fileHandle != INVALID_HANDLE_VALUE)
+        CloseHandle(d_fileHandle);
+
+    d_mappingHandle = 0;
+    d_fileHandle = INVALID_HANDLE_VALUE;
+#elif defined(CEGUI_MINIZIP_USE_MMAP)
+    if (d_mappedData)
+        munmap(const_cast<std::uint8_t*>(d_mappedData), d_mappedSize);
+#endif
+
+    d_mappedData = nullptr;
+    d_mappedSize = 0;
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t MinizipResourceProvider::Impl::findStoredDataOffset(
+    std::uint64_t centralHeaderPos) const
+{
+    if (!d_mappedData ||
+        centralHeaderPos + ZIP_CENTRAL_HEADER_SIZE > d_mappedSize)
+        return 0;
+
+    const std::uint8_t* const central = d_mappedData + centralHeaderPos;
+    if (readLittleEndian32(central) != ZIP_CENTRAL_HEADER_SIGNATURE)
+        return 0;
+
+    // entries whose offset lives in a zip64 extra field are left to minizip.
+    const std::uint64_t localHeaderPos = readLittleEndian32(central + 42);
+    if (localHeaderPos == 0xFFFFFFFF ||
+        localHeaderPos + ZIP_LOCAL_HEADER_SIZE > d_mappedSize)
+        return 0;
+
+    const std::uint8_t* const local = d_mappedData + localHeaderPos;
+    if (readLittleEndian32(local) != ZIP_LOCAL_HEADER_SIGNATURE)
+        return 0;
+
+    return localHeaderPos + ZIP_LOCAL_HEADER_SIZE +
+        readLittleEndian16(local + 26) + readLittleEndian16(local + 28);
+}
+
 //----------------------------------------------------------------------------//
 // Helper function that matches names against the pattern.
 bool nameMatchesPattern(const String& name, const String& pattern)
@@ -129,34 +448,82 @@ bool MinizipResourceProvider::doesFileExist(const String& filename)
 //----------------------------------------------------------------------------//
 void MinizipResourceProvider::openArchive()
 {
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
-    d_pimpl->d_zfile = unzOpen(d_pimpl->d_archive.c_str());
-#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-    d_pimpl->d_zfile = unzOpen(String::convertUtf32ToUtf8(d_pimpl->d_archive.getString()).c_str());
-#endif
+    d_pimpl->d_zfile = d_pimpl->openHandle();
 
     if (d_pimpl->d_zfile == 0)
     {
         throw InvalidRequestException(
             "'" + d_pimpl->d_archive + "' does not exist");
     }
+
+    d_pimpl->mapArchive();
+    buildArchiveIndex();
+
+    d_pimpl->d_freeHandles.push_back(d_pimpl->d_zfile);
 }
 
 //----------------------------------------------------------------------------//
 void MinizipResourceProvider::closeArchive()
 {
-    if (unzClose(d_pimpl->d_zfile) != Z_OK)
+    d_pimpl->closeHandles();
+    d_pimpl->unmapArchive();
+    d_pimpl->d_entries.clear();
+    d_pimpl->d_entryNames.clear();
+}
+
+//----------------------------------------------------------------------------//
+void MinizipResourceProvider::buildArchiveIndex()
+{
+    unzFile zfile = d_pimpl->d_zfile;
+
+    unz_global_info64 global_info;
+    if (unzGetGlobalInfo64(zfile, &global_info) == UNZ_OK)
     {
-        // do not throw an exception as this method is called from the destructor!
-        if (CEGUI::Logger::getSingletonPtr())
+        d_pimpl->d_entries.reserve(static_cast<size_t>(global_info.number_entry));
+        d_pimpl->d_entryNames.reserve(static_cast<size_t>(global_info.number_entry));
+    }
+
+    if (unzGoToFirstFile(zfile) != UNZ_OK)
+        return;
+
+    char current_name[1024];
+    unz_file_info64 file_info;
+
+    do
+    {
+        ArchiveEntry entry;
+
+        if (unzGetCurrentFileInfo64(zfile, &file_info,
+                                    current_name, sizeof(current_name),
+                                    0, 0, 0, 0) != UNZ_OK ||
+            unzGetFilePos64(zfile, &entry.d_position) != UNZ_OK)
         {
-            CEGUI::Logger::getSingleton().logEvent(
-                "MinizipResourceProvider::closeArchive: '" +
-                d_pimpl->d_archive + "' error upon closing", LoggingLevel::Error);
+            Logger::getSingleton().logEvent(
+                "MinizipResourceProvider::buildArchiveIndex: failed to read "
+                "the central directory of '" + d_pimpl->d_archive +
+                "', the index is incomplete.", LoggingLevel::Error);
+
+            return;
         }
-    }
 
-    d_pimpl->d_zfile = 0;
+        entry.d_uncompressedSize = file_info.uncompressed_size;
+
+        // stored, unencrypted entries can be copied straight out of the
+        // mapped archive without going through minizip at all.
+        const bool isStored = file_info.compression_method == 0 &&
+                              (file_info.flag & 1) == 0 &&
+                              file_info.compressed_size == file_info.uncompressed_size;
+        entry.d_storedDataOffset = isStored ?
+            d_pimpl->findStoredDataOffset(unzGetOffset64(zfile)) : 0;
+
+        if (entry.d_storedDataOffset + entry.d_uncompressedSize > d_pimpl->d_mappedSize)
+            entry.d_storedDataOffset = 0;
+
+        const String name(current_name);
+        if (d_pimpl->d_entries.insert(std::make_pair(getEntryKey(name), entry)).second)
+            d_pimpl->d_entryNames.push_back(name);
+    }
+    while (unzGoToNextFile(zfile) == UNZ_OK);
 }
 
 //----------------------------------------------------------------------------//
@@ -181,44 +548,51 @@ void MinizipResourceProvider::loadRawDataContainer(const String& filename,
             "loaded because the archive has not been set");
     }
 
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
-    if (unzLocateFile(d_pimpl->d_zfile, final_filename.c_str(), 0) != UNZ_OK)
-#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-    if (unzLocateFile(d_pimpl->d_zfile, String::convertUtf32ToUtf8(final_filename.getString()).c_str(), 0) != UNZ_OK)
-#endif
+    Impl::EntryMap::const_iterator iter =
+        d_pimpl->d_entries.find(getEntryKey(final_filename));
+
+    if (iter == d_pimpl->d_entries.end())
     {
         throw InvalidRequestException("'" + final_filename +
             "' does not exist");
     }
 
-    unz_file_info file_info;
+    const ArchiveEntry& entry = iter->second;
+    const size_t size = static_cast<size_t>(entry.d_uncompressedSize);
+    std::uint8_t* buffer = new std::uint8_t[size];
 
-    if (unzGetCurrentFileInfo(d_pimpl->d_zfile, &file_info,
-                              0, 0, 0, 0, 0, 0) != UNZ_OK)
+    if (entry.d_storedDataOffset != 0)
     {
-        throw FileIOException("'" + final_filename +
-            "' error reading file header");
-    }
+        std::memcpy(buffer, d_pimpl->d_mappedData + entry.d_storedDataOffset, size);
 
-    if (unzOpenCurrentFile(d_pimpl->d_zfile) != Z_OK)
-    {
-        throw FileIOException("'" + final_filename +
-            "' error opening file");
+        output.setData(buffer);
+        output.setSize(size);
+        return;
     }
 
-    std::uint64_t size = file_info.uncompressed_size;
-    std::uint8_t* buffer = new std::uint8_t[size];
+    unzFile zfile = d_pimpl->acquireHandle();
+    const char* error = nullptr;
 
-    if (unzReadCurrentFile(d_pimpl->d_zfile, buffer, size) < 0)
+    unz64_file_pos position = entry.d_position;
+    if (unzGoToFilePos64(zfile, &position) != UNZ_OK)
+        error = "' error locating file";
+    else if (unzOpenCurrentFile(zfile) != UNZ_OK)
+        error = "' error opening file";
+    else
     {
-        throw FileIOException("'" + final_filename +
-            "' error reading file");
+        if (unzReadCurrentFile(zfile, buffer, static_cast<unsigned>(size)) < 0)
+            error = "' error reading file";
+
+        if (unzCloseCurrentFile(zfile) != UNZ_OK && !error)
+            error = "' error validating file";
     }
 
-    if (unzCloseCurrentFile(d_pimpl->d_zfile) != UNZ_OK)
+    d_pimpl->releaseHandle(zfile);
+
+    if (error)
     {
-        throw GenericException("'" + final_filename +
-            "' error validating file");
+        delete[] buffer;
+        throw FileIOException("'" + final_filename + error);
     }
 
     output.setData(buffer);
@@ -250,39 +624,22 @@ size_t MinizipResourceProvider::getResourceGroupFileNames(
     if (!d_pimpl->d_zfile)
         return entries;
 
-    char current_name[1024];
-    unz_file_info file_info;
-    
-    if (unzGoToFirstFile(d_pimpl->d_zfile) != UNZ_OK)
-    {
-        Logger::getSingleton().logEvent(
-            "MinizipResourceProvider::getResourceGroupFileNames: "
-            "unzGoToFirstFile failed, skipping zip file scan.", LoggingLevel::Error);
-
-        return entries;
-    }
+    const String full_pattern(dir_name + file_pattern);
 
-    do
+    for (const String& name : d_pimpl->d_entryNames)
     {
-        if (unzGetCurrentFileInfo(d_pimpl->d_zfile, &file_info,
-                                  current_name, 1024, 0, 0, 0, 0) != UNZ_OK)
-        {
-            Logger::getSingleton().logEvent(
-                "MinizipResourceProvider::getResourceGroupFileNames: "
-                "unzGetCurrentFileInfo failed, terminating scan.", LoggingLevel::Error);
-
-            return entries;
-        }
+        // skip names outside the resource directory without invoking fnmatch.
+        if (!hasEntryPrefix(name, dir_name))
+            continue;
 
         // skip this file if it does not match the pattern.
-        if (!nameMatchesPattern(current_name, dir_name + file_pattern))
+        if (!nameMatchesPattern(name, full_pattern))
             continue;
 
         // strip the resource directory name and append the matched file
-        out_vec.push_back(String(current_name).substr(dir_name.length()));
+        out_vec.push_back(name.substr(dir_name.length()));
         ++entries;
     }
-    while (unzGoToNextFile(d_pimpl->d_zfile) == UNZ_OK);
 
     return entries;
 }
@@ -293,6 +650,12 @@ void MinizipResourceProvider::setLoadLocal(bool load)
     d_pimpl->d_loadLocal = load;
 }
 
+//----------------------------------------------------------------------------//
+size_t MinizipResourceProvider::getArchiveEntryCount() const
+{
+    return d_pimpl->d_entryNames.size();
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
@@ -0,0 +1,365 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Implementation of the lightweight frame profiler
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Profiler.h"
+#include "CEGUI/Exceptions.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <string>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// Singleton instance pointer
+template<> Profiler* Singleton<Profiler>::ms_Singleton = nullptr;
+
+//----------------------------------------------------------------------------//
+static const char* const CounterNames[] =
+{
+    "GeometryBuffersCreated",
+    "Vertices",
+    "DrawCalls",
+    "TextureUploads",
+    "PropertyStringConversions"
+};
+
+static const int CounterCount = static_cast<int>(ProfilerCounter::Count);
+
+//----------------------------------------------------------------------------//
+static std::string toUtf8String(const String& str)
+{
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    return String::convertUtf32ToUtf8(str.getString());
+#else
+    return std::string(str.c_str());
+#endif
+}
+
+//----------------------------------------------------------------------------//
+static void writeJsonString(std::ostream& out, const char* str)
+{
+    out << '"';
+    for (; *str; ++str)
+    {
+        const unsigned char c = static_cast<unsigned char>(*str);
+        if (c == '"' || c == '\\')
+            out << '\\' << *str;
+        else if (c < 0x20)
+        {
+            static const char* const hex = "0123456789abcdef";
+            out << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+        }
+        else
+            out << *str;
+    }
+    out << '"';
+}
+
+//----------------------------------------------------------------------------//
+Profiler::Profiler() :
+    d_enabled(false),
+    d_traceCaptureEnabled(false),
+    d_maxTraceEvents(100000),
+    d_droppedTraceEvents(0),
+    d_frameCount(0),
+    d_epoch(Clock::now())
+{
+    resetCounters();
+}
+
+//----------------------------------------------------------------------------//
+Profiler::~Profiler()
+{
+}
+
+//----------------------------------------------------------------------------//
+Profiler& Profiler::getSingleton()
+{
+    return Singleton<Profiler>::getSingleton();
+}
+
+//----------------------------------------------------------------------------//
+Profiler* Profiler::getSingletonPtr()
+{
+    return Singleton<Profiler>::getSingletonPtr();
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::setEnabled(bool setting)
+{
+    if (d_enabled == setting)
+        return;
+
+    d_enabled = setting;
+
+    if (d_enabled)
+    {
+        d_frameCount = 0;
+        std::copy(d_counters, d_counters + CounterCount, d_frameCounterBase);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::setTraceCaptureEnabled(bool setting)
+{
+    d_traceCaptureEnabled = setting;
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::setMaxTraceEvents(std::size_t count)
+{
+    d_maxTraceEvents = count;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t Profiler::getMaxTraceEvents() const
+{
+    return d_maxTraceEvents;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t Profiler::getTraceEventCount() const
+{
+    return d_traceEvents.size();
+}
+
+//----------------------------------------------------------------------------//
+std::size_t Profiler::getDroppedTraceEventCount() const
+{
+    return d_droppedTraceEvents;
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::clearTrace()
+{
+    d_traceEvents.clear();
+    d_counterSamples.clear();
+    d_droppedTraceEvents = 0;
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::writeChromeTrace(std::ostream& out) const
+{
+    // timestamps are microseconds since the epoch; the default format would
+    // lose resolution, and eventually whole zones, once they pass 1e6.
+    const std::ios_base::fmtflags flags(out.flags());
+    const std::streamsize precision(out.precision());
+    out << std::fixed << std::setprecision(3);
+
+    out << "{\"traceEvents\":[";
+
+    bool first = true;
+    for (const TraceEvent& event : d_traceEvents)
+    {
+        out << (first ? "\n" : ",\n") << "{\"name\":";
+        writeJsonString(out, event.name);
+        out << ",\"cat\":\"CEGUI\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+            << ",\"ts\":" << event.start << ",\"dur\":" << event.duration;
+
+        if (!event.windowType.empty())
+        {
+            out << ",\"args\":{\"windowType\":";
+            writeJsonString(out, toUtf8String(event.windowType).c_str());
+            out << '}';
+        }
+
+        out << '}';
+        first = false;
+    }
+
+    for (const CounterSample& sample : d_counterSamples)
+    {
+        for (int i = 0; i < CounterCount; ++i)
+        {
+            out << (first ? "\n" : ",\n") << "{\"name\":\"" << CounterNames[i]
+                << "\",\"cat\":\"CEGUI\",\"ph\":\"C\",\"pid\":1,\"tid\":1"
+                << ",\"ts\":" << sample.time
+                << ",\"args\":{\"value\":" << sample.values[i] << "}}";
+            first = false;
+        }
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::saveChromeTrace(const String& filename) const
+{
+    std::ofstream out(toUtf8String(filename).c_str(), std::ios::binary);
+
+    if (!out)
+        throw FileIOException(
+            "Unable to open file '" + filename + "' for writing the trace.");
+
+    writeChromeTrace(out);
+}
+
+//----------------------------------------------------------------------------//
+std::vector<Profiler::ZoneStatistics> Profiler::getZoneStatistics() const
+{
+    std::vector<ZoneStatistics> result;
+
+    for (const ZoneStatisticsMap::value_type& zone : d_zoneStatistics)
+        for (const WindowTypeStatisticsMap::value_type& type : zone.second)
+            result.push_back(type.second);
+
+    return result;
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::resetZoneStatistics()
+{
+    d_zoneStatistics.clear();
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t Profiler::getCounter(ProfilerCounter counter) const
+{
+    return d_counters[static_cast<int>(counter)];
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::resetCounters()
+{
+    std::fill(d_counters, d_counters + CounterCount, 0);
+    std::fill(d_frameCounterBase, d_frameCounterBase + CounterCount, 0);
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::endFrame()
+{
+    if (!d_enabled)
+        return;
+
+    ++d_frameCount;
+
+    if (d_traceCaptureEnabled)
+    {
+        CounterSample sample;
+        sample.time = toTraceTime(Clock::now());
+        for (int i = 0; i < CounterCount; ++i)
+            sample.values[i] = d_counters[i] - d_frameCounterBase[i];
+
+        d_counterSamples.push_back(sample);
+    }
+
+    std::copy(d_counters, d_counters + CounterCount, d_frameCounterBase);
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t Profiler::getFrameCount() const
+{
+    return d_frameCount;
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::count(ProfilerCounter counter, std::uint64_t amount)
+{
+    Profiler* const profiler = getSingletonPtr();
+
+    if (profiler && profiler->d_enabled)
+    {
+        std::lock_guard<std::mutex> lock(profiler->d_recordMutex);
+        profiler->d_counters[static_cast<int>(counter)] += amount;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::recordZone(const char* name, const String* windowType,
+                          Clock::time_point start, Clock::time_point end)
+{
+    const double duration =
+        std::chrono::duration<double>(end - start).count();
+
+    static const String noWindowType;
+    const String& type = windowType ? *windowType : noWindowType;
+
+    std::lock_guard<std::mutex> lock(d_recordMutex);
+
+    WindowTypeStatisticsMap& types = d_zoneStatistics[name];
+    WindowTypeStatisticsMap::iterator it = types.find(type);
+    if (it == types.end())
+    {
+        const ZoneStatistics fresh = { name, type, 0, 0.0, 0.0 };
+        it = types.insert(std::make_pair(type, fresh)).first;
+    }
+
+    ZoneStatistics& stats = it->second;
+    ++stats.callCount;
+    stats.totalTime += duration;
+    stats.maxTime = std::max(stats.maxTime, duration);
+
+    if (!d_traceCaptureEnabled)
+        return;
+
+    if (d_traceEvents.size() >= d_maxTraceEvents)
+    {
+        ++d_droppedTraceEvents;
+        return;
+    }
+
+    const TraceEvent event =
+        { name, type, toTraceTime(start), duration * 1000000.0 };
+    d_traceEvents.push_back(event);
+}
+
+//----------------------------------------------------------------------------//
+double Profiler::toTraceTime(Clock::time_point time) const
+{
+    return std::chrono::duration<double, std::micro>(time - d_epoch).count();
+}
+
+//----------------------------------------------------------------------------//
+ProfilerZone::ProfilerZone(const char* name, const String* windowType) :
+    d_profiler(Profiler::getSingletonPtr()),
+    d_name(name),
+    d_windowType(windowType)
+{
+    if (d_profiler && !d_profiler->isEnabled())
+        d_profiler = nullptr;
+
+    if (d_profiler)
+        d_start = Profiler::Clock::now();
+}
+
+//----------------------------------------------------------------------------//
+ProfilerZone::~ProfilerZone()
+{
+    if (d_profiler)
+        d_profiler->recordZone(d_name, d_windowType, d_start,
+                               Profiler::Clock::now());
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
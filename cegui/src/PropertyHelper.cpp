@@ -32,11 +32,15 @@
 #include "CEGUI/FontManager.h"
 #include "CEGUI/Font.h"
 #include "CEGUI/Exceptions.h"
-#include "CEGUI/StreamHelper.h"
-#include "CEGUI/SharedStringStream.h"
 #include "CEGUI/AspectMode.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <sstream>
+#include <type_traits>
 
 
 namespace CEGUI
@@ -61,6 +65,785 @@ static void throwParsingException(const String& typeName, const String& parsedst
     throw InvalidRequestException("PropertyHelper::fromString could not parse the type " + typeName + " from the string: \"" + parsedstring + "\"");
 }
 
+namespace
+{
+//! Powers of ten that are exactly representable as a double.
+const double ExactPowersOfTen[] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+const int MaxExactPowerOfTen = 22;
+
+//! Largest integer that converts to a double exactly, along with all below it.
+const std::uint64_t MaxExactDoubleInteger = static_cast<std::uint64_t>(1) << 53;
+
+//! Number of significant decimal digits kept while parsing a number.
+const int MaxParsedDigits = 19;
+
+//! Decimal exponent from which numbers are written in scientific notation.
+const int ScientificExponentThreshold = 8;
+
+//! Return whether \a c is a white space character in the "C" locale.
+template <typename CharT>
+inline bool isSpace(CharT c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+//! Return the value of the decimal digit \a c, or -1 if it is not one.
+template <typename CharT>
+inline int decimalDigit(CharT c)
+{
+    return (c >= '0' && c <= '9') ? static_cast<int>(c - '0') : -1;
+}
+
+//! Return the value of the hexadecimal digit \a c, or -1 if it is not one.
+template <typename CharT>
+inline int hexDigit(CharT c)
+{
+    if (c >= '0' && c <= '9')
+        return static_cast<int>(c - '0');
+    if (c >= 'a' && c <= 'f')
+        return static_cast<int>(c - 'a') + 10;
+    if (c >= 'A' && c <= 'F')
+        return static_cast<int>(c - 'A') + 10;
+
+    return -1;
+}
+
+//! Multiply \a val by ten to the power of \a exponent.
+double scaleByPowerOfTen(double val, int exponent)
+{
+    while (exponent > MaxExactPowerOfTen)
+    {
+        val *= ExactPowersOfTen[MaxExactPowerOfTen];
+        exponent -= MaxExactPowerOfTen;
+    }
+    while (exponent < -MaxExactPowerOfTen)
+    {
+        val /= ExactPowersOfTen[MaxExactPowerOfTen];
+        exponent += MaxExactPowerOfTen;
+    }
+
+    return exponent < 0 ? val / ExactPowersOfTen[-exponent] :
+                          val * ExactPowersOfTen[exponent];
+}
+
+/*!
+\brief
+    Reads values from the code units of a string directly, instead of going
+    through a stream, so that parsing is independent of the global locale,
+    reentrant and free of allocations.
+
+    The accepted syntax is that of the stream operators of the value types.
+    Once something does not match, all further reads are skipped and failed()
+    returns true.
+*/
+template <typename CharT>
+class ValueReader
+{
+public:
+    ValueReader(const CharT* begin, const CharT* end) :
+        d_pos(begin),
+        d_end(end),
+        d_failed(false)
+    {}
+
+    //! Return whether anything failed to match so far.
+    bool failed() const
+    {
+        return d_failed;
+    }
+
+    //! Skip white space and the character \a c, if that comes next.
+    ValueReader& optional(char c)
+    {
+        if (!d_failed)
+        {
+            skipSpace();
+            if (d_pos != d_end && *d_pos == static_cast<CharT>(c))
+                ++d_pos;
+        }
+
+        return *this;
+    }
+
+    //! Skip white space and the character \a c, failing if it does not come next.
+    ValueReader& mandatory(char c)
+    {
+        if (!d_failed)
+        {
+            skipSpace();
+            if (d_pos != d_end && *d_pos == static_cast<CharT>(c))
+                ++d_pos;
+            else
+                d_failed = true;
+        }
+
+        return *this;
+    }
+
+    /*!
+    \brief
+        Match the characters of \a pattern, like MandatoryString does: a space
+        skips any amount of white space, any other character must come next.
+    */
+    ValueReader& match(const char* pattern)
+    {
+        for (; !d_failed && *pattern != '\0'; ++pattern)
+        {
+            if (*pattern == ' ')
+                skipSpace();
+            else if (d_pos != d_end && *d_pos == static_cast<CharT>(*pattern))
+                ++d_pos;
+            else
+                d_failed = true;
+        }
+
+        return *this;
+    }
+
+    ValueReader& read(double& val)
+    {
+        if (d_failed)
+            return *this;
+
+        skipSpace();
+        const CharT* const start = d_pos;
+
+        bool negative = false;
+        if (d_pos != d_end && (*d_pos == '-' || *d_pos == '+'))
+            negative = *d_pos++ == '-';
+
+        // collect the significant digits into an integer and a decimal exponent
+        std::uint64_t mantissa = 0;
+        int digit_count = 0;
+        int exponent = 0;
+        bool truncated = false;
+        bool has_digits = false;
+        int digit;
+
+        for (; d_pos != d_end && (digit = decimalDigit(*d_pos)) >= 0; ++d_pos)
+        {
+            has_digits = true;
+            if (digit_count < MaxParsedDigits)
+            {
+                mantissa = mantissa * 10 + digit;
+                if (mantissa != 0)
+                    ++digit_count;
+            }
+            else
+            {
+                ++exponent;
+                truncated |= digit != 0;
+            }
+        }
+
+        if (d_pos != d_end && *d_pos == '.')
+        {
+            for (++d_pos; d_pos != d_end && (digit = decimalDigit(*d_pos)) >= 0; ++d_pos)
+            {
+                has_digits = true;
+                if (digit_count < MaxParsedDigits)
+                {
+                    mantissa = mantissa * 10 + digit;
+                    --exponent;
+                    if (mantissa != 0)
+                        ++digit_count;
+                }
+                else
+                    truncated |= digit != 0;
+            }
+        }
+
+        if (!has_digits)
+        {
+            d_failed = true;
+            return *this;
+        }
+
+        if (d_pos != d_end && (*d_pos == 'e' || *d_pos == 'E'))
+        {
+            const CharT* const exponent_start = d_pos++;
+
+            bool negative_exponent = false;
+            if (d_pos != d_end && (*d_pos == '-' || *d_pos == '+'))
+                negative_exponent = *d_pos++ == '-';
+
+            if (d_pos == d_end || decimalDigit(*d_pos) < 0)
+            {
+                // not an exponent after all
+                d_pos = exponent_start;
+            }
+            else
+            {
+                int explicit_exponent = 0;
+                for (; d_pos != d_end && (digit = decimalDigit(*d_pos)) >= 0; ++d_pos)
+                {
+                    if (explicit_exponent < 100000)
+                        explicit_exponent = explicit_exponent * 10 + digit;
+                }
+
+                exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+            }
+        }
+
+        if (mantissa == 0 && !truncated)
+        {
+            val = negative ? -0.0 : 0.0;
+        }
+        else if (!truncated && mantissa <= MaxExactDoubleInteger &&
+                 exponent >= -MaxExactPowerOfTen && exponent <= MaxExactPowerOfTen)
+        {
+            // both operands are exact, so the result is correctly rounded.
+            const double result = scaleByPowerOfTen(static_cast<double>(mantissa), exponent);
+            val = negative ? -result : result;
+        }
+        else
+        {
+            d_failed = !readWithClassicStream(start, val);
+        }
+
+        return *this;
+    }
+
+    ValueReader& read(float& val)
+    {
+        double result = 0.0;
+        read(result);
+
+        // values from halfway between the largest float and the next power of
+        // two upwards would round to infinity.
+        static const double overflow = std::ldexp(1.0, 128) - std::ldexp(1.0, 103);
+
+        if (!d_failed && std::fabs(result) >= overflow)
+            d_failed = true;
+        else
+            val = static_cast<float>(result);
+
+        return *this;
+    }
+
+    ValueReader& read(std::int16_t& val) { return readInteger(val); }
+    ValueReader& read(std::int32_t& val) { return readInteger(val); }
+    ValueReader& read(std::int64_t& val) { return readInteger(val); }
+    ValueReader& read(std::uint32_t& val) { return readInteger(val); }
+    ValueReader& read(std::uint64_t& val) { return readInteger(val); }
+
+    //! Read a Colour as hexadecimal ARGB value.
+    ValueReader& read(Colour& val)
+    {
+        if (d_failed)
+            return *this;
+
+        skipSpace();
+        if (d_end - d_pos > 2 && d_pos[0] == '0' && (d_pos[1] == 'x' || d_pos[1] == 'X'))
+            d_pos += 2;
+
+        std::uint64_t argb = 0;
+        bool has_digits = false;
+        int digit;
+        for (; d_pos != d_end && (digit = hexDigit(*d_pos)) >= 0; ++d_pos)
+        {
+            has_digits = true;
+            argb = argb * 16 + digit;
+            if (argb > std::numeric_limits<argb_t>::max())
+            {
+                d_failed = true;
+                return *this;
+            }
+        }
+
+        if (has_digits)
+            val.setARGB(static_cast<argb_t>(argb));
+        else
+            d_failed = true;
+
+        return *this;
+    }
+
+    ValueReader& read(ColourRect& val)
+    {
+        return match(" tl : ").read(val.d_top_left).match(" tr : ").read(val.d_top_right)
+            .match(" bl : ").read(val.d_bottom_left).match(" br : ").read(val.d_bottom_right);
+    }
+
+    ValueReader& read(UDim& val)
+    {
+        // Format is: " { %g , %g } " but we are lenient regarding the format, so this is also allowed: " %g %g "
+        return optional('{').read(val.d_scale).optional(',').read(val.d_offset).optional('}');
+    }
+
+    ValueReader& read(UVector2& val)
+    {
+        return optional('{').read(val.d_x).optional(',').read(val.d_y).optional('}');
+    }
+
+    ValueReader& read(UVector3& val)
+    {
+        return optional('{').read(val.d_x).optional(',').read(val.d_y).optional(',')
+            .read(val.d_z).optional('}');
+    }
+
+    ValueReader& read(USize& val)
+    {
+        return mandatory('{').read(val.d_width).optional(',').read(val.d_height).optional('}');
+    }
+
+    ValueReader& read(URect& val)
+    {
+        return optional('{').read(val.d_min).optional(',').read(val.d_max).optional('}');
+    }
+
+    ValueReader& read(UBox& val)
+    {
+        return optional('{').match(" top : {").read(val.d_top.d_scale).optional(',')
+            .read(val.d_top.d_offset).mandatory('}').optional(',')
+            .match(" left : {").read(val.d_left.d_scale).optional(',')
+            .read(val.d_left.d_offset).mandatory('}').optional(',')
+            .match(" bottom : {").read(val.d_bottom.d_scale).optional(',')
+            .read(val.d_bottom.d_offset).mandatory('}').optional(',')
+            .match(" right : {").read(val.d_right.d_scale).optional(',')
+            .read(val.d_right.d_offset);
+    }
+
+    ValueReader& read(Rectf& val)
+    {
+        return match(" l :").read(val.d_min.x).match(" t :").read(val.d_min.y)
+            .match(" r :").read(val.d_max.x).match(" b :").read(val.d_max.y);
+    }
+
+    ValueReader& read(Sizef& val)
+    {
+        return match(" w :").read(val.d_width).match(" h :").read(val.d_height);
+    }
+
+    ValueReader& read(glm::vec2& val)
+    {
+        return match(" x :").read(val.x).match(" y :").read(val.y);
+    }
+
+    ValueReader& read(glm::vec3& val)
+    {
+        return match(" x :").read(val.x).match(" y :").read(val.y).match(" z :").read(val.z);
+    }
+
+    ValueReader& read(glm::quat& val)
+    {
+        return match(" w :").read(val.w).match(" x :").read(val.x)
+            .match(" y :").read(val.y).match(" z :").read(val.z);
+    }
+
+private:
+    void skipSpace()
+    {
+        while (d_pos != d_end && isSpace(*d_pos))
+            ++d_pos;
+    }
+
+    template <typename T>
+    ValueReader& readInteger(T& val)
+    {
+        if (d_failed)
+            return *this;
+
+        skipSpace();
+
+        bool negative = false;
+        if (d_pos != d_end && (*d_pos == '-' || *d_pos == '+'))
+            negative = *d_pos++ == '-';
+
+        // negative values may go one beyond the maximum of signed types.
+        typedef typename std::make_unsigned<T>::type UnsignedT;
+        const UnsignedT limit = static_cast<UnsignedT>(std::numeric_limits<T>::max()) +
+            ((negative && std::numeric_limits<T>::is_signed) ? 1 : 0);
+
+        UnsignedT magnitude = 0;
+        bool has_digits = false;
+        int digit;
+        for (; d_pos != d_end && (digit = decimalDigit(*d_pos)) >= 0; ++d_pos)
+        {
+            has_digits = true;
+            if (magnitude > (limit - digit) / 10)
+            {
+                d_failed = true;
+                return *this;
+            }
+            magnitude = static_cast<UnsignedT>(magnitude * 10 + digit);
+        }
+
+        if (!has_digits)
+        {
+            d_failed = true;
+            return *this;
+        }
+
+        // like the stream operators, negative unsigned values wrap around.
+        val = static_cast<T>(negative ? static_cast<UnsignedT>(0 - magnitude) : magnitude);
+        return *this;
+    }
+
+    /*!
+    \brief
+        Parse the number from \a start up to the current position with a
+        stream using the "C" locale. Only used for numbers that can not be
+        converted exactly using double arithmetic.
+    */
+    bool readWithClassicStream(const CharT* start, double& val) const
+    {
+        // the number only consists of ASCII characters at this point.
+        std::string text(static_cast<std::size_t>(d_pos - start), ' ');
+        for (std::size_t i = 0; i < text.size(); ++i)
+            text[i] = static_cast<char>(start[i]);
+
+        std::istringstream stream(text);
+        stream.imbue(std::locale::classic());
+        stream >> val;
+
+        return !stream.fail();
+    }
+
+    //! Next code unit to read.
+    const CharT* d_pos;
+    //! End of the code units to read.
+    const CharT* d_end;
+    //! Whether anything failed to match so far.
+    bool d_failed;
+};
+
+//! ValueReader working on the code units of CEGUI::String.
+typedef ValueReader<String::value_type> StringValueReader;
+
+/*!
+\brief
+    Writes values as text into a fixed size buffer, instead of going through a
+    stream, so that formatting is independent of the global locale and
+    reentrant. Only the returned String is allocated.
+
+    Floating point numbers are written with the fewest significant digits that
+    read back to the same value.
+*/
+class ValueWriter
+{
+public:
+    ValueWriter() :
+        d_length(0)
+    {
+        d_buffer[0] = '\0';
+    }
+
+    //! Return the text written so far.
+    String toString() const
+    {
+        return String(d_buffer);
+    }
+
+    ValueWriter& write(char c)
+    {
+        if (d_length < BufferSize - 1)
+        {
+            d_buffer[d_length++] = c;
+            d_buffer[d_length] = '\0';
+        }
+
+        return *this;
+    }
+
+    ValueWriter& write(const char* str)
+    {
+        while (*str != '\0')
+            write(*str++);
+
+        return *this;
+    }
+
+    ValueWriter& write(float val)
+    {
+        return writeShortest(val, std::numeric_limits<float>::max_digits10);
+    }
+
+    ValueWriter& write(double val)
+    {
+        return writeShortest(val, std::numeric_limits<double>::max_digits10);
+    }
+
+    ValueWriter& write(std::int16_t val) { return writeInteger(val); }
+    ValueWriter& write(std::int32_t val) { return writeInteger(val); }
+    ValueWriter& write(std::int64_t val) { return writeInteger(val); }
+    ValueWriter& write(std::uint32_t val) { return writeInteger(val); }
+    ValueWriter& write(std::uint64_t val) { return writeInteger(val); }
+
+    //! Write a Colour as eight lower case hexadecimal ARGB digits.
+    ValueWriter& write(const Colour& val)
+    {
+        static const char digits[] = "0123456789abcdef";
+
+        const argb_t argb = val.getARGB();
+        for (int shift = 28; shift >= 0; shift -= 4)
+            write(digits[(argb >> shift) & 0xF]);
+
+        return *this;
+    }
+
+    ValueWriter& write(const ColourRect& val)
+    {
+        return write("tl:").write(val.d_top_left).write(" tr:").write(val.d_top_right)
+            .write(" bl:").write(val.d_bottom_left).write(" br:").write(val.d_bottom_right);
+    }
+
+    ValueWriter& write(const UDim& val)
+    {
+        return write('{').write(val.d_scale).write(',').write(val.d_offset).write('}');
+    }
+
+    ValueWriter& write(const UVector2& val)
+    {
+        return write(val.d_x).write(',').write(val.d_y);
+    }
+
+    ValueWriter& write(const UVector3& val)
+    {
+        return write(val.d_x).write(',').write(val.d_y).write(',').write(val.d_z);
+    }
+
+    ValueWriter& write(const USize& val)
+    {
+        return write('{').write(val.d_width).write(',').write(val.d_height).write('}');
+    }
+
+    ValueWriter& write(const URect& val)
+    {
+        return write('{').write(val.d_min).write(',').write(val.d_max).write('}');
+    }
+
+    ValueWriter& write(const UBox& val)
+    {
+        return write("{top:").write(val.d_top).write(",left:").write(val.d_left)
+            .write(",bottom:").write(val.d_bottom).write(",right:").write(val.d_right)
+            .write('}');
+    }
+
+    ValueWriter& write(const Rectf& val)
+    {
+        return write("l:").write(val.d_min.x).write(" t:").write(val.d_min.y)
+            .write(" r:").write(val.d_max.x).write(" b:").write(val.d_max.y);
+    }
+
+    ValueWriter& write(const Sizef& val)
+    {
+        return write("w:").write(val.d_width).write(" h:").write(val.d_height);
+    }
+
+    ValueWriter& write(const glm::vec2& val)
+    {
+        return write("x:").write(val.x).write(" y:").write(val.y);
+    }
+
+    ValueWriter& write(const glm::vec3& val)
+    {
+        return write("x:").write(val.x).write(" y:").write(val.y).write(" z:").write(val.z);
+    }
+
+    ValueWriter& write(const glm::quat& val)
+    {
+        return write("w:").write(val.w).write(" x:").write(val.x)
+            .write(" y:").write(val.y).write(" z:").write(val.z);
+    }
+
+private:
+    template <typename T>
+    ValueWriter& writeInteger(T val)
+    {
+        typedef typename std::make_unsigned<T>::type UnsignedT;
+
+        UnsignedT magnitude = static_cast<UnsignedT>(val);
+        if (val < 0)
+        {
+            write('-');
+            magnitude = static_cast<UnsignedT>(0 - magnitude);
+        }
+
+        char digits[24];
+        int count = 0;
+        do
+        {
+            digits[count++] = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        }
+        while (magnitude != 0);
+
+        while (count > 0)
+            write(digits[--count]);
+
+        return *this;
+    }
+
+    /*!
+    \brief
+        Write \a val with the fewest significant digits, up to \a max_digits,
+        that our own parsing reads back as exactly the same value.
+    */
+    template <typename T>
+    ValueWriter& writeShortest(T val, int max_digits)
+    {
+        if (std::isnan(val))
+            return write("nan");
+
+        if (std::signbit(val))
+        {
+            write('-');
+            val = -val;
+        }
+
+        if (std::isinf(val))
+            return write("inf");
+
+        if (val == 0)
+            return write('0');
+
+        char text[40];
+        for (int precision = 1; precision <= max_digits; ++precision)
+        {
+            formatDigits(val, precision, text);
+
+            T parsed = 0;
+            ValueReader<char> reader(text, text + std::strlen(text));
+            if (!reader.read(parsed).failed() && parsed == val)
+                return write(text);
+        }
+
+        // the digits are not exact for some extreme values; fall back to a stream.
+        std::ostringstream stream;
+        stream.imbue(std::locale::classic());
+        stream.precision(max_digits);
+        stream << val;
+        return write(stream.str().c_str());
+    }
+
+    /*!
+    \brief
+        Write the positive, finite value \a val rounded to \a precision
+        significant digits into \a text, in fixed or scientific notation like
+        printf's "%g" does.
+    */
+    static void formatDigits(double val, int precision, char* text)
+    {
+        int exponent = static_cast<int>(std::floor(std::log10(val)));
+        double digits = std::floor(scaleByPowerOfTen(val, precision - 1 - exponent) + 0.5);
+
+        // correct the exponent when log10 was off or rounding carried over.
+        if (digits >= ExactPowersOfTen[precision])
+        {
+            ++exponent;
+            digits = std::floor(scaleByPowerOfTen(val, precision - 1 - exponent) + 0.5);
+        }
+        else if (digits < ExactPowersOfTen[precision - 1])
+        {
+            --exponent;
+            digits = std::floor(scaleByPowerOfTen(val, precision - 1 - exponent) + 0.5);
+        }
+
+        char decimal[24];
+        int count = 0;
+        std::uint64_t integer = static_cast<std::uint64_t>(digits);
+        for (int i = precision - 1; i >= 0; --i)
+        {
+            decimal[i] = static_cast<char>('0' + integer % 10);
+            integer /= 10;
+        }
+        count = precision;
+        while (count > 1 && decimal[count - 1] == '0')
+            --count;
+
+        char* out = text;
+        if (exponent < -4 || exponent >= ScientificExponentThreshold)
+        {
+            *out++ = decimal[0];
+            if (count > 1)
+            {
+                *out++ = '.';
+                for (int i = 1; i < count; ++i)
+                    *out++ = decimal[i];
+            }
+
+            *out++ = 'e';
+            *out++ = exponent < 0 ? '-' : '+';
+            const int magnitude = exponent < 0 ? -exponent : exponent;
+            if (magnitude >= 100)
+                *out++ = static_cast<char>('0' + magnitude / 100);
+            *out++ = static_cast<char>('0' + magnitude / 10 % 10);
+            *out++ = static_cast<char>('0' + magnitude % 10);
+        }
+        else if (exponent >= 0)
+        {
+            for (int i = 0; i <= exponent; ++i)
+                *out++ = i < count ? decimal[i] : '0';
+
+            if (count > exponent + 1)
+            {
+                *out++ = '.';
+                for (int i = exponent + 1; i < count; ++i)
+                    *out++ = decimal[i];
+            }
+        }
+        else
+        {
+            *out++ = '0';
+            *out++ = '.';
+            for (int i = -1; i > exponent; --i)
+                *out++ = '0';
+            for (int i = 0; i < count; ++i)
+                *out++ = decimal[i];
+        }
+
+        *out = '\0';
+    }
+
+    //! Size of the buffer, enough for the longest value text (a UBox).
+    static const std::size_t BufferSize = 256;
+
+    //! Buffer holding the text written so far.
+    char d_buffer[BufferSize];
+    //! Number of characters written so far.
+    std::size_t d_length;
+};
+
+/*!
+\brief
+    Parse a value of type T from \a str, returning \a val if \a str is empty
+    and throwing if it can not be parsed.
+*/
+template <typename T>
+T parseValue(const String& str, T val, const String& typeName)
+{
+    if (str.empty())
+        return val;
+
+    StringValueReader reader(str.c_str(), str.c_str() + str.length());
+    if (reader.read(val).failed())
+        throwParsingException(typeName, str);
+
+    return val;
+}
+
+//! Return whether the code unit \a c occurs in \a str.
+bool containsCodeUnit(const String& str, char c)
+{
+    const String::value_type* const data = str.c_str();
+    return std::find(data, data + str.length(), static_cast<String::value_type>(c)) !=
+        data + str.length();
+}
+
+//! Format \a val as String.
+template <typename T>
+String formatValue(const T& val)
+{
+    return ValueWriter().write(val).toString();
+}
+
+}
+
 const String& PropertyHelper<bool>::getDataTypeName()
 {
     static const String type("bool");
@@ -221,24 +1004,13 @@ PropertyHelper<float>::fromString(const String& str)
 {
     float val = 0.0f;
 
-    if (str.empty())
-        return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return val;
+    return parseValue(str, val, getDataTypeName());
 }
 
 PropertyHelper<float>::string_return_type PropertyHelper<float>::toString(
     PropertyHelper<float>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<UDim>::getDataTypeName()
@@ -253,24 +1025,13 @@ PropertyHelper<UDim>::fromString(const String& str)
 {
     UDim ud(0.0f, 0.0f);
 
-    if (str.empty())
-        return ud;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> ud;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return ud;
+    return parseValue(str, ud, getDataTypeName());
 }
 
 PropertyHelper<UDim>::string_return_type PropertyHelper<UDim>::toString(
     PropertyHelper<UDim>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<UVector2>::getDataTypeName()
@@ -285,24 +1046,13 @@ PropertyHelper<UVector2>::fromString(const String& str)
 {
     UVector2 uv(UDim(0.0f, 0.0f), UDim(0.0f, 0.0f));
 
-    if (str.empty())
-        return uv;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> uv;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return uv;
+    return parseValue(str, uv, getDataTypeName());
 }
 
 PropertyHelper<UVector2>::string_return_type PropertyHelper<UVector2>::toString(
     PropertyHelper<UVector2>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<UVector3>::getDataTypeName()
@@ -317,24 +1067,13 @@ PropertyHelper<UVector3>::fromString(const String& str)
 {
     UVector3 uv(UDim(0.0f, 0.0f), UDim(0.0f, 0.0f), UDim(0.0f, 0.0f));
 
-    if (str.empty())
-        return uv;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> uv;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return uv;
+    return parseValue(str, uv, getDataTypeName());
 }
 
 PropertyHelper<UVector3>::string_return_type PropertyHelper<UVector3>::toString(
     PropertyHelper<UVector3>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<USize>::getDataTypeName()
@@ -349,24 +1088,13 @@ PropertyHelper<USize>::fromString(const String& str)
 {
     USize uv(UDim(0.0f, 0.0f), UDim(0.0f, 0.0f));
 
-    if (str.empty())
-        return uv;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> uv;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return uv;
+    return parseValue(str, uv, getDataTypeName());
 }
 
 PropertyHelper<USize>::string_return_type PropertyHelper<USize>::toString(
     PropertyHelper<USize>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<URect>::getDataTypeName()
@@ -381,24 +1109,13 @@ PropertyHelper<URect>::fromString(const String& str)
 {
     URect ur(UVector2(UDim(0.0f, 0.0f), UDim(0.0f, 0.0f)), UVector2(UDim(0.0f, 0.0f), UDim(0.0f, 0.0f)));
 
-    if (str.empty())
-        return ur;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> ur;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return ur;
+    return parseValue(str, ur, getDataTypeName());
 }
 
 PropertyHelper<URect>::string_return_type PropertyHelper<URect>::toString(
     PropertyHelper<URect>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<UBox>::getDataTypeName()
@@ -413,24 +1130,13 @@ PropertyHelper<UBox>::fromString(const String& str)
 {
     UBox ret(UDim(0.0f, 0.0f), UDim(0.0f, 0.0f), UDim(0.0f, 0.0f), UDim(0.0f, 0.0f));
 
-    if (str.empty())
-        return ret;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> ret;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return ret;
+    return parseValue(str, ret, getDataTypeName());
 }
 
 PropertyHelper<UBox>::string_return_type PropertyHelper<UBox>::toString(
     PropertyHelper<UBox>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<ColourRect>::getDataTypeName()
@@ -443,48 +1149,19 @@ const String& PropertyHelper<ColourRect>::getDataTypeName()
 PropertyHelper<ColourRect>::return_type
 PropertyHelper<ColourRect>::fromString(const String& str)
 {
-    ColourRect val(Colour(0xFF000000));
-
-    if (str.empty())
-         return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-
     if (str.length() == 8)
-    {
-        CEGUI::Colour colourForEntireRect(0xFF000000);
-
-        sstream >> colourForEntireRect;
-        if (sstream.fail())
-            throwParsingException(getDataTypeName(), str);
-
-        val = ColourRect(colourForEntireRect);
+        return ColourRect(parseValue(str, Colour(0xFF000000), getDataTypeName()));
 
-        return val;
-    }
-    else
-    {
-        sstream >> val;
-        if (sstream.fail())
-            throwParsingException(getDataTypeName(), str);
-
-        return val;
-    }
-
-    return val;
+    return parseValue(str, ColourRect(Colour(0xFF000000)), getDataTypeName());
 }
 
 PropertyHelper<ColourRect>::string_return_type PropertyHelper<ColourRect>::toString(
     PropertyHelper<ColourRect>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-
     if(val.isMonochromatic())
-        sstream << val.d_top_left;
-    else
-        sstream << val;
+        return formatValue(val.d_top_left);
 
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<Colour>::getDataTypeName()
@@ -499,25 +1176,13 @@ PropertyHelper<Colour>::fromString(const String& str)
 {
     Colour val(0xFF000000);
 
-    if (str.empty())
-        return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-    
-
-    return Colour(val);
+    return parseValue(str, val, getDataTypeName());
 }
 
 PropertyHelper<Colour>::string_return_type PropertyHelper<Colour>::toString(
     PropertyHelper<Colour>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<Rectf>::getDataTypeName()
@@ -532,24 +1197,13 @@ PropertyHelper<Rectf>::fromString(const String& str)
 {
     Rectf val(0.0f, 0.0f, 0.0f, 0.0f);
 
-    if (str.empty())
-        return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return val;
+    return parseValue(str, val, getDataTypeName());
 }
 
 PropertyHelper<Rectf>::string_return_type PropertyHelper<Rectf>::toString(
     PropertyHelper<Rectf>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<Sizef>::getDataTypeName()
@@ -564,24 +1218,13 @@ PropertyHelper<Sizef>::fromString(const String& str)
 {
     Sizef val(0.0f, 0.0f);
 
-    if (str.empty())
-        return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return val;
+    return parseValue(str, val, getDataTypeName());
 }
 
 PropertyHelper<Sizef>::string_return_type PropertyHelper<Sizef>::toString(
     PropertyHelper<Sizef>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<double>::getDataTypeName()
@@ -596,25 +1239,14 @@ PropertyHelper<double>::fromString(const String& str)
 {
     double val = 0.0;
 
-    if (str.empty())
-        return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return val;
+    return parseValue(str, val, getDataTypeName());
 }
 
 
 PropertyHelper<double>::string_return_type PropertyHelper<double>::toString(
     PropertyHelper<double>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 
@@ -630,25 +1262,14 @@ PropertyHelper<std::int16_t>::fromString(const String& str)
 {
     std::int16_t val = 0;
 
-    if (str.empty())
-        return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return val;
+    return parseValue(str, val, getDataTypeName());
 }
 
 
 PropertyHelper<std::int16_t>::string_return_type PropertyHelper<std::int16_t>::toString(
     PropertyHelper<std::int16_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 
@@ -664,25 +1285,14 @@ PropertyHelper<std::int32_t>::fromString(const String& str)
 {
     std::int32_t val = 0;
 
-    if (str.empty())
-        return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return val;
+    return parseValue(str, val, getDataTypeName());
 }
 
 
 PropertyHelper<std::int32_t>::string_return_type PropertyHelper<std::int32_t>::toString(
     PropertyHelper<std::int32_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<std::int64_t>::getDataTypeName()
@@ -697,25 +1307,14 @@ PropertyHelper<std::int64_t>::fromString(const String& str)
 {
     std::int64_t val = 0;
 
-    if (str.empty())
-        return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return val;
+    return parseValue(str, val, getDataTypeName());
 }
 
 
 PropertyHelper<std::int64_t>::string_return_type PropertyHelper<std::int64_t>::toString(
     PropertyHelper<std::int64_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 
@@ -731,25 +1330,14 @@ PropertyHelper<std::uint32_t>::fromString(const String& str)
 {
     std::uint32_t val = 0;
 
-    if (str.empty())
-        return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return val;
+    return parseValue(str, val, getDataTypeName());
 }
 
 
 PropertyHelper<std::uint32_t>::string_return_type PropertyHelper<std::uint32_t>::toString(
     PropertyHelper<std::uint32_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<std::uint64_t>::getDataTypeName()
@@ -764,25 +1352,14 @@ PropertyHelper<std::uint64_t>::fromString(const String& str)
 {
     std::uint64_t val = 0;
 
-    if (str.empty())
-        return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return val;
+    return parseValue(str, val, getDataTypeName());
 }
 
 
 PropertyHelper<std::uint64_t>::string_return_type PropertyHelper<std::uint64_t>::toString(
     PropertyHelper<std::uint64_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<glm::vec2>::getDataTypeName()
@@ -797,24 +1374,13 @@ PropertyHelper<glm::vec2>::fromString(const String& str)
 {
     glm::vec2 val(0, 0);
 
-    if (str.empty())
-        return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> MandatoryString(" x :") >> val.x >> MandatoryString(" y :") >> val.y;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return val;
+    return parseValue(str, val, getDataTypeName());
 }
 
 PropertyHelper<glm::vec2>::string_return_type PropertyHelper<glm::vec2>::toString(
     PropertyHelper<glm::vec2>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << "x:" << val.x << " y:" << val.y;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<glm::vec3>::getDataTypeName()
@@ -829,24 +1395,13 @@ PropertyHelper<glm::vec3>::fromString(const String& str)
 {
     glm::vec3 val(0, 0, 0);
 
-    if (str.empty())
-        return val;
-
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> MandatoryString(" x :") >> val.x >> MandatoryString(" y :") >> val.y >> MandatoryString(" z :") >> val.z;
-    if (sstream.fail())
-        throwParsingException(getDataTypeName(), str);
-
-    return val;
+    return parseValue(str, val, getDataTypeName());
 }
 
 PropertyHelper<glm::vec3>::string_return_type PropertyHelper<glm::vec3>::toString(
     PropertyHelper<glm::vec3>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << "x:" << val.x << " y:" << val.y << " z:" << val.z;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<glm::quat>::getDataTypeName()
@@ -863,41 +1418,24 @@ PropertyHelper<glm::quat>::fromString(const String& str)
 
     if (str.empty())
         return val;
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
-    else if (str.find("w", 0) != std::string::npos || 
-             str.find("W", 0) != std::string::npos)
-#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-    else if (str.getString().find(String("w").c_str(), 0) != std::string::npos || 
-             str.getString().find(String("W").c_str(), 0) != std::string::npos)
-#endif
-    {
-        std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-        sstream >> MandatoryString(" w :") >> val.w >> MandatoryString(" x :") >> val.x >> MandatoryString(" y :") >> val.y >> MandatoryString(" z :") >> val.z;
-        if (sstream.fail())
-            throwParsingException(getDataTypeName(), str);
-        return val;
+    else if (containsCodeUnit(str, 'w') || containsCodeUnit(str, 'W'))
+    {
+        return parseValue(str, val, getDataTypeName());
     }
     else
     {
-        float x, y, z;
         // CEGUI takes degrees because it's easier to work with
-        std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-        sstream >> MandatoryString(" x :") >> x >> MandatoryString(" y :") >> y >> MandatoryString(" z :") >> z;
-        if (sstream.fail())
-            throwParsingException(getDataTypeName(), str);
+        const glm::vec3 degrees = parseValue(str, glm::vec3(0, 0, 0), getDataTypeName());
 
         // glm::radians converts from degrees to radians
-        return glm::quat(glm::vec3(glm::radians(x), glm::radians(y), glm::radians(z)));
+        return glm::quat(glm::radians(degrees));
     }
 }
 
 PropertyHelper<glm::quat>::string_return_type PropertyHelper<glm::quat>::toString(
     PropertyHelper<glm::quat>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << "w:" << val.w << " x:" << val.x << " y:" << val.y << " z:" << val.z;
-
-    return String(sstream.str());
+    return formatValue(val);
 }
 
 const String& PropertyHelper<String>::getDataTypeName()
@@ -26,6 +26,7 @@
  ***************************************************************************/
 #include "CEGUI/RenderQueue.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Profiler.h"
 #include <algorithm>
 
 // Start of CEGUI namespace section
@@ -37,7 +38,11 @@ void RenderQueue::draw() const
     // draw the buffers
     BufferList::const_iterator i = d_buffers.begin();
     for ( ; i != d_buffers.end(); ++i)
+    {
+        CEGUI_PROFILE_COUNT(DrawCalls, 1);
+        CEGUI_PROFILE_COUNT(Vertices, (*i)->getVertexCount());
         (*i)->draw();
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -31,6 +31,10 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/TextUtils.h"
 #include "CEGUI/Window.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+
+#include <cmath>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -80,6 +84,7 @@ RenderedStringTextComponent::RenderedStringTextComponent(const String& text,
 void RenderedStringTextComponent::setText(const String& text)
 {
     d_text = text;
+    invalidateGlyphGeometryCache();
 }
 
 //----------------------------------------------------------------------------//
@@ -92,6 +97,7 @@ const String& RenderedStringTextComponent::getText() const
 void RenderedStringTextComponent::setFont(const Font* font)
 {
     d_font = font;
+    invalidateGlyphGeometryCache();
 }
 
 //----------------------------------------------------------------------------//
@@ -99,6 +105,7 @@ void RenderedStringTextComponent::setFont(const String& font_name)
 {
     d_font =
         font_name.empty() ? 0 : &FontManager::getSingleton().get(font_name);
+    invalidateGlyphGeometryCache();
 }
 
 //----------------------------------------------------------------------------//
@@ -111,12 +118,14 @@ const Font* RenderedStringTextComponent::getFont() const
 void RenderedStringTextComponent::setColours(const ColourRect& cr)
 {
     d_colours = cr;
+    invalidateGlyphGeometryCache();
 }
 
 //----------------------------------------------------------------------------//
 void RenderedStringTextComponent::setColours(const Colour& c)
 {
     d_colours.setColours(c);
+    invalidateGlyphGeometryCache();
 }
 
 //----------------------------------------------------------------------------//
@@ -176,13 +185,15 @@ void RenderedStringTextComponent::handleFormattingOptions(const Window* ref_wnd,
     }
 }
 
-void RenderedStringTextComponent::createSelectionRenderGeometry(const glm::vec2& position, const Rectf* clip_rect, const float vertical_space, const Font* fnt) const {
+void RenderedStringTextComponent::createSelectionRenderGeometry(const glm::vec2& position, const Rectf* clip_rect, const float vertical_space, const Font* fnt,
+    DefaultParagraphDirection defaultParagraphDir) const {
     float sel_start_extent = 0;
 
     if (d_selectionStart > 0)
-        sel_start_extent = fnt->getTextExtent(d_text.substr(0, d_selectionStart));
+        sel_start_extent = fnt->getTextExtent(d_text.substr(0, d_selectionStart), defaultParagraphDir);
 
-    float sel_end_extent = fnt->getTextExtent(d_text.substr(0, d_selectionStart + d_selectionLength));
+    float sel_end_extent = fnt->getTextExtent(d_text.substr(0, d_selectionStart + d_selectionLength),
+                                              defaultParagraphDir);
 
     Rectf sel_rect(position.x + sel_start_extent,
                    position.y,
@@ -231,13 +242,151 @@ std::vector<GeometryBuffer*> RenderedStringTextComponent::createRenderGeometry(
     // render selection
     if (d_selectionImage && (d_selectionLength > 0))
     {
-        createSelectionRenderGeometry(position, clip_rect, vertical_space, fnt);
+        createSelectionRenderGeometry(position, clip_rect, vertical_space, fnt, defaultParagraphDir);
+    }
+    std::vector<GeometryBuffer*> geomBuffers;
+    if (createCachedGlyphGeometry(geomBuffers, fnt, final_pos, clip_rect,
+                                  final_cols, space_extra, defaultParagraphDir))
+    {
+        return geomBuffers;
     }
+
     // Create the geometry for rendering for the given text.
-    return fnt->createTextRenderGeometry(
+    geomBuffers = fnt->createTextRenderGeometry(
         d_text, final_pos,
         clip_rect, true, final_cols,
         defaultParagraphDir, space_extra);
+
+    cacheGlyphGeometry(geomBuffers, fnt, final_pos, clip_rect, final_cols,
+                       space_extra, defaultParagraphDir);
+
+    return geomBuffers;
+}
+
+//----------------------------------------------------------------------------//
+bool RenderedStringTextComponent::createCachedGlyphGeometry(
+    std::vector<GeometryBuffer*>& buffers, const Font* fnt,
+    const glm::vec2& position, const Rectf* clip_rect,
+    const ColourRect& colours, float space_extra,
+    DefaultParagraphDirection paragraph_dir) const
+{
+    const GlyphGeometryCache& cache = d_glyphGeometryCache;
+
+    if (!cache.d_valid || cache.d_font != fnt ||
+        cache.d_fontGeneration != Font::getGlyphGeometryGeneration() ||
+        !(cache.d_colours == colours) || cache.d_spaceExtra != space_extra ||
+        cache.d_paragraphDir != paragraph_dir ||
+        cache.d_clipped != (clip_rect != nullptr))
+    {
+        return false;
+    }
+
+    // glyphs are aligned to pixels, so only whole pixel moves give the
+    // same geometry
+    const glm::vec2 offset(position - cache.d_position);
+    if (offset.x != std::floor(offset.x) || offset.y != std::floor(offset.y))
+        return false;
+
+    if (clip_rect)
+    {
+        Rectf clipRect(*clip_rect);
+        clipRect.offset(-position);
+        if (clipRect != cache.d_clipRect)
+            return false;
+    }
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+    std::vector<float> movedVertexData;
+
+    for (const GlyphGeometry& geometry : cache.d_buffers)
+    {
+        const std::vector<float>* vertexData = &geometry.d_vertexData;
+        if (offset.x != 0.0f || offset.y != 0.0f)
+        {
+            movedVertexData = geometry.d_vertexData;
+            for (size_t i = 0; i < movedVertexData.size(); i += 9)
+            {
+                movedVertexData[i] += offset.x;
+                movedVertexData[i + 1] += offset.y;
+            }
+            vertexData = &movedVertexData;
+        }
+
+        GeometryBuffer& buffer =
+            renderer.createGeometryBufferTextured(geometry.d_material);
+
+        buffer.setClippingActive(geometry.d_clippingActive);
+        if (geometry.d_clippingActive && clip_rect)
+            buffer.setClippingRegion(*clip_rect);
+
+        if (geometry.d_quadIndexed)
+            buffer.appendQuads(vertexData->data(), vertexData->size() / (4 * 9));
+        else
+            buffer.appendGeometry(vertexData->data(), vertexData->size());
+
+        buffer.setAlpha(geometry.d_alpha);
+
+        buffers.push_back(&buffer);
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void RenderedStringTextComponent::cacheGlyphGeometry(
+    const std::vector<GeometryBuffer*>& buffers, const Font* fnt,
+    const glm::vec2& position, const Rectf* clip_rect,
+    const ColourRect& colours, float space_extra,
+    DefaultParagraphDirection paragraph_dir) const
+{
+    GlyphGeometryCache& cache = d_glyphGeometryCache;
+
+    // glyphs that could not be prepared on a geometry build worker are missing
+    if (Window::isGeometryBuildDeferred())
+    {
+        invalidateGlyphGeometryCache();
+        return;
+    }
+
+    cache.d_buffers.clear();
+    cache.d_buffers.reserve(buffers.size());
+
+    for (const GeometryBuffer* buffer : buffers)
+    {
+        // glyph geometry is textured, anything else can not be re-created
+        if (buffer->getVertexAttributeElementCount() != 9)
+        {
+            invalidateGlyphGeometryCache();
+            return;
+        }
+
+        GlyphGeometry geometry;
+        geometry.d_material = buffer->getRenderMaterial();
+        geometry.d_vertexData = buffer->getVertexData();
+        geometry.d_quadIndexed = buffer->isQuadIndexed();
+        geometry.d_clippingActive = buffer->isClippingActive();
+        geometry.d_alpha = buffer->getAlpha();
+        cache.d_buffers.push_back(std::move(geometry));
+    }
+
+    cache.d_valid = true;
+    cache.d_font = fnt;
+    // read after laying out, which may have grown a glyph texture
+    cache.d_fontGeneration = Font::getGlyphGeometryGeneration();
+    cache.d_position = position;
+    cache.d_clipped = clip_rect != nullptr;
+    cache.d_clipRect = clip_rect ? *clip_rect : Rectf();
+    cache.d_clipRect.offset(-position);
+    cache.d_colours = colours;
+    cache.d_spaceExtra = space_extra;
+    cache.d_paragraphDir = paragraph_dir;
+}
+
+//----------------------------------------------------------------------------//
+void RenderedStringTextComponent::invalidateGlyphGeometryCache() const
+{
+    d_glyphGeometryCache.d_valid = false;
+    d_glyphGeometryCache.d_buffers.clear();
 }
 
 //----------------------------------------------------------------------------//
@@ -250,7 +399,8 @@ Sizef RenderedStringTextComponent::getPixelSize(const Window* ref_wnd) const
 
     if (fnt)
     {
-        psz.d_width += fnt->getTextExtent(d_text);
+        psz.d_width += fnt->getTextExtent(d_text, ref_wnd ?
+            ref_wnd->getDefaultParagraphDirection() : DefaultParagraphDirection::LeftToRight);
         psz.d_height += fnt->getFontHeight();
     }
 
@@ -287,6 +437,9 @@ RenderedStringTextComponent* RenderedStringTextComponent::split(
     lhs->d_font = d_font;
     lhs->d_colours = d_colours;
 
+    const DefaultParagraphDirection defaultParagraphDir = ref_wnd ?
+        ref_wnd->getDefaultParagraphDirection() : DefaultParagraphDirection::LeftToRight;
+
     // calculate the 'best' place to split the text
     size_t left_len = 0;
     float left_extent = 0.0f;
@@ -299,7 +452,7 @@ RenderedStringTextComponent* RenderedStringTextComponent::split(
             break;
 
         const float token_extent = 
-            fnt->getTextExtent(d_text.substr(left_len, token_len));
+            fnt->getTextExtent(d_text.substr(left_len, token_len), defaultParagraphDir);
 
         // does the next token extend past the split point?
         if (left_extent + token_extent > split_point)
@@ -349,6 +502,7 @@ RenderedStringTextComponent* RenderedStringTextComponent::split(
     }
 
     d_text = d_text.substr(rhs_start);
+    invalidateGlyphGeometryCache();
 
     return lhs;
 }
@@ -97,6 +97,13 @@ std::vector<GeometryBuffer*> RenderedStringWidgetComponent::createRenderGeometry
     const float vertical_space,
     const float /*space_extra*/) const
 {
+    // moving the widget touches windows other than the one being built
+    if (Window::isGeometryBuildWorker())
+    {
+        Window::deferGeometryBuildToMainThread();
+        return std::vector<GeometryBuffer*>();
+    }
+
     Window* const window = getEffectiveWindow(ref_wnd);
     std::vector<GeometryBuffer*> geomBuffers;
 
@@ -27,7 +27,9 @@
 #include "CEGUI/Renderer.h"
 #include "CEGUI/RenderMaterial.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/TextureTarget.h"
 #include "CEGUI/FontManager.h"
+#include "CEGUI/Profiler.h"
 
 namespace CEGUI
 {
@@ -40,19 +42,29 @@ Renderer::Renderer(const float fontScale):
 //----------------------------------------------------------------------------//
 void Renderer::addGeometryBuffer(GeometryBuffer& buffer) 
 {
-    d_geometryBuffers.insert(&buffer);
+    {
+        std::lock_guard<std::mutex> lock(d_geometryBuffersMutex);
+        d_geometryBuffers.insert(&buffer);
+    }
+
+    CEGUI_PROFILE_COUNT(GeometryBuffersCreated, 1);
 }
 
 //----------------------------------------------------------------------------//
 void Renderer::destroyGeometryBuffer(GeometryBuffer& buffer)
 {
-    GeometryBufferSet::const_iterator findIter = d_geometryBuffers.find(&buffer);
-
-    if (findIter != d_geometryBuffers.end())
     {
+        std::lock_guard<std::mutex> lock(d_geometryBuffersMutex);
+
+        GeometryBufferSet::const_iterator findIter = d_geometryBuffers.find(&buffer);
+
+        if (findIter == d_geometryBuffers.end())
+            return;
+
         d_geometryBuffers.erase(findIter);
-        delete &buffer;
     }
+
+    delete &buffer;
 }
 
 //----------------------------------------------------------------------------//
@@ -78,6 +90,30 @@ GeometryBuffer& Renderer::createGeometryBufferColoured()
     return geometry_buffer;
 }
 
+//----------------------------------------------------------------------------//
+bool Renderer::supportsShaderType(const DefaultShaderType shaderType) const
+{
+    return shaderType == DefaultShaderType::Solid ||
+           shaderType == DefaultShaderType::Textured;
+}
+
+//----------------------------------------------------------------------------//
+bool Renderer::isGeometryBufferCreationThreadSafe() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* Renderer::createTextureTarget(bool addStencilBuffer, const Sizef& size)
+{
+    TextureTarget* const target = createTextureTarget(addStencilBuffer);
+
+    if (target && size.d_width > 0.0f && size.d_height > 0.0f)
+        target->declareRenderSize(size);
+
+    return target;
+}
+
 //----------------------------------------------------------------------------//
 void Renderer::invalidateGeomBufferMatrices(const CEGUI::RenderTarget* renderTarget)
 {
@@ -132,4 +168,15 @@ void Renderer::updateGeometryBufferTexCoords(const Texture* texture, const float
     }
 }
 
+bool Renderer::isTextureUsedByGeometry(const Texture* texture) const
+{
+    for (const GeometryBuffer* geometryBuffer : d_geometryBuffers)
+    {
+        if (geometryBuffer->getTexture("texture0") == texture)
+            return true;
+    }
+
+    return false;
+}
+
 }
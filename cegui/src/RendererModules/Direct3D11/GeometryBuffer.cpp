@@ -118,6 +118,15 @@ void Direct3D11GeometryBuffer::appendGeometry(const float* vertex_data, std::siz
     updateVertexBuffer();
 }
 
+//----------------------------------------------------------------------------//
+void Direct3D11GeometryBuffer::updateTextureCoordinates(const Texture* texture,
+                                                        const float scaleFactor)
+{
+    GeometryBuffer::updateTextureCoordinates(texture, scaleFactor);
+
+    updateVertexBuffer();
+}
+
 //----------------------------------------------------------------------------//
 void Direct3D11GeometryBuffer::updateMatrix() const
 {
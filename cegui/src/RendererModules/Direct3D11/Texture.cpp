@@ -29,6 +29,7 @@
 #include "CEGUI/System.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/ImageCodec.h"
+#include "CEGUI/Profiler.h"
 
 #include <cstdint>
 
@@ -234,6 +235,7 @@ void Direct3D11Texture::loadFromMemory(const void* buffer,
     data.SysMemPitch = calculateDataWidth(tex_desc.Width, pixel_format);
 
     HRESULT hr = d_device.CreateTexture2D(&tex_desc, &data, &d_texture);
+    CEGUI_PROFILE_COUNT(TextureUploads, 1);
 
     delete[] dest;
 
@@ -254,6 +256,8 @@ void Direct3D11Texture::blitFromMemory(const void* sourceData, const Rectf& area
     if (!d_texture)
         return;
 
+    CEGUI_PROFILE_COUNT(TextureUploads, 1);
+
     std::uint32_t* buff = new std::uint32_t[static_cast<size_t>(area.getWidth()) *
                               static_cast<size_t>(area.getHeight())];
     blitFromSurface(static_cast<const std::uint32_t*>(sourceData), buff,
@@ -33,9 +33,12 @@
 namespace CEGUI
 {
 //----------------------------------------------------------------------------//
-NullGeometryBuffer::NullGeometryBuffer(CEGUI::RefCounted<RenderMaterial> renderMaterial)
-    : GeometryBuffer(renderMaterial)
+NullGeometryBuffer::NullGeometryBuffer(NullRenderer& owner,
+                                       CEGUI::RefCounted<RenderMaterial> renderMaterial)
+    : GeometryBuffer(renderMaterial),
+      d_owner(owner)
 {
+    d_quadIndexingSupported = owner.isQuadIndexingEnabled();
 }
 
 //----------------------------------------------------------------------------//
@@ -46,6 +49,9 @@ NullGeometryBuffer::~NullGeometryBuffer()
 //----------------------------------------------------------------------------//
 void NullGeometryBuffer::draw() const
 {
+    if (!d_vertexData.empty())
+        d_owner.recordGeometryDraw(*this);
+
     const int pass_count = d_effect ? d_effect->getPassCount() : 1;
     for (int pass = 0; pass < pass_count; ++pass)
     {
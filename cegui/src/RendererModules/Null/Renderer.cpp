@@ -122,6 +122,12 @@ RefCounted<RenderMaterial> NullRenderer::createRenderMaterial(const DefaultShade
 
         return render_material;
     }
+    else if(shaderType == DefaultShaderType::DistanceField)
+    {
+        RefCounted<RenderMaterial> render_material(new RenderMaterial(d_shaderWrapperDistanceField));
+
+        return render_material;
+    }
     else
     {
         throw RendererException(
@@ -131,10 +137,24 @@ RefCounted<RenderMaterial> NullRenderer::createRenderMaterial(const DefaultShade
     }
 }
 
+//----------------------------------------------------------------------------//
+bool NullRenderer::supportsShaderType(const DefaultShaderType shaderType) const
+{
+    return shaderType == DefaultShaderType::Solid ||
+           shaderType == DefaultShaderType::Textured ||
+           shaderType == DefaultShaderType::DistanceField;
+}
+
+//----------------------------------------------------------------------------//
+bool NullRenderer::isGeometryBufferCreationThreadSafe() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 GeometryBuffer& NullRenderer::createGeometryBufferTextured(RefCounted<RenderMaterial> renderMaterial)
 {
-    NullGeometryBuffer* geom_buffer = new NullGeometryBuffer(renderMaterial);
+    NullGeometryBuffer* geom_buffer = new NullGeometryBuffer(*this, renderMaterial);
 
     geom_buffer->addVertexAttribute(VertexAttributeType::Position0);
     geom_buffer->addVertexAttribute(VertexAttributeType::Colour0);
@@ -147,7 +167,7 @@ GeometryBuffer& NullRenderer::createGeometryBufferTextured(RefCounted<RenderMate
 //----------------------------------------------------------------------------//
 GeometryBuffer& NullRenderer::createGeometryBufferColoured(RefCounted<RenderMaterial> renderMaterial)
 {
-    NullGeometryBuffer* geom_buffer = new NullGeometryBuffer(renderMaterial);
+    NullGeometryBuffer* geom_buffer = new NullGeometryBuffer(*this, renderMaterial);
 
     geom_buffer->addVertexAttribute(VertexAttributeType::Position0);
     geom_buffer->addVertexAttribute(VertexAttributeType::Colour0);
@@ -159,8 +179,25 @@ GeometryBuffer& NullRenderer::createGeometryBufferColoured(RefCounted<RenderMate
 //----------------------------------------------------------------------------//
 TextureTarget* NullRenderer::createTextureTarget(bool addStencilBuffer)
 {
-    TextureTarget* tt = new NullTextureTarget(*this, addStencilBuffer);
-    d_textureTargets.push_back(tt);
+    return createTextureTarget(addStencilBuffer, Sizef(0.0f, 0.0f));
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* NullRenderer::createTextureTarget(bool addStencilBuffer,
+                                                 const Sizef& size)
+{
+    TextureTarget* tt = d_textureTargetPool.acquire(addStencilBuffer, size);
+
+    if (!tt)
+    {
+        tt = new NullTextureTarget(*this, addStencilBuffer);
+        d_textureTargets.push_back(tt);
+        d_textureTargetPool.notifyTargetCreated(*tt);
+    }
+
+    if (size.d_width > 0.0f && size.d_height > 0.0f)
+        tt->declareRenderSize(size);
+
     return tt;
 }
 
@@ -171,9 +208,10 @@ void NullRenderer::destroyTextureTarget(TextureTarget* target)
                                               d_textureTargets.end(),
                                               target);
 
-    if (d_textureTargets.end() != i)
+    if (d_textureTargets.end() != i && !d_textureTargetPool.release(*target))
     {
         d_textureTargets.erase(i);
+        d_textureTargetPool.notifyTargetDestroyed(*target);
         delete target;
     }
 }
@@ -181,8 +219,20 @@ void NullRenderer::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void NullRenderer::destroyAllTextureTargets()
 {
+    // bypass the pool, every target is going away
     while (!d_textureTargets.empty())
-        destroyTextureTarget(*d_textureTargets.begin());
+    {
+        TextureTarget* target = d_textureTargets.back();
+        d_textureTargets.pop_back();
+        d_textureTargetPool.notifyTargetDestroyed(*target);
+        delete target;
+    }
+}
+
+//----------------------------------------------------------------------------//
+TextureTargetPool& NullRenderer::getTextureTargetPool()
+{
+    return d_textureTargetPool;
 }
 
 //----------------------------------------------------------------------------//
@@ -296,11 +346,43 @@ bool NullRenderer::isTextureDefined(const String& name) const
 //----------------------------------------------------------------------------//
 void NullRenderer::beginRendering()
 {
+    d_frameStatistics = FrameStatistics();
 }
 
 //----------------------------------------------------------------------------//
 void NullRenderer::endRendering()
 {
+    d_lastFrameStatistics = d_frameStatistics;
+}
+
+//----------------------------------------------------------------------------//
+const NullRenderer::FrameStatistics& NullRenderer::getLastFrameStatistics() const
+{
+    return d_lastFrameStatistics;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::setQuadIndexingEnabled(bool enabled)
+{
+    d_quadIndexingEnabled = enabled;
+}
+
+//----------------------------------------------------------------------------//
+bool NullRenderer::isQuadIndexingEnabled() const
+{
+    return d_quadIndexingEnabled;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::recordGeometryDraw(const GeometryBuffer& buffer)
+{
+    ++d_frameStatistics.d_drawCalls;
+    d_frameStatistics.d_vertexCount += buffer.getVertexCount();
+    d_frameStatistics.d_indexCount += buffer.getIndexCount();
+    d_frameStatistics.d_vertexBytes +=
+        buffer.getVertexData().size() * sizeof(float);
+    d_frameStatistics.d_indexBytes +=
+        buffer.getIndexCount() * sizeof(std::uint16_t);
 }
 
 //----------------------------------------------------------------------------//
@@ -324,7 +406,10 @@ const String& NullRenderer::getIdentifierString() const
 //----------------------------------------------------------------------------//
 NullRenderer::NullRenderer() :
     // TODO: should be set to correct value
-    d_maxTextureSize(2048)
+    d_maxTextureSize(2048),
+    d_quadIndexingEnabled(true),
+    d_frameStatistics(),
+    d_lastFrameStatistics()
 {
     constructor_impl();
 }
@@ -334,6 +419,7 @@ NullRenderer::~NullRenderer()
 {
     delete d_shaderWrapperTextured;
     delete d_shaderWrapperSolid;
+    delete d_shaderWrapperDistanceField;
 
     destroyAllGeometryBuffers();
     NullRenderer::destroyAllTextureTargets();
@@ -347,6 +433,7 @@ void NullRenderer::constructor_impl()
 {
     d_shaderWrapperTextured = new NullShaderWrapper();
     d_shaderWrapperSolid = new NullShaderWrapper();
+    d_shaderWrapperDistanceField = new NullShaderWrapper();
 
     // create default target & rendering root (surface) that uses it
     d_defaultTarget = new NullRenderTarget(*this);
@@ -28,6 +28,7 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/ImageCodec.h"
 #include "CEGUI/System.h"
+#include "CEGUI/Profiler.h"
 
 #include <cstdint>
 
@@ -94,12 +95,14 @@ void NullTexture::loadFromMemory(const void* /*buffer*/,
                                  PixelFormat)
 {
     d_size = d_dataSize = buffer_size;
+    CEGUI_PROFILE_COUNT(TextureUploads, 1);
 }
 
 //----------------------------------------------------------------------------//
 void NullTexture::blitFromMemory(const void* /*sourceData*/, const Rectf& /*area*/)
 {
-    // do nothing
+    // nothing to upload, but count it as the real renderers would.
+    CEGUI_PROFILE_COUNT(TextureUploads, 1);
 }
 
 //----------------------------------------------------------------------------//
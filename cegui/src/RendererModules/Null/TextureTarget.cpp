@@ -26,6 +26,7 @@
  ***************************************************************************/
 #include "CEGUI/RendererModules/Null/TextureTarget.h"
 #include "CEGUI/RendererModules/Null/Texture.h"
+#include "CEGUI/RendererModules/Null/Renderer.h"
 #include "CEGUI/PropertyHelper.h"
 
 // Start of CEGUI namespace section
@@ -39,7 +40,8 @@ const float NullTextureTarget::DEFAULT_SIZE = 128.0f;
 NullTextureTarget::NullTextureTarget(NullRenderer& owner, bool addStencilBuffer) :
     NullRenderTarget(owner),
     TextureTarget(addStencilBuffer),
-    d_CEGUITexture(nullptr)
+    d_CEGUITexture(nullptr),
+    d_textureSize(0.0f, 0.0f)
 {
     d_CEGUITexture = static_cast<NullTexture*>(
         &d_owner.createTexture(generateTextureName()));
@@ -74,10 +76,18 @@ Texture& NullTextureTarget::getTexture() const
 //----------------------------------------------------------------------------//
 void NullTextureTarget::declareRenderSize(const Sizef& sz)
 {
-	Rectf r;
-	r.setSize(sz);
+    Rectf r;
+    r.setSize(sz);
     r.setPosition(glm::vec2(0, 0));
     setArea(r);
+
+    // the texture is allocated by size class, so targets can be recycled
+    const Sizef texture_size(d_owner.getTextureTargetPool().getSizeClass(sz));
+    if (texture_size != d_textureSize)
+    {
+        d_textureSize = texture_size;
+        d_CEGUITexture->loadFromMemory(nullptr, d_textureSize, Texture::PixelFormat::Rgba);
+    }
 }
 
 //----------------------------------------------------------------------------//
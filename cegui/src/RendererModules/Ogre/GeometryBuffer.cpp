@@ -143,6 +143,15 @@ void OgreGeometryBuffer::appendGeometry(const float* vertex_data, std::size_t ar
     d_dataAppended = true;
 }
 
+//----------------------------------------------------------------------------//
+void OgreGeometryBuffer::updateTextureCoordinates(const Texture* texture,
+                                                  const float scaleFactor)
+{
+    GeometryBuffer::updateTextureCoordinates(texture, scaleFactor);
+
+    d_dataAppended = true;
+}
+
 void OgreGeometryBuffer::syncVertexData() const
 {
     if (!d_dataAppended)
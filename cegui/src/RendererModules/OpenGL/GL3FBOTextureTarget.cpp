@@ -73,7 +73,13 @@ OpenGL3FBOTextureTarget::~OpenGL3FBOTextureTarget()
 //----------------------------------------------------------------------------//
 void OpenGL3FBOTextureTarget::declareRenderSize(const Sizef& sz)
 {
-    setArea(Rectf(d_area.getPosition(), d_owner.getAdjustedTextureSize(sz)));
+    const Sizef texture_size(d_owner.getTextureTargetSize(sz));
+
+    // recycled targets often already have a texture of the right size
+    if (d_area.getSize() == texture_size)
+        return;
+
+    setArea(Rectf(d_area.getPosition(), texture_size));
     resizeRenderTexture();
 }
 
@@ -50,6 +50,7 @@ OpenGL3GeometryBuffer::OpenGL3GeometryBuffer(OpenGL3Renderer& owner, CEGUI::RefC
     d_glStateChanger(owner.getOpenGLStateChanger()),
     d_bufferSize(0)
 {
+    d_quadIndexingSupported = true;
     initialiseVertexBuffers();
 }
 
@@ -255,6 +256,14 @@ void OpenGL3GeometryBuffer::appendGeometry(const float* vertex_data, std::size_t
     updateOpenGLBuffers();
 }
 
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::updateTextureCoordinates(const Texture* texture, const float scaleFactor)
+{
+    OpenGLGeometryBufferBase::updateTextureCoordinates(texture, scaleFactor);
+
+    updateOpenGLBuffers();
+}
+
 //----------------------------------------------------------------------------//
 void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
 {
@@ -263,7 +272,15 @@ void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
         d_glStateChanger->disable(GL_CULL_FACE);
         d_glStateChanger->disable(GL_STENCIL_TEST);
 
-        glDrawArrays(GL_TRIANGLES, 0, d_vertexCount);
+        if (d_quadIndexed)
+        {
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,
+                static_cast<const OpenGL3Renderer&>(d_owner).getQuadIndexBuffer());
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(getIndexCount()),
+                           GL_UNSIGNED_SHORT, nullptr);
+        }
+        else
+            glDrawArrays(GL_TRIANGLES, 0, d_vertexCount);
     }
     else if(d_polygonFillRule == PolygonFillRule::EvenOdd)
     {
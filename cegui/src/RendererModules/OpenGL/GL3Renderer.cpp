@@ -137,8 +137,11 @@ void OpenGL3Renderer::destroy(OpenGL3Renderer& renderer)
 OpenGL3Renderer::OpenGL3Renderer() :
     OpenGLRendererBase(true),
     d_shaderWrapperTextured(nullptr),
+    d_shaderWrapperSolid(nullptr),
+    d_shaderWrapperDistanceField(nullptr),
     d_openGLStateChanger(nullptr),
-    d_shaderManager(nullptr)
+    d_shaderManager(nullptr),
+    d_quadIndexBuffer(0)
 {
     init();
 }
@@ -147,8 +150,11 @@ OpenGL3Renderer::OpenGL3Renderer() :
 OpenGL3Renderer::OpenGL3Renderer(const Sizef& display_size) :
     OpenGLRendererBase(display_size, true),
     d_shaderWrapperTextured(nullptr),
+    d_shaderWrapperSolid(nullptr),
+    d_shaderWrapperDistanceField(nullptr),
     d_openGLStateChanger(nullptr),
-    d_shaderManager(nullptr)
+    d_shaderManager(nullptr),
+    d_quadIndexBuffer(0)
 {
     init();
 }
@@ -164,17 +170,21 @@ void OpenGL3Renderer::init()
     d_openGLStateChanger = new OpenGL3StateChangeWrapper();
     initialiseTextureTargetFactory();
     initialiseOpenGLShaders();
+    initialiseQuadIndexBuffer();
 }
 
 //----------------------------------------------------------------------------//
 OpenGL3Renderer::~OpenGL3Renderer()
 {
+    glDeleteBuffers(1, &d_quadIndexBuffer);
+
     delete d_textureTargetFactory;
     delete d_openGLStateChanger;
     delete d_shaderManager;
 
     delete d_shaderWrapperTextured;
     delete d_shaderWrapperSolid;
+    delete d_shaderWrapperDistanceField;
 }
 
 //----------------------------------------------------------------------------//
@@ -295,6 +305,29 @@ OpenGLBaseStateChangeWrapper* OpenGL3Renderer::getOpenGLStateChanger()
     return d_openGLStateChanger;
 }
 
+//----------------------------------------------------------------------------//
+GLuint OpenGL3Renderer::getQuadIndexBuffer() const
+{
+    return d_quadIndexBuffer;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::initialiseQuadIndexBuffer()
+{
+    const std::vector<std::uint16_t>& indices = GeometryBuffer::getQuadIndices();
+
+    glGenBuffers(1, &d_quadIndexBuffer);
+    // the element array binding is part of the vao state, so it is set
+    // directly rather than through the state change wrapper.
+    if (OpenGLInfo::getSingleton().isVaoSupported())
+        d_openGLStateChanger->bindVertexArray(0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, d_quadIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                 indices.size() * sizeof(std::uint16_t), &indices[0],
+                 GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
 //----------------------------------------------------------------------------//
 void OpenGL3Renderer::initialiseOpenGLShaders()
 {
@@ -304,6 +337,7 @@ void OpenGL3Renderer::initialiseOpenGLShaders()
 
     initialiseStandardTexturedShaderWrapper();
     initialiseStandardColouredShaderWrapper();
+    initialiseStandardDistanceFieldShaderWrapper();
 }
 
 //----------------------------------------------------------------------------//
@@ -321,6 +355,12 @@ RefCounted<RenderMaterial> OpenGL3Renderer::createRenderMaterial(const DefaultSh
 
         return render_material;
     }
+    else if(shaderType == DefaultShaderType::DistanceField && d_shaderWrapperDistanceField)
+    {
+        RefCounted<RenderMaterial> render_material(new RenderMaterial(d_shaderWrapperDistanceField));
+
+        return render_material;
+    }
     else
     {
         throw RendererException(
@@ -330,6 +370,15 @@ RefCounted<RenderMaterial> OpenGL3Renderer::createRenderMaterial(const DefaultSh
     }
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGL3Renderer::supportsShaderType(const DefaultShaderType shaderType) const
+{
+    if (shaderType == DefaultShaderType::DistanceField)
+        return d_shaderWrapperDistanceField != nullptr;
+
+    return Renderer::supportsShaderType(shaderType);
+}
+
 //----------------------------------------------------------------------------//
 void OpenGL3Renderer::initialiseStandardTexturedShaderWrapper()
 {
@@ -359,6 +408,29 @@ void OpenGL3Renderer::initialiseStandardColouredShaderWrapper()
     d_shaderWrapperSolid->addAttributeVariable("inColour");
 }
 
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::initialiseStandardDistanceFieldShaderWrapper()
+{
+    OpenGLBaseShader* shader_standard_distance_field =  d_shaderManager->getShader(OpenGLBaseShaderID::StandardDistanceField);
+    // the shader is not available on every OpenGL version
+    if (!shader_standard_distance_field)
+    {
+        d_shaderWrapperDistanceField = nullptr;
+        return;
+    }
+
+    d_shaderWrapperDistanceField = new OpenGLBaseShaderWrapper(*shader_standard_distance_field, d_openGLStateChanger);
+
+    d_shaderWrapperDistanceField->addTextureUniformVariable("texture0", 0);
+
+    d_shaderWrapperDistanceField->addUniformVariable("modelViewProjMatrix");
+    d_shaderWrapperDistanceField->addUniformVariable("alphaFactor");
+
+    d_shaderWrapperDistanceField->addAttributeVariable("inPosition");
+    d_shaderWrapperDistanceField->addAttributeVariable("inTexCoord");
+    d_shaderWrapperDistanceField->addAttributeVariable("inColour");
+}
+
 //----------------------------------------------------------------------------//
 OpenGLTexture* OpenGL3Renderer::createTexture_impl(const String& name)
 {
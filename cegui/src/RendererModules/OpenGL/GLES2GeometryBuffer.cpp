@@ -258,6 +258,14 @@ void GLES2GeometryBuffer::appendGeometry(const float* vertex_data, std::size_t a
     updateOpenGLBuffers();
 }
 
+//----------------------------------------------------------------------------//
+void GLES2GeometryBuffer::updateTextureCoordinates(const Texture* texture, const float scaleFactor)
+{
+    OpenGLGeometryBufferBase::updateTextureCoordinates(texture, scaleFactor);
+
+    updateOpenGLBuffers();
+}
+
 //----------------------------------------------------------------------------//
 void GLES2GeometryBuffer::drawDependingOnFillRule() const
 {
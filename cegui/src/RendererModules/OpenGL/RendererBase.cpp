@@ -177,10 +177,28 @@ GeometryBuffer& OpenGLRendererBase::createGeometryBufferColoured(CEGUI::RefCount
 //----------------------------------------------------------------------------//
 TextureTarget* OpenGLRendererBase::createTextureTarget(bool addStencilBuffer)
 {
-    TextureTarget* t = createTextureTarget_impl(addStencilBuffer);
+    return createTextureTarget(addStencilBuffer, Sizef(0.0f, 0.0f));
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* OpenGLRendererBase::createTextureTarget(bool addStencilBuffer,
+                                                       const Sizef& size)
+{
+    TextureTarget* t = d_textureTargetPool.acquire(addStencilBuffer, size);
+
+    if (!t)
+    {
+        t = createTextureTarget_impl(addStencilBuffer);
+
+        if (!t)
+            return nullptr;
 
-    if (t)
         d_textureTargets.push_back(t);
+        d_textureTargetPool.notifyTargetCreated(*t);
+    }
+
+    if (size.d_width > 0.0f && size.d_height > 0.0f)
+        t->declareRenderSize(size);
 
     return t;
 }
@@ -192,9 +210,10 @@ void OpenGLRendererBase::destroyTextureTarget(TextureTarget* target)
                                               d_textureTargets.end(),
                                               target);
 
-    if (d_textureTargets.end() != i)
+    if (d_textureTargets.end() != i && !d_textureTargetPool.release(*target))
     {
         d_textureTargets.erase(i);
+        d_textureTargetPool.notifyTargetDestroyed(*target);
         delete target;
     }
 }
@@ -202,8 +221,26 @@ void OpenGLRendererBase::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void OpenGLRendererBase::destroyAllTextureTargets()
 {
+    // bypass the pool, every target is going away
     while (!d_textureTargets.empty())
-        destroyTextureTarget(*d_textureTargets.begin());
+    {
+        TextureTarget* target = d_textureTargets.back();
+        d_textureTargets.pop_back();
+        d_textureTargetPool.notifyTargetDestroyed(*target);
+        delete target;
+    }
+}
+
+//----------------------------------------------------------------------------//
+Sizef OpenGLRendererBase::getTextureTargetSize(const Sizef& sz)
+{
+    return getAdjustedTextureSize(d_textureTargetPool.getSizeClass(sz));
+}
+
+//----------------------------------------------------------------------------//
+TextureTargetPool& OpenGLRendererBase::getTextureTargetPool()
+{
+    return d_textureTargetPool;
 }
 
 //----------------------------------------------------------------------------//
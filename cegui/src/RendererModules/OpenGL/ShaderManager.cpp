@@ -79,6 +79,7 @@ void OpenGLBaseShaderManager::initialiseShaders()
         {
             loadShader(OpenGLBaseShaderID::StandardTextured, StandardShaderTexturedVertDesktopOpengl3, StandardShaderTexturedFragDesktopOpengl3);
             loadShader(OpenGLBaseShaderID::StandardSolid, StandardShaderSolidVertDesktopOpengl3, StandardShaderSolidFragDesktopOpengl3);
+            loadShader(OpenGLBaseShaderID::StandardDistanceField, StandardShaderTexturedVertDesktopOpengl3, StandardShaderDistanceFieldFragDesktopOpengl3);
         }
         else if (OpenGLInfo::getSingleton().verMajor() <= 2) // Open GL ES < 3
         {
@@ -89,16 +90,15 @@ void OpenGLBaseShaderManager::initialiseShaders()
         {
             loadShader(OpenGLBaseShaderID::StandardTextured, StandardShaderTexturedVertOpenglEs3, StandardShaderTexturedFragOpenglEs3);
             loadShader(OpenGLBaseShaderID::StandardSolid, StandardShaderSolidVertOpenglEs3, StandardShaderSolidFragOpenglEs3);
+            loadShader(OpenGLBaseShaderID::StandardDistanceField, StandardShaderTexturedVertOpenglEs3, StandardShaderDistanceFieldFragOpenglEs3);
         }
 
             
-        if(!getShader(OpenGLBaseShaderID::StandardTextured)->isCreatedSuccessfully() ||
-           !getShader(OpenGLBaseShaderID::StandardSolid)->isCreatedSuccessfully() )
+        for (const auto& shader : d_shaders)
         {
-            throw RendererException("Critical Error - One or multiple shader "
-                                    "programs weren't created successfully");
-
-            return;
+            if (!shader.second->isCreatedSuccessfully())
+                throw RendererException("Critical Error - One or multiple shader "
+                                        "programs weren't created successfully");
         }
 
         const CEGUI::String notify("OpenGL3Renderer: Notification - "
@@ -99,6 +99,27 @@ static const char StandardShaderTexturedFragDesktopOpengl3[] =
 "}"
 ;
 
+/*! A string containing a desktop OpenGL 3.2 fragment shader for polygons that
+    are textured with a signed distance field in the texture's alpha channel,
+    such as scalable glyphs. The edge at a distance of 0.5 is antialiased over
+    the screen space derivative of the distance, so the result stays sharp at
+    any scale. The colour supplied to the shader is used as fill colour. */
+static const char StandardShaderDistanceFieldFragDesktopOpengl3[] = 
+"#version 150 core\n"
+"uniform sampler2D texture0;\n"
+"in vec2 exTexCoord;\n"
+"in vec4 exColour;\n"
+"out vec4 out0;\n"
+"uniform float alphaFactor;\n"
+"void main(void)\n"
+"{\n"
+    "float distance = texture(texture0, exTexCoord).a;\n"
+    "float width = max(fwidth(distance), 0.0001);\n"
+    "float coverage = smoothstep(0.5 - width, 0.5 + width, distance);\n"
+    "out0 = vec4(exColour.rgb, exColour.a * coverage * alphaFactor);\n"
+"}"
+;
+
 /*! A string containing an OpenGL ES 3.0 vertex shader for solid colouring of a
     polygon. */
 static const char StandardShaderSolidVertOpenglEs3[] = 
@@ -170,6 +191,25 @@ static const char StandardShaderTexturedFragOpenglEs3[] =
 "}"
 ;
 
+/*! A string containing an OpenGL ES 3.0 fragment shader for polygons that are
+    textured with a signed distance field in the texture's alpha channel. */
+static const char StandardShaderDistanceFieldFragOpenglEs3[] = 
+"#version 300 es\n"
+"precision highp float;\n"
+"uniform sampler2D texture0;\n"
+"in vec2 exTexCoord;\n"
+"in vec4 exColour;\n"
+"layout(location = 0) out vec4 out0;\n"
+"uniform float alphaFactor;\n"
+"void main(void)\n"
+"{\n"
+    "float distance = texture(texture0, exTexCoord).a;\n"
+    "float width = max(fwidth(distance), 0.0001);\n"
+    "float coverage = smoothstep(0.5 - width, 0.5 + width, distance);\n"
+    "out0 = vec4(exColour.rgb, exColour.a * coverage * alphaFactor);\n"
+"}"
+;
+
 /*!  A string containing an OpenGL ES 2.0 vertex shader for solid. */
 static const char StandardShaderSolidVertOpenglEs2[] = 
 "#version 100\n"
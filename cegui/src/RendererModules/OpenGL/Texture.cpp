@@ -30,6 +30,7 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/System.h"
 #include "CEGUI/ImageCodec.h"
+#include "CEGUI/Profiler.h"
 
 #include <cmath>
 
@@ -306,6 +307,7 @@ void OpenGLTexture::blitFromMemory(const void* sourceData, const Rectf& area)
 
     // do the real work of getting the data into the texture
     glBindTexture(GL_TEXTURE_2D, d_ogltexture);
+    CEGUI_PROFILE_COUNT(TextureUploads, 1);
 
     if (d_isCompressed)
         loadCompressedTextureBuffer(area, sourceData);
@@ -27,6 +27,7 @@
 #include "CEGUI/RenderingSurface.h"
 #include "CEGUI/RenderTarget.h"
 #include "CEGUI/RenderingWindow.h"
+#include "CEGUI/Profiler.h"
 #include <algorithm>
 
 // Start of CEGUI namespace section
@@ -104,6 +105,8 @@ void RenderingSurface::clearGeometry()
 //----------------------------------------------------------------------------//
 void RenderingSurface::draw()
 {
+    CEGUI_PROFILE_ZONE("RenderingSurface::draw");
+
     d_target->activate();
 
     drawContent();
@@ -262,40 +262,30 @@ void RenderingWindow::realiseGeometry_impl()
 
     const Rectf area(0, 0, d_size.d_width, d_size.d_height);
     const glm::vec4 colour(1.0, 1.0, 1.0, 1.0);
-    TexturedColouredVertex vbuffer[6];
+    TexturedColouredVertex vbuffer[4];
 
-    // vertex 0
+    // top-left
     vbuffer[0].d_position   = glm::vec3(area.d_min.x, area.d_min.y, 0.0f);
     vbuffer[0].d_colour = colour;
     vbuffer[0].d_texCoords = glm::vec2(tex_rect.d_min.x, tex_rect.d_min.y);
 
-    // vertex 1
+    // bottom-left
     vbuffer[1].d_position   = glm::vec3(area.d_min.x, area.d_max.y, 0.0f);
     vbuffer[1].d_colour = colour;
     vbuffer[1].d_texCoords = glm::vec2(tex_rect.d_min.x, tex_rect.d_max.y);
 
-    // vertex 2
+    // bottom-right
     vbuffer[2].d_position   = glm::vec3(area.d_max.x, area.d_max.y, 0.0f);
     vbuffer[2].d_colour = colour;
     vbuffer[2].d_texCoords = glm::vec2(tex_rect.d_max.x, tex_rect.d_max.y);
 
-    // vertex 3
+    // top-right
     vbuffer[3].d_position   = glm::vec3(area.d_max.x, area.d_min.y, 0.0f);
     vbuffer[3].d_colour = colour;
     vbuffer[3].d_texCoords = glm::vec2(tex_rect.d_max.x, tex_rect.d_min.y);
 
-    // vertex 4
-    vbuffer[4].d_position   = glm::vec3(area.d_min.x, area.d_min.y, 0.0f);
-    vbuffer[4].d_colour = colour;
-    vbuffer[4].d_texCoords = glm::vec2(tex_rect.d_min.x, tex_rect.d_min.y);
-
-    // vertex 5
-    vbuffer[5].d_position   = glm::vec3(area.d_max.x, area.d_max.y, 0.0f);
-    vbuffer[5].d_colour = colour;
-    vbuffer[5].d_texCoords = glm::vec2(tex_rect.d_max.x, tex_rect.d_max.y);
-
     d_geometryBuffer.setTexture("texture0", &tex);
-    d_geometryBuffer.appendGeometry(vbuffer, 6);
+    d_geometryBuffer.appendQuad(vbuffer);
 }
 
 //----------------------------------------------------------------------------//
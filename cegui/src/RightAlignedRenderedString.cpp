@@ -26,6 +26,7 @@
  ***************************************************************************/
 #include "CEGUI/RightAlignedRenderedString.h"
 #include "CEGUI/RenderedString.h"
+#include "CEGUI/Profiler.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -41,6 +42,8 @@ RightAlignedRenderedString::RightAlignedRenderedString(
 void RightAlignedRenderedString::format(const Window* ref_wnd,
                                         const Sizef& area_size)
 {
+    CEGUI_PROFILE_ZONE("FormattedRenderedString::format");
+
     d_offsets.clear();
 
     for (size_t i = 0; i < d_renderedString->getLineCount(); ++i)
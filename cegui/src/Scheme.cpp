@@ -31,6 +31,7 @@
 #include "CEGUI/SchemeManager.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/ImageManager.h"
+#include "CEGUI/ImageAtlasBuilder.h"
 #include "CEGUI/FontManager.h"
 #include "CEGUI/Font.h"
 #include "CEGUI/WindowFactoryManager.h"
@@ -108,6 +109,7 @@ void Scheme::loadResources(void)
     loadWindowFactories();
     loadFactoryAliases();
     loadFalagardMappings();
+    buildImageAtlas();
 
     Logger::getSingleton().logEvent("---- Resource loading for GUI scheme '" + d_name + "' completed ----", LoggingLevel::Informative);
 }
@@ -190,6 +192,25 @@ void Scheme::loadImageFileImagesets()
     }
 }
 
+/*************************************************************************
+    Pack the images queued while loading into shared atlas textures.
+*************************************************************************/
+void Scheme::buildImageAtlas()
+{
+    ImageManager& imgr = ImageManager::getSingleton();
+
+    if (!imgr.isImageAtlasingEnabled())
+        return;
+
+    const ImageAtlasBuilder::Statistics stats = imgr.buildImageAtlas();
+
+    Logger::getSingleton().logEvent("Scheme '" + d_name + "' atlased " +
+        PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(stats.d_texturesBefore)) +
+        " textures into " +
+        PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(stats.d_texturesAfter)) +
+        " (fill ratio " + PropertyHelper<float>::toString(stats.d_fillRatio) + ")");
+}
+
 /*************************************************************************
     Load all xml based fonts specified.
 *************************************************************************/
@@ -0,0 +1,137 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Implements a bounded cache of shaped text runs
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ShapedTextCache.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const size_t ShapedTextCache::DefaultMaxGlyphCount(16384);
+
+//----------------------------------------------------------------------------//
+ShapedTextCache::ShapedTextCache(size_t max_glyph_count) :
+    d_maxGlyphCount(max_glyph_count),
+    d_glyphCount(0),
+    d_hitCount(0),
+    d_missCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+size_t ShapedTextCache::KeyHasher::operator()(const Key& key) const
+{
+    return std::hash<std::u32string>()(key.d_text) * 31 +
+        static_cast<size_t>(key.d_direction);
+}
+
+//----------------------------------------------------------------------------//
+const ShapedTextCache::Run* ShapedTextCache::find(const std::u32string& text,
+                                                  DefaultParagraphDirection dir)
+{
+    const RunMap::iterator it = d_runs.find(Key{text, dir});
+
+    if (it == d_runs.end())
+    {
+        ++d_missCount;
+        return nullptr;
+    }
+
+    ++d_hitCount;
+    // mark as most recently used
+    d_usage.splice(d_usage.end(), d_usage, it->second.d_usage);
+
+    return &it->second.d_run;
+}
+
+//----------------------------------------------------------------------------//
+const ShapedTextCache::Run& ShapedTextCache::insert(const std::u32string& text,
+                                                    DefaultParagraphDirection dir,
+                                                    Run run)
+{
+    if (run.size() > d_maxGlyphCount)
+    {
+        d_uncachedRun = std::move(run);
+        return d_uncachedRun;
+    }
+
+    Key key{text, dir};
+    const RunMap::iterator existing = d_runs.find(key);
+    if (existing != d_runs.end())
+    {
+        d_glyphCount -= existing->second.d_run.size();
+        d_usage.erase(existing->second.d_usage);
+        d_runs.erase(existing);
+    }
+
+    makeRoom(run.size());
+
+    d_glyphCount += run.size();
+    const RunMap::iterator it = d_runs.emplace(std::move(key), Entry{std::move(run), UsageList::iterator()}).first;
+    it->second.d_usage = d_usage.insert(d_usage.end(), &it->first);
+
+    return it->second.d_run;
+}
+
+//----------------------------------------------------------------------------//
+void ShapedTextCache::makeRoom(size_t count)
+{
+    while (!d_usage.empty() && d_glyphCount + count > d_maxGlyphCount)
+    {
+        const RunMap::iterator it = d_runs.find(*d_usage.front());
+        d_glyphCount -= it->second.d_run.size();
+        d_usage.pop_front();
+        d_runs.erase(it);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ShapedTextCache::clear()
+{
+    d_runs.clear();
+    d_usage.clear();
+    d_uncachedRun.clear();
+    d_glyphCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+void ShapedTextCache::setMaxGlyphCount(size_t count)
+{
+    d_maxGlyphCount = count;
+    makeRoom(0);
+}
+
+//----------------------------------------------------------------------------//
+void ShapedTextCache::resetStatistics()
+{
+    d_hitCount = 0;
+    d_missCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -31,9 +31,284 @@
 
 #if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32)
 
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define CEGUI_STRING_SSE2
+#   include <emmintrin.h>
+#   if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#       define CEGUI_STRING_AVX2
+#       include <immintrin.h>
+#   endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#   define CEGUI_STRING_NEON
+#   include <arm_neon.h>
+#endif
+
 namespace CEGUI
 {
 
+namespace
+{
+/*
+    The ASCII transcoders below convert whole blocks of ASCII code units at a
+    time, starting at the beginning of the input, and stop at the first block
+    that contains a code unit that is not ASCII or that would run past the end
+    of the input. They return the number of code units they converted; the
+    caller handles the rest of the input one code point at a time.
+*/
+typedef size_t (*WidenAsciiFunction)(const char* src, size_t count, char32_t* dst);
+typedef size_t (*NarrowAsciiFunction)(const char32_t* src, size_t count, char* dst);
+
+#if !defined(CEGUI_STRING_SSE2) && !defined(CEGUI_STRING_NEON)
+//----------------------------------------------------------------------------//
+size_t widenAsciiScalar(const char* src, size_t count, char32_t* dst)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        std::uint64_t block;
+        std::memcpy(&block, src + i, sizeof(block));
+        if (block & 0x8080808080808080ULL)
+            break;
+
+        for (size_t j = 0; j < 8; ++j)
+            dst[i + j] = static_cast<char32_t>(src[i + j]);
+    }
+
+    return i;
+}
+
+//----------------------------------------------------------------------------//
+size_t narrowAsciiScalar(const char32_t* src, size_t count, char* dst)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        char32_t combined = 0;
+        for (size_t j = 0; j < 8; ++j)
+            combined |= src[i + j];
+
+        if (combined >= 0x80)
+            break;
+
+        for (size_t j = 0; j < 8; ++j)
+            dst[i + j] = static_cast<char>(src[i + j]);
+    }
+
+    return i;
+}
+#endif
+
+#if defined(CEGUI_STRING_SSE2)
+//----------------------------------------------------------------------------//
+size_t widenAsciiSse2(const char* src, size_t count, char32_t* dst)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (_mm_movemask_epi8(bytes) != 0)
+            break;
+
+        const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+        __m128i* out = reinterpret_cast<__m128i*>(dst + i);
+        _mm_storeu_si128(out, _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+    }
+
+    return i;
+}
+
+//----------------------------------------------------------------------------//
+size_t narrowAsciiSse2(const char32_t* src, size_t count, char* dst)
+{
+    const __m128i nonAsciiBits = _mm_set1_epi32(~0x7F);
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i* in = reinterpret_cast<const __m128i*>(src + i);
+        const __m128i a = _mm_loadu_si128(in);
+        const __m128i b = _mm_loadu_si128(in + 1);
+        const __m128i c = _mm_loadu_si128(in + 2);
+        const __m128i d = _mm_loadu_si128(in + 3);
+
+        const __m128i combined = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(combined, nonAsciiBits), zero)) != 0xFFFF)
+            break;
+
+        const __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), bytes);
+    }
+
+    return i;
+}
+#endif
+
+#if defined(CEGUI_STRING_AVX2)
+//----------------------------------------------------------------------------//
+__attribute__((target("avx2")))
+size_t widenAsciiAvx2(const char* src, size_t count, char32_t* dst)
+{
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        if (_mm256_movemask_epi8(bytes) != 0)
+            break;
+
+        __m256i* out = reinterpret_cast<__m256i*>(dst + i);
+        for (int j = 0; j < 4; ++j)
+        {
+            const __m128i eight = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i + j * 8));
+            _mm256_storeu_si256(out + j, _mm256_cvtepu8_epi32(eight));
+        }
+    }
+
+    return i;
+}
+
+//----------------------------------------------------------------------------//
+__attribute__((target("avx2")))
+size_t narrowAsciiAvx2(const char32_t* src, size_t count, char* dst)
+{
+    const __m256i nonAsciiBits = _mm256_set1_epi32(~0x7F);
+
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i* in = reinterpret_cast<const __m256i*>(src + i);
+        const __m256i a = _mm256_loadu_si256(in);
+        const __m256i b = _mm256_loadu_si256(in + 1);
+        const __m256i c = _mm256_loadu_si256(in + 2);
+        const __m256i d = _mm256_loadu_si256(in + 3);
+
+        const __m256i combined = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+        if (!_mm256_testz_si256(combined, nonAsciiBits))
+            break;
+
+        // packing works per 128 bit lane, so restore the order afterwards.
+        const __m256i words = _mm256_packs_epi32(a, b);
+        const __m256i words2 = _mm256_packs_epi32(c, d);
+        const __m256i bytes = _mm256_packus_epi16(words, words2);
+        const __m256i ordered = _mm256_permutevar8x32_epi32(
+            bytes, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), ordered);
+    }
+
+    return i;
+}
+#endif
+
+#if defined(CEGUI_STRING_NEON)
+//----------------------------------------------------------------------------//
+size_t widenAsciiNeon(const char* src, size_t count, char32_t* dst)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16_t bytes = vld1q_u8(reinterpret_cast<const std::uint8_t*>(src + i));
+        if (vmaxvq_u8(bytes) >= 0x80)
+            break;
+
+        const uint16x8_t low = vmovl_u8(vget_low_u8(bytes));
+        const uint16x8_t high = vmovl_u8(vget_high_u8(bytes));
+        std::uint32_t* out = reinterpret_cast<std::uint32_t*>(dst + i);
+        vst1q_u32(out, vmovl_u16(vget_low_u16(low)));
+        vst1q_u32(out + 4, vmovl_u16(vget_high_u16(low)));
+        vst1q_u32(out + 8, vmovl_u16(vget_low_u16(high)));
+        vst1q_u32(out + 12, vmovl_u16(vget_high_u16(high)));
+    }
+
+    return i;
+}
+
+//----------------------------------------------------------------------------//
+size_t narrowAsciiNeon(const char32_t* src, size_t count, char* dst)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const std::uint32_t* in = reinterpret_cast<const std::uint32_t*>(src + i);
+        const uint32x4_t a = vld1q_u32(in);
+        const uint32x4_t b = vld1q_u32(in + 4);
+        const uint32x4_t c = vld1q_u32(in + 8);
+        const uint32x4_t d = vld1q_u32(in + 12);
+
+        if (vmaxvq_u32(vmaxq_u32(vmaxq_u32(a, b), vmaxq_u32(c, d))) >= 0x80)
+            break;
+
+        const uint16x8_t low = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+        const uint16x8_t high = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+        vst1q_u8(reinterpret_cast<std::uint8_t*>(dst + i),
+                 vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+    }
+
+    return i;
+}
+#endif
+
+//----------------------------------------------------------------------------//
+struct AsciiTranscoders
+{
+    WidenAsciiFunction d_widen;
+    NarrowAsciiFunction d_narrow;
+};
+
+//----------------------------------------------------------------------------//
+AsciiTranscoders selectAsciiTranscoders()
+{
+#if defined(CEGUI_STRING_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        const AsciiTranscoders avx2 = { widenAsciiAvx2, narrowAsciiAvx2 };
+        return avx2;
+    }
+#endif
+
+#if defined(CEGUI_STRING_SSE2)
+    const AsciiTranscoders sse2 = { widenAsciiSse2, narrowAsciiSse2 };
+    return sse2;
+#elif defined(CEGUI_STRING_NEON)
+    const AsciiTranscoders neon = { widenAsciiNeon, narrowAsciiNeon };
+    return neon;
+#else
+    const AsciiTranscoders scalar = { widenAsciiScalar, narrowAsciiScalar };
+    return scalar;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+const AsciiTranscoders& getAsciiTranscoders()
+{
+    static const AsciiTranscoders transcoders = selectAsciiTranscoders();
+    return transcoders;
+}
+
+//----------------------------------------------------------------------------//
+size_t getUtf8CodeUnitCount(const char32_t* utf32String, const size_t stringLength)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < stringLength; ++i)
+    {
+        const char32_t codeUnit = utf32String[i];
+        count += 1 + (codeUnit >= 0x80) + (codeUnit >= 0x800) + (codeUnit >= 0x10000);
+    }
+
+    return count;
+}
+
+}
+
 std::u32string String::convertUtf8ToUtf32(const char* utf8String)
 {
     if(utf8String == nullptr)
@@ -66,22 +341,68 @@ std::u32string String::convertUtf8ToUtf32(const char* utf8String, const size_t s
     if (utf8String == nullptr)
         return std::u32string();
 
-    std::u32string utf32String;
+    // Every code point uses at least one code unit, so this is large enough.
+    std::u32string utf32String(stringLength, U'\0');
+    char32_t* const utf32Data = &utf32String[0];
+    const WidenAsciiFunction widenAscii = getAsciiTranscoders().d_widen;
 
     // Go through every UTF-8 code unit
     size_t currentCharIndex = 0;
+    size_t codePointCount = 0;
     while (currentCharIndex < stringLength)
     {
-        size_t remainingCodeUnits = stringLength - currentCharIndex;
-        size_t usedCodeUnits;
-        char32_t utf32CodePoint = getCodePointFromCodeUnits(utf8String + currentCharIndex,
-                                                            remainingCodeUnits,
-                                                            usedCodeUnits);
-        currentCharIndex += usedCodeUnits;
+        if (static_cast<unsigned char>(utf8String[currentCharIndex]) < 0x80)
+        {
+            // Convert a run of ASCII in blocks, then finish it one at a time
+            const size_t converted = widenAscii(utf8String + currentCharIndex,
+                                                stringLength - currentCharIndex,
+                                                utf32Data + codePointCount);
+            currentCharIndex += converted;
+            codePointCount += converted;
+
+            while (currentCharIndex < stringLength &&
+                   static_cast<unsigned char>(utf8String[currentCharIndex]) < 0x80)
+            {
+                utf32Data[codePointCount++] =
+                    static_cast<char32_t>(utf8String[currentCharIndex++]);
+            }
+
+            continue;
+        }
+
+        const char* const codeUnits = utf8String + currentCharIndex;
+        const size_t remainingCodeUnits = stringLength - currentCharIndex;
+        const unsigned char initialCodeUnit = static_cast<unsigned char>(codeUnits[0]);
 
-        utf32String.push_back(utf32CodePoint);
+        // Decode the common well formed cases directly
+        if (initialCodeUnit >= 0xC0 && initialCodeUnit < 0xE0 && remainingCodeUnits >= 2)
+        {
+            utf32Data[codePointCount++] = convertCodePoint(codeUnits[0], codeUnits[1]);
+            currentCharIndex += 2;
+        }
+        else if (initialCodeUnit >= 0xE0 && initialCodeUnit < 0xF0 && remainingCodeUnits >= 3)
+        {
+            utf32Data[codePointCount++] = convertCodePoint(codeUnits[0], codeUnits[1],
+                                                           codeUnits[2]);
+            currentCharIndex += 3;
+        }
+        else if (initialCodeUnit >= 0xF0 && initialCodeUnit < 0xF8 && remainingCodeUnits >= 4)
+        {
+            utf32Data[codePointCount++] = convertCodePoint(codeUnits[0], codeUnits[1],
+                                                           codeUnits[2], codeUnits[3]);
+            currentCharIndex += 4;
+        }
+        else
+        {
+            size_t usedCodeUnits;
+            utf32Data[codePointCount++] = getCodePointFromCodeUnits(codeUnits,
+                                                                    remainingCodeUnits,
+                                                                    usedCodeUnits);
+            currentCharIndex += usedCodeUnits;
+        }
     }
 
+    utf32String.resize(codePointCount);
     return utf32String;
 }
 
@@ -117,36 +438,66 @@ std::string String::convertUtf32ToUtf8(const char32_t* utf32String, const size_t
     if (utf32String == nullptr)
         return std::string();
 
-    std::string utf8EncodedString;
-    
-    // Go through every UTF-32 code unit
-    for (size_t currentCharIndex = 0; currentCharIndex < stringLength; ++currentCharIndex)
+    const NarrowAsciiFunction narrowAscii = getAsciiTranscoders().d_narrow;
+
+    // Optimistically assume ASCII, which needs one code unit per code point
+    std::string utf8EncodedString(stringLength, '\0');
+    size_t currentCharIndex = narrowAscii(utf32String, stringLength, &utf8EncodedString[0]);
+    while (currentCharIndex < stringLength && utf32String[currentCharIndex] < 0x80)
     {
-        const char32_t& currentCodeUnit = utf32String[currentCharIndex];
+        utf8EncodedString[currentCharIndex] = static_cast<char>(utf32String[currentCharIndex]);
+        ++currentCharIndex;
+    }
+
+    if (currentCharIndex == stringLength)
+        return utf8EncodedString;
+
+    // Otherwise make room for the code units of the remaining code points
+    utf8EncodedString.resize(currentCharIndex +
+        getUtf8CodeUnitCount(utf32String + currentCharIndex, stringLength - currentCharIndex));
+    char* const utf8Data = &utf8EncodedString[0];
+    size_t codeUnitIndex = currentCharIndex;
+
+    // Go through every remaining UTF-32 code unit
+    while (currentCharIndex < stringLength)
+    {
+        const char32_t currentCodeUnit = utf32String[currentCharIndex++];
 
         // Check if the UTF-32 code unit can be represented by a single UTF-8 code-unit
-        if (currentCodeUnit < 0x80) 
-            utf8EncodedString.push_back(static_cast<char>(currentCodeUnit));
+        if (currentCodeUnit < 0x80)
+        {
+            utf8Data[codeUnitIndex++] = static_cast<char>(currentCodeUnit);
+
+            // Convert the rest of a run of ASCII in blocks, then one at a time
+            const size_t converted = narrowAscii(utf32String + currentCharIndex,
+                                                 stringLength - currentCharIndex,
+                                                 utf8Data + codeUnitIndex);
+            currentCharIndex += converted;
+            codeUnitIndex += converted;
+
+            while (currentCharIndex < stringLength && utf32String[currentCharIndex] < 0x80)
+                utf8Data[codeUnitIndex++] = static_cast<char>(utf32String[currentCharIndex++]);
+        }
         // Check if the UTF-32 code unit can be represented by two UTF-8 code-units
         else if (currentCodeUnit < 0x800)
         {
-            utf8EncodedString.push_back(static_cast<char>((currentCodeUnit >> 6)   | 0xC0));
-            utf8EncodedString.push_back(static_cast<char>((currentCodeUnit & 0x3F) | 0x80));
+            utf8Data[codeUnitIndex++] = static_cast<char>((currentCodeUnit >> 6)   | 0xC0);
+            utf8Data[codeUnitIndex++] = static_cast<char>((currentCodeUnit & 0x3F) | 0x80);
         }
         // Check if the UTF-32 code unit can be represented by three UTF-8 code-units
         else if (currentCodeUnit < 0x10000)
         {
-            utf8EncodedString.push_back(static_cast<char>((currentCodeUnit  >> 12)         | 0xE0));
-            utf8EncodedString.push_back(static_cast<char>(((currentCodeUnit >> 6)  & 0x3F) | 0x80));
-            utf8EncodedString.push_back(static_cast<char>((currentCodeUnit         & 0x3F) | 0x80));
+            utf8Data[codeUnitIndex++] = static_cast<char>((currentCodeUnit  >> 12)         | 0xE0);
+            utf8Data[codeUnitIndex++] = static_cast<char>(((currentCodeUnit >> 6)  & 0x3F) | 0x80);
+            utf8Data[codeUnitIndex++] = static_cast<char>((currentCodeUnit         & 0x3F) | 0x80);
         }
         // Otherwise the UTF-32 code unit can only be represented by four UTF-8 code-units
         else
         {
-            utf8EncodedString.push_back(static_cast<char>((currentCodeUnit  >> 18)         | 0xF0));
-            utf8EncodedString.push_back(static_cast<char>(((currentCodeUnit >> 12) & 0x3F) | 0x80));
-            utf8EncodedString.push_back(static_cast<char>(((currentCodeUnit >> 6)  & 0x3F) | 0x80));
-            utf8EncodedString.push_back(static_cast<char>((currentCodeUnit         & 0x3F) | 0x80));
+            utf8Data[codeUnitIndex++] = static_cast<char>((currentCodeUnit  >> 18)         | 0xF0);
+            utf8Data[codeUnitIndex++] = static_cast<char>(((currentCodeUnit >> 12) & 0x3F) | 0x80);
+            utf8Data[codeUnitIndex++] = static_cast<char>(((currentCodeUnit >> 6)  & 0x3F) | 0x80);
+            utf8Data[codeUnitIndex++] = static_cast<char>((currentCodeUnit         & 0x3F) | 0x80);
         }
     }
 
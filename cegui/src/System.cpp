@@ -42,6 +42,7 @@
 #include "CEGUI/Config_xmlHandler.h"
 #include "CEGUI/ResourceProvider.h"
 #include "CEGUI/GlobalEventSet.h"
+#include "CEGUI/Profiler.h"
 #include "CEGUI/falagard/WidgetLookManager.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/WindowRendererManager.h"
@@ -55,6 +56,7 @@
 #include "CEGUI/RegexMatcher.h"
 #include "CEGUI/SharedStringStream.h"
 #include "CEGUI/svg/SVGDataManager.h"
+#include "CEGUI/svg/SVGData.h"
 #ifdef CEGUI_HAS_PCRE_REGEX
 #   include "CEGUI/PCRERegexMatcher.h"
 #endif
@@ -415,6 +417,11 @@ const String& System::getVerboseVersion()
 //----------------------------------------------------------------------------//
 void System::renderAllGUIContexts()
 {
+    CEGUI_PROFILE_ZONE("System::renderAllGUIContexts");
+
+    // add the glyphs rasterised in the background since the last frame
+    FontManager::getSingleton().processPendingGlyphs();
+
     d_renderer->beginRendering();
 
     for (GUIContextCollection::iterator i = d_guiContexts.begin();
@@ -428,10 +435,18 @@ void System::renderAllGUIContexts()
 
     // do final destruction on dead-pool windows
     WindowManager::getSingleton().cleanDeadPool();
+
+    // destroy SVG rasterisations that were evicted while rendering
+    SVGData::destroyRetiredRasterisations();
+
+    Profiler::getSingleton().endFrame();
 }
 
 void System::renderAllGUIContextsOnTarget(Renderer* /*contained_in*/)
 {
+    // add the glyphs rasterised in the background since the last frame
+    FontManager::getSingleton().processPendingGlyphs();
+
     d_renderer->beginRendering();
 
     for (GUIContextCollection::iterator i = d_guiContexts.begin();
@@ -447,6 +462,11 @@ void System::renderAllGUIContextsOnTarget(Renderer* /*contained_in*/)
 
     // do final destruction on dead-pool windows
     WindowManager::getSingleton().cleanDeadPool();
+
+    // destroy SVG rasterisations that were evicted while rendering
+    SVGData::destroyRetiredRasterisations();
+
+    Profiler::getSingleton().endFrame();
 }
 
 /*************************************************************************
@@ -588,6 +608,8 @@ void System::executeScriptString(const String& str) const
 *************************************************************************/
 bool System::injectTimePulse(float timeElapsed)
 {
+    CEGUI_PROFILE_ZONE("System::injectTimePulse");
+
     AnimationManager::getSingleton().autoStepInstances(timeElapsed);
     return true;
 }
@@ -708,6 +730,7 @@ void System::createSingletons()
     new WindowRendererManager();
     new RenderEffectManager();
     new SVGDataManager();
+    new Profiler();
 }
 
 void System::destroySingletons()
@@ -723,6 +746,7 @@ void System::destroySingletons()
     delete ImageManager::getSingletonPtr();
     delete GlobalEventSet::getSingletonPtr();
     delete SVGDataManager::getSingletonPtr();
+    delete Profiler::getSingletonPtr();
 }
 
 //----------------------------------------------------------------------------//
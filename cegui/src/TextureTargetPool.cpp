@@ -0,0 +1,208 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Implements the pool recycling TextureTargets by size class
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TextureTargetPool.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/Texture.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+static std::size_t getByteSize(const Sizef& size, bool stencil)
+{
+    const std::size_t pixels = static_cast<std::size_t>(size.d_width) *
+                               static_cast<std::size_t>(size.d_height);
+
+    // RGBA8 colour buffer plus an 8 bit stencil buffer if attached
+    return pixels * (stencil ? 5 : 4);
+}
+
+//----------------------------------------------------------------------------//
+TextureTargetPool::TextureTargetPool() :
+    d_sizeGranularity(64.0f),
+    d_maxPooledBytes(32 * 1024 * 1024),
+    d_reuseCount(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::notifyTargetCreated(TextureTarget& target)
+{
+    d_usedTargets.push_back(&target);
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::notifyTargetDestroyed(TextureTarget& target)
+{
+    d_usedTargets.erase(
+        std::remove(d_usedTargets.begin(), d_usedTargets.end(), &target),
+        d_usedTargets.end());
+    d_pooledTargets.erase(
+        std::remove(d_pooledTargets.begin(), d_pooledTargets.end(), &target),
+        d_pooledTargets.end());
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* TextureTargetPool::acquire(bool addStencilBuffer, const Sizef& size)
+{
+    const Sizef size_class(getSizeClass(size));
+
+    std::vector<TextureTarget*>::iterator best = d_pooledTargets.end();
+    float best_area = 0.0f;
+
+    for (std::vector<TextureTarget*>::iterator i = d_pooledTargets.begin();
+         i != d_pooledTargets.end(); ++i)
+    {
+        if ((*i)->getUsesStencil() != addStencilBuffer)
+            continue;
+
+        const Sizef target_size((*i)->getTexture().getSize());
+
+        // a target of the very same size class needs no resizing at all
+        if (getSizeClass(target_size) == size_class)
+        {
+            best = i;
+            break;
+        }
+
+        // otherwise prefer the smallest target the content fits into
+        if (target_size.d_width < size_class.d_width ||
+            target_size.d_height < size_class.d_height)
+            continue;
+
+        const float area = target_size.d_width * target_size.d_height;
+        if (best == d_pooledTargets.end() || area < best_area)
+        {
+            best = i;
+            best_area = area;
+        }
+    }
+
+    if (best == d_pooledTargets.end())
+        return nullptr;
+
+    TextureTarget* target = *best;
+    d_pooledTargets.erase(best);
+    d_usedTargets.push_back(target);
+    ++d_reuseCount;
+
+    target->clear();
+    return target;
+}
+
+//----------------------------------------------------------------------------//
+bool TextureTargetPool::release(TextureTarget& target)
+{
+    const std::vector<TextureTarget*>::iterator i =
+        std::find(d_usedTargets.begin(), d_usedTargets.end(), &target);
+
+    if (i == d_usedTargets.end())
+        return false;
+
+    std::size_t pooled_bytes = getByteSize(target);
+    for (const TextureTarget* pooled_target : d_pooledTargets)
+        pooled_bytes += getByteSize(*pooled_target);
+
+    if (pooled_bytes > d_maxPooledBytes)
+        return false;
+
+    d_usedTargets.erase(i);
+    d_pooledTargets.push_back(&target);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+Sizef TextureTargetPool::getSizeClass(const Sizef& size) const
+{
+    if (d_sizeGranularity <= 1.0f)
+        return Sizef(std::ceil(size.d_width), std::ceil(size.d_height));
+
+    return Sizef(std::ceil(size.d_width / d_sizeGranularity) * d_sizeGranularity,
+                 std::ceil(size.d_height / d_sizeGranularity) * d_sizeGranularity);
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::setSizeGranularity(float granularity)
+{
+    d_sizeGranularity = granularity;
+}
+
+//----------------------------------------------------------------------------//
+float TextureTargetPool::getSizeGranularity() const
+{
+    return d_sizeGranularity;
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::setMaxPooledBytes(std::size_t bytes)
+{
+    d_maxPooledBytes = bytes;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t TextureTargetPool::getMaxPooledBytes() const
+{
+    return d_maxPooledBytes;
+}
+
+//----------------------------------------------------------------------------//
+TextureTargetPool::Statistics TextureTargetPool::getStatistics() const
+{
+    Statistics stats;
+    stats.d_targetCount = d_usedTargets.size() + d_pooledTargets.size();
+    stats.d_pooledTargetCount = d_pooledTargets.size();
+    stats.d_pooledBytes = 0;
+    stats.d_bytesRequested = 0;
+    stats.d_reuseCount = d_reuseCount;
+
+    for (const TextureTarget* target : d_pooledTargets)
+        stats.d_pooledBytes += getByteSize(*target);
+
+    stats.d_bytesHeld = stats.d_pooledBytes;
+    for (const TextureTarget* target : d_usedTargets)
+    {
+        stats.d_bytesHeld += getByteSize(*target);
+        stats.d_bytesRequested += CEGUI::getByteSize(target->getArea().getSize(),
+                                                     target->getUsesStencil());
+    }
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t TextureTargetPool::getByteSize(const TextureTarget& target)
+{
+    return CEGUI::getByteSize(target.getTexture().getSize(), target.getUsesStencil());
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
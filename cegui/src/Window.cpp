@@ -46,6 +46,7 @@
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/GlobalEventSet.h"
 #include "CEGUI/SharedStringStream.h"
+#include "CEGUI/Profiler.h"
 #if defined (CEGUI_USE_FRIBIDI)
 #include "CEGUI/FribidiVisualMapping.h"
 #elif defined (CEGUI_USE_MINIBIDI)
@@ -159,6 +160,20 @@ const String Window::TooltipNameSuffix("__auto_tooltip__");
 BasicRenderedStringParser Window::d_basicStringParser;
 DefaultRenderedStringParser Window::d_defaultStringParser;
 
+//----------------------------------------------------------------------------//
+// Whether the thread builds window geometry in parallel with others, and
+// whether the geometry it is building was deferred to the main thread.
+namespace
+{
+struct GeometryBuildState
+{
+    bool d_worker;
+    bool d_deferred;
+};
+
+thread_local GeometryBuildState s_geometryBuildState = { false, false };
+}
+
 //----------------------------------------------------------------------------//
 Window::WindowRendererProperty Window::d_windowRendererProperty;
 Window::LookNFeelProperty Window::d_lookNFeelProperty;
@@ -227,6 +242,7 @@ Window::Window(const String& type, const String& name):
     d_windowRenderer(nullptr),
     d_surface(nullptr),
     d_needsRedraw(true),
+    d_needsOverlayRedraw(false),
     d_autoRenderingWindow(false),
     d_autoRenderingSurfaceStencilEnabled(false),
     d_cursor(nullptr),
@@ -1086,6 +1102,14 @@ void Window::invalidate(const bool recursive)
     getGUIContext().markAsDirty();
 }
 
+//----------------------------------------------------------------------------//
+void Window::invalidateOverlay()
+{
+    d_needsOverlayRedraw = true;
+    invalidateRenderingSurface();
+    getGUIContext().markAsDirty();
+}
+
 //----------------------------------------------------------------------------//
 void Window::invalidate_impl(const bool recursive)
 {
@@ -1125,10 +1149,7 @@ void Window::draw()
         drawSelf(ctx);
 
         // render any child windows
-        for (ChildDrawList::iterator it = d_drawList.begin(); it != d_drawList.end(); ++it)
-        {
-            (*it)->draw();
-        }
+        drawChildren();
     }
 
     // do final rendering for surface if it's ours
@@ -1136,6 +1157,15 @@ void Window::draw()
         ctx.surface->draw();
 }
 
+//----------------------------------------------------------------------------//
+void Window::drawChildren()
+{
+    for (ChildDrawList::iterator it = d_drawList.begin(); it != d_drawList.end(); ++it)
+    {
+        (*it)->draw();
+    }
+}
+
 //----------------------------------------------------------------------------//
 void Window::drawSelf(const RenderingContext& ctx)
 {
@@ -1146,35 +1176,118 @@ void Window::drawSelf(const RenderingContext& ctx)
 //----------------------------------------------------------------------------//
 void Window::bufferGeometry(const RenderingContext&)
 {
+    // if only the overlay changed, try to recreate just that.
+    if (!d_needsRedraw && d_needsOverlayRedraw && !bufferOverlayGeometry())
+        d_needsRedraw = true;
+
     if (d_needsRedraw)
     {
-        // dispose of already cached geometry.
-        destroyGeometryBuffers();
+        CEGUI_PROFILE_WINDOW_ZONE("Window::bufferGeometry", *this);
 
-        // signal rendering started
-        WindowEventArgs args(this);
-        onRenderingStarted(args);
+        beginGeometryBuild();
+        populateGeometry();
+        endGeometryBuild();
+    }
+}
 
-        // HACK: ensure our rendered string content is up to date
-        getRenderedString();
+//----------------------------------------------------------------------------//
+void Window::beginGeometryBuild()
+{
+    // dispose of already cached geometry.
+    destroyGeometryBuffers();
 
-        // get derived class or WindowRenderer to re-populate geometry buffer.
-        if (d_windowRenderer)
-            d_windowRenderer->createRenderGeometry();
-        else
-            populateGeometryBuffer();
+    // signal rendering started
+    WindowEventArgs args(this);
+    onRenderingStarted(args);
+
+    // HACK: ensure our rendered string content is up to date
+    getRenderedString();
+}
+
+//----------------------------------------------------------------------------//
+void Window::populateGeometry()
+{
+    // get derived class or WindowRenderer to re-populate geometry buffer.
+    if (d_windowRenderer)
+        d_windowRenderer->createRenderGeometry();
+    else
+        populateGeometryBuffer();
+
+    bufferOverlayGeometry();
+}
+
+//----------------------------------------------------------------------------//
+void Window::endGeometryBuild()
+{
+    updateGeometryBuffersTranslationAndClipping();
+
+    updateGeometryBuffersAlpha();
 
-        updateGeometryBuffersTranslationAndClipping();
+    // signal rendering ended
+    WindowEventArgs args(this);
+    onRenderingEnded(args);
 
-        updateGeometryBuffersAlpha();
+    // mark ourselves as no longer needed a redraw.
+    d_needsRedraw = false;
+}
 
-        // signal rendering ended
-        args.handled = 0;
-        onRenderingEnded(args);
+//----------------------------------------------------------------------------//
+bool Window::isGeometryBuildWorker()
+{
+    return s_geometryBuildState.d_worker;
+}
 
-        // mark ourselves as no longer needed a redraw.
-        d_needsRedraw = false;
+//----------------------------------------------------------------------------//
+void Window::deferGeometryBuildToMainThread()
+{
+    s_geometryBuildState.d_deferred = true;
+}
+
+//----------------------------------------------------------------------------//
+bool Window::isGeometryBuildDeferred()
+{
+    return s_geometryBuildState.d_deferred;
+}
+
+//----------------------------------------------------------------------------//
+void Window::setGeometryBuildWorker(bool worker)
+{
+    s_geometryBuildState.d_worker = worker;
+    s_geometryBuildState.d_deferred = false;
+}
+
+//----------------------------------------------------------------------------//
+bool Window::bufferOverlayGeometry()
+{
+    destroyOverlayGeometryBuffers();
+    d_needsOverlayRedraw = false;
+
+    if (!d_windowRenderer)
+        return false;
+
+    // imagery is always appended to the main list, so move whatever the
+    // WindowRenderer adds over to the overlay list.
+    const size_t overlay_start = d_geometryBuffers.size();
+    const bool created = d_windowRenderer->createOverlayRenderGeometry();
+    d_overlayGeometryBuffers.assign(d_geometryBuffers.begin() + overlay_start,
+                                    d_geometryBuffers.end());
+    d_geometryBuffers.resize(overlay_start);
+
+    if (!created)
+    {
+        destroyOverlayGeometryBuffers();
+        return false;
+    }
+
+    const float final_alpha = getEffectiveAlpha();
+    for (GeometryBuffer* buffer : d_overlayGeometryBuffers)
+    {
+        buffer->setTranslation(d_translation);
+        buffer->setClippingRegion(d_clippingRegion);
+        buffer->setAlpha(final_alpha);
     }
+
+    return true;
 }
 
 //----------------------------------------------------------------------------//
@@ -1182,6 +1295,7 @@ void Window::queueGeometry(const RenderingContext& ctx)
 {
     // add geometry so that it gets drawn to the target surface.
     ctx.surface->addGeometryBuffers(ctx.queue, d_geometryBuffers);
+    ctx.surface->addGeometryBuffers(ctx.queue, d_overlayGeometryBuffers);
 }
 
 //----------------------------------------------------------------------------//
@@ -1797,6 +1911,7 @@ void Window::destroy(void)
     // free any assigned WindowRenderer
     if (d_windowRenderer != nullptr)
     {
+        d_windowRenderer->clearStateGeometryCache();
         d_windowRenderer->onDetach();
         WindowRendererManager::getSingleton().
             destroyWindowRenderer(d_windowRenderer);
@@ -1953,6 +2068,7 @@ void Window::setLookNFeel(const String& look)
     WidgetLookManager& wlMgr = WidgetLookManager::getSingleton();
     if (!d_lookName.empty())
     {
+        d_windowRenderer->clearStateGeometryCache();
         d_windowRenderer->onLookNFeelUnassigned();
         const WidgetLookFeel& wlf = wlMgr.getWidgetLook(d_lookName);
         wlf.cleanUpWidget(*this);
@@ -1997,6 +2113,8 @@ void Window::setModalState(bool state)
 void Window::performChildWindowLayout(const bool nonclient_sized_hint,
                                       const bool client_sized_hint)
 {
+    CEGUI_PROFILE_WINDOW_ZONE("Window::performChildWindowLayout", *this);
+
     const Sizef old_size(d_pixelSize);
     d_pixelSize = calculatePixelSize();
 
@@ -2813,6 +2931,7 @@ void Window::onWindowRendererAttached(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onWindowRendererDetached(WindowEventArgs& e)
 {
+    d_windowRenderer->clearStateGeometryCache();
     d_windowRenderer->onDetach();
     d_windowRenderer->d_window = nullptr;
     fireEvent(EventWindowRendererDetached, e, EventNamespace);
@@ -3285,7 +3404,8 @@ void Window::allocateRenderingWindow(bool addStencilBuffer)
         d_autoRenderingWindow = true;
 
         TextureTarget* const t =
-            System::getSingleton().getRenderer()->createTextureTarget(addStencilBuffer);
+            System::getSingleton().getRenderer()->createTextureTarget(
+                addStencilBuffer, getPixelSize());
 
         // TextureTargets may not be available, so check that first.
         if (!t)
@@ -3908,6 +4028,16 @@ void Window::adjustSizeToContent()
     Element::adjustSizeToContent();
 }
 
+//----------------------------------------------------------------------------//
+USize Window::getSizeAdjustedToContent() const
+{
+    if (!isSizeAdjustedToContent())
+        return getSize();
+    if (getWindowRenderer())
+        return getWindowRenderer()->getSizeAdjustedToContent();
+    return Element::getSizeAdjustedToContent();
+}
+
 //----------------------------------------------------------------------------//
 bool Window::contentFitsForSpecifiedElementSize(const Sizef& element_size) const
 {
@@ -4007,9 +4137,28 @@ void Window::destroyGeometryBuffers()
 {
     const size_t geom_buffer_count = d_geometryBuffers.size();
     for (size_t i = 0; i < geom_buffer_count; ++i)
-        System::getSingleton().getRenderer()->destroyGeometryBuffer(*d_geometryBuffers.at(i));
+    {
+        // geometry cached by the WindowRenderer is still owned by it.
+        if (d_windowRenderer &&
+            d_windowRenderer->isStateGeometryCacheBuffer(*d_geometryBuffers[i]))
+            continue;
+
+        System::getSingleton().getRenderer()->destroyGeometryBuffer(*d_geometryBuffers[i]);
+    }
 
     d_geometryBuffers.clear();
+
+    destroyOverlayGeometryBuffers();
+}
+
+//----------------------------------------------------------------------------//
+void Window::destroyOverlayGeometryBuffers()
+{
+    const size_t geom_buffer_count = d_overlayGeometryBuffers.size();
+    for (size_t i = 0; i < geom_buffer_count; ++i)
+        System::getSingleton().getRenderer()->destroyGeometryBuffer(*d_overlayGeometryBuffers[i]);
+
+    d_overlayGeometryBuffers.clear();
 }
 
 //----------------------------------------------------------------------------//
@@ -4022,6 +4171,12 @@ void Window::updateGeometryBuffersTranslationAndClipping()
         currentBuffer->setTranslation(d_translation);
         currentBuffer->setClippingRegion(d_clippingRegion);
     }
+
+    for (GeometryBuffer* buffer : d_overlayGeometryBuffers)
+    {
+        buffer->setTranslation(d_translation);
+        buffer->setClippingRegion(d_clippingRegion);
+    }
 }
 
 void Window::updateGeometryBuffersAlpha()
@@ -4034,6 +4189,9 @@ void Window::updateGeometryBuffersAlpha()
         CEGUI::GeometryBuffer*& currentBuffer = d_geometryBuffers[i];
         currentBuffer->setAlpha(final_alpha);
     }
+
+    for (GeometryBuffer* buffer : d_overlayGeometryBuffers)
+        buffer->setAlpha(final_alpha);
 }
 
 //----------------------------------------------------------------------------//
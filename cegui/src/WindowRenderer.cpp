@@ -28,6 +28,12 @@
  ***************************************************************************/
 #include "CEGUI/WindowRenderer.h"
 #include "CEGUI/falagard/WidgetLookManager.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include <algorithm>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -39,7 +45,12 @@ namespace CEGUI
 WindowRenderer::WindowRenderer(const String& name, const String& class_name) :
     d_window(nullptr),
     d_name(name),
-    d_class(class_name)
+    d_class(class_name),
+    d_stateGeometryCacheEnabled(false),
+    d_stateGeometryCacheVertexLimit(4096),
+    d_stateGeometryCacheVertexCount(0),
+    d_stateGeometryCacheHits(0),
+    d_stateGeometryCacheMisses(0)
 {
 }
 
@@ -48,6 +59,7 @@ WindowRenderer::WindowRenderer(const String& name, const String& class_name) :
 *************************************************************************/
 WindowRenderer::~WindowRenderer()
 {
+    releaseStateGeometryCache();
 }
 
 /************************************************************************
@@ -131,7 +143,12 @@ void WindowRenderer::getRenderingContext(RenderingContext& ctx) const
 bool WindowRenderer::handleFontRenderSizeChange(const Font* const font)
 {
     const WidgetLookFeel& lf(getLookNFeel());
-    return lf.handleFontRenderSizeChange(*d_window, font);
+    const bool handled = lf.handleFontRenderSizeChange(*d_window, font);
+
+    if (handled || d_window->getFont() == font)
+        clearStateGeometryCache();
+
+    return handled;
 }
 
 //----------------------------------------------------------------------------//
@@ -164,6 +181,12 @@ void WindowRenderer::adjustSizeToContent()
     getWindow()->adjustSizeToContent_direct();
 }
 
+//----------------------------------------------------------------------------//
+USize WindowRenderer::getSizeAdjustedToContent() const
+{
+    return getWindow()->getSizeAdjustedToContent_direct();
+}
+
 //----------------------------------------------------------------------------//
 bool WindowRenderer::contentFitsForSpecifiedWindowSize(const Sizef& /*window_size*/) const
 {
@@ -176,6 +199,206 @@ bool WindowRenderer::contentFits() const
     throw InvalidRequestException("This function isn't implemented for this type of window renderer.");
 }
 
+//----------------------------------------------------------------------------//
+void WindowRenderer::setStateGeometryCacheEnabled(bool setting)
+{
+    if (d_stateGeometryCacheEnabled == setting)
+        return;
+
+    d_stateGeometryCacheEnabled = setting;
+
+    if (!setting)
+        clearStateGeometryCache();
+}
+
+//----------------------------------------------------------------------------//
+void WindowRenderer::setStateGeometryCacheVertexLimit(std::size_t limit)
+{
+    d_stateGeometryCacheVertexLimit = limit;
+
+    if (d_stateGeometryCacheVertexCount > limit)
+        clearStateGeometryCache();
+}
+
+//----------------------------------------------------------------------------//
+void WindowRenderer::clearStateGeometryCache()
+{
+    if (d_stateGeometryCache.empty())
+        return;
+
+    releaseStateGeometryCache();
+
+    if (d_window)
+        d_window->invalidate();
+}
+
+//----------------------------------------------------------------------------//
+void WindowRenderer::resetStateGeometryCacheStatistics()
+{
+    d_stateGeometryCacheHits = 0;
+    d_stateGeometryCacheMisses = 0;
+}
+
+//----------------------------------------------------------------------------//
+bool WindowRenderer::isStateGeometryCacheBuffer(const GeometryBuffer& buffer) const
+{
+    for (const StateGeometry& entry : d_stateGeometryCache)
+    {
+        if (std::find(entry.d_buffers.begin(), entry.d_buffers.end(), &buffer) !=
+                entry.d_buffers.end())
+            return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+void WindowRenderer::renderStateImagery(const StateImagery& imagery)
+{
+    if (!d_stateGeometryCacheEnabled)
+    {
+        imagery.render(*d_window);
+        return;
+    }
+
+    const Sizef& window_size = d_window->getPixelSize();
+    const Sizef& display_size =
+        System::getSingleton().getRenderer()->getDisplaySize();
+    const String& text = d_window->getText();
+    const Font* const font = d_window->getFont();
+    // the parser changes with text parsing and custom parser settings.
+    const RenderedStringParser* const string_parser =
+        &d_window->getRenderedStringParser();
+    const unsigned int image_generation = ImageManager::getImageGeneration();
+    const unsigned int glyph_generation = Font::getGlyphGeometryGeneration();
+
+    for (StateGeometryList::iterator i = d_stateGeometryCache.begin();
+         i != d_stateGeometryCache.end(); ++i)
+    {
+        if (i->d_imageryName == imagery.getName() &&
+            i->d_windowSize == window_size &&
+            i->d_displaySize == display_size &&
+            i->d_font == font &&
+            i->d_stringParser == string_parser &&
+            i->d_imageGeneration == image_generation &&
+            i->d_glyphGeometryGeneration == glyph_generation &&
+            i->d_text == text)
+        {
+            // reuse the geometry and mark it as the most recently used.
+            d_stateGeometryCache.splice(d_stateGeometryCache.begin(),
+                                        d_stateGeometryCache, i);
+            d_window->appendGeometryBuffers(d_stateGeometryCache.front().d_buffers);
+            ++d_stateGeometryCacheHits;
+            return;
+        }
+    }
+
+    ++d_stateGeometryCacheMisses;
+
+    std::vector<GeometryBuffer*>& window_buffers = d_window->getGeometryBuffers();
+    const std::size_t first_buffer = window_buffers.size();
+    imagery.render(*d_window);
+
+    // geometry built before the build was deferred may be incomplete.
+    if (Window::isGeometryBuildDeferred())
+        return;
+
+    StateGeometry entry;
+    entry.d_buffers.assign(window_buffers.begin() + first_buffer,
+                           window_buffers.end());
+    entry.d_vertexCount = 0;
+    for (const GeometryBuffer* buffer : entry.d_buffers)
+        entry.d_vertexCount += buffer->getVertexCount();
+
+    // geometry that does not fit stays owned by the window as usual.
+    if (!makeRoomInStateGeometryCache(entry.d_vertexCount))
+        return;
+
+    entry.d_imageryName = imagery.getName();
+    entry.d_windowSize = window_size;
+    entry.d_displaySize = display_size;
+    entry.d_text = text;
+    entry.d_font = font;
+    entry.d_stringParser = string_parser;
+    entry.d_imageGeneration = image_generation;
+    entry.d_glyphGeometryGeneration = Font::getGlyphGeometryGeneration();
+
+    d_stateGeometryCacheVertexCount += entry.d_vertexCount;
+    d_stateGeometryCache.push_front(entry);
+}
+
+//----------------------------------------------------------------------------//
+bool WindowRenderer::makeRoomInStateGeometryCache(std::size_t vertex_count)
+{
+    if (vertex_count > d_stateGeometryCacheVertexLimit)
+        return false;
+
+    StateGeometryList::iterator i = d_stateGeometryCache.end();
+    while (d_stateGeometryCacheVertexCount + vertex_count >
+                d_stateGeometryCacheVertexLimit &&
+           i != d_stateGeometryCache.begin())
+    {
+        --i;
+
+        // never discard geometry the window is about to draw.
+        if (isStateGeometryInUse(*i))
+            continue;
+
+        Renderer* const renderer = System::getSingleton().getRenderer();
+        for (GeometryBuffer* buffer : i->d_buffers)
+            renderer->destroyGeometryBuffer(*buffer);
+
+        d_stateGeometryCacheVertexCount -= i->d_vertexCount;
+        i = d_stateGeometryCache.erase(i);
+    }
+
+    return d_stateGeometryCacheVertexCount + vertex_count <=
+        d_stateGeometryCacheVertexLimit;
+}
+
+//----------------------------------------------------------------------------//
+bool WindowRenderer::isStateGeometryInUse(const StateGeometry& entry) const
+{
+    if (!d_window || entry.d_buffers.empty())
+        return false;
+
+    const std::vector<GeometryBuffer*>& window_buffers =
+        d_window->getGeometryBuffers();
+
+    return std::find(window_buffers.begin(), window_buffers.end(),
+                     entry.d_buffers.front()) != window_buffers.end();
+}
+
+//----------------------------------------------------------------------------//
+void WindowRenderer::releaseStateGeometryCache()
+{
+    if (d_stateGeometryCache.empty())
+        return;
+
+    Renderer* const renderer = System::getSingleton().getRenderer();
+
+    for (const StateGeometry& entry : d_stateGeometryCache)
+    {
+        // make sure the window does not keep using the geometry.
+        if (d_window)
+        {
+            std::vector<GeometryBuffer*>& window_buffers =
+                d_window->getGeometryBuffers();
+
+            for (GeometryBuffer* buffer : entry.d_buffers)
+                window_buffers.erase(std::remove(window_buffers.begin(),
+                                                 window_buffers.end(), buffer),
+                                     window_buffers.end());
+        }
+
+        for (GeometryBuffer* buffer : entry.d_buffers)
+            renderer->destroyGeometryBuffer(*buffer);
+    }
+
+    d_stateGeometryCache.clear();
+    d_stateGeometryCacheVertexCount = 0;
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of CEGUI namespace
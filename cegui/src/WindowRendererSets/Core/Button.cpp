@@ -27,6 +27,7 @@
 #include "CEGUI/WindowRendererSets/Core/Button.h"
 #include "CEGUI/falagard/WidgetLookManager.h"
 #include "CEGUI/falagard/WidgetLookFeel.h"
+#include "CEGUI/TplWindowRendererProperty.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -36,6 +37,10 @@ namespace CEGUI
     FalagardButton::FalagardButton(const String& type) :
         WindowRenderer(type)
     {
+        CEGUI_DEFINE_WINDOW_RENDERER_PROPERTY(FalagardButton, bool,
+            "StateGeometryCacheEnabled", "Property to get/set whether the geometry of each state is kept and reused when the button returns to that state. Value is either \"true\" or \"false\".",
+            &FalagardButton::setStateGeometryCacheEnabled, &FalagardButton::isStateGeometryCacheEnabled,
+            false);
     }
 
     void FalagardButton::createRenderGeometry()
@@ -73,7 +78,7 @@ namespace CEGUI
             state = "Normal";
         }
 
-        wlf.getStateImagery(actualStateName(state)).render(*w);
+        renderStateImagery(wlf.getStateImagery(actualStateName(state)));
     }
 
 } // End of  CEGUI namespace section
@@ -53,6 +53,7 @@ const float FalagardEditbox::DefaultCaretBlinkTimeout(0.66f);
 FalagardEditbox::FalagardEditbox(const String& type) :
     EditboxWindowRenderer(type),
     d_lastTextOffset(0),
+    d_textInOverlay(false),
     d_blinkCaret(false),
     d_caretBlinkTimeout(DefaultCaretBlinkTimeout),
     d_caretBlinkElapsed(0.0f),
@@ -83,6 +84,10 @@ void FalagardEditbox::createRenderGeometry()
 
     renderBaseImagery(wlf);
 
+    // the text is coloured by the selection, so while there is one the text
+    // is part of the overlay; see createOverlayRenderGeometry.
+    d_textInOverlay = static_cast<Editbox*>(d_window)->getSelectionLength() != 0;
+
     // no font == no more rendering
     const Font* font = d_window->getFont();
     if (!font)
@@ -94,22 +99,89 @@ void FalagardEditbox::createRenderGeometry()
     const ImagerySection& caret_imagery = wlf.getImagerySection("Caret");
 
     const Rectf text_area(wlf.getNamedArea("TextArea").getArea().getPixelRect(*d_window));
-    const size_t caret_index = getCaretIndex(visual_text);
-    const float caret_width = caret_imagery.getBoundingRect(*d_window, text_area).getWidth();
-    const float text_extent = font->getTextExtent(visual_text);
-    const float extent_to_caret_visual = font->getTextAdvance(visual_text.substr(0, caret_index));
-    const float extent_to_caret_logical = extentToCarretLogical(extent_to_caret_visual, text_extent, caret_width);
-    const float text_offset_logical = calculateTextOffset(text_area, text_extent, caret_width, extent_to_caret_logical);
-    d_lastTextOffset = text_offset_logical;
+    const float text_extent = font->getTextExtent(visual_text, d_window->getDefaultParagraphDirection());
+    float extent_to_caret_visual;
+    d_lastTextOffset = calculateCaretTextOffset(caret_imagery, visual_text, text_area,
+                                                text_extent, extent_to_caret_visual);
+
+    if (!d_textInOverlay)
+        renderText(wlf, visual_text, text_area, textOffsetVisual(text_area, text_extent));
+}
+
+//----------------------------------------------------------------------------//
+bool FalagardEditbox::createOverlayRenderGeometry()
+{
+    Editbox* const w = static_cast<Editbox*>(d_window);
+
+    // the text moves between the overlay and the cached geometry when the
+    // selection starts or ends.
+    if ((w->getSelectionLength() != 0) != d_textInOverlay)
+        return false;
+
+    const Font* font = w->getFont();
+    if (!font)
+        return true;
+
+    const WidgetLookFeel& wlf = getLookNFeel();
+
+    String visual_text;
+    setupVisualString(visual_text);
+
+    const ImagerySection& caret_imagery = wlf.getImagerySection("Caret");
+
+    const Rectf text_area(wlf.getNamedArea("TextArea").getArea().getPixelRect(*d_window));
+    const float text_extent = font->getTextExtent(visual_text, d_window->getDefaultParagraphDirection());
+    float extent_to_caret_visual;
+    const float text_offset = calculateCaretTextOffset(caret_imagery, visual_text,
+        text_area, text_extent, extent_to_caret_visual);
+
+    // if the caret moved out of view the text has to scroll, which needs the
+    // text geometry to be recreated as well.
+    if (text_offset != d_lastTextOffset)
+    {
+        if (!d_textInOverlay)
+            return false;
+
+        d_lastTextOffset = text_offset;
+    }
+
     const float text_offset_visual = textOffsetVisual(text_area, text_extent);
 
+    if (d_textInOverlay)
+        renderText(wlf, visual_text, text_area, text_offset_visual);
+
+    renderCaret(caret_imagery, text_area, text_offset_visual, extent_to_caret_visual);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void FalagardEditbox::renderText(const WidgetLookFeel& wlf,
+                                 const String& text,
+                                 const Rectf& text_area,
+                                 float text_offset)
+{
 #ifdef CEGUI_BIDI_SUPPORT
-    renderTextBidi(wlf, visual_text, text_area, text_offset_visual);
+    renderTextBidi(wlf, text, text_area, text_offset);
 #else
-    createRenderGeometryForTextWithoutBidi(wlf, visual_text, text_area, text_offset_visual);
+    createRenderGeometryForTextWithoutBidi(wlf, text, text_area, text_offset);
 #endif
+}
 
-    renderCaret(caret_imagery, text_area, text_offset_visual, extent_to_caret_visual);
+//----------------------------------------------------------------------------//
+float FalagardEditbox::calculateCaretTextOffset(const ImagerySection& caret_imagery,
+                                                const String& visual_text,
+                                                const Rectf& text_area,
+                                                const float text_extent,
+                                                float& extent_to_caret_visual)
+{
+    const size_t caret_index = getCaretIndex(visual_text);
+    const float caret_width = caret_imagery.getBoundingRect(*d_window, text_area).getWidth();
+    extent_to_caret_visual = d_window->getFont()->getTextAdvance(
+        visual_text.substr(0, caret_index), d_window->getDefaultParagraphDirection());
+    const float extent_to_caret_logical = extentToCarretLogical(extent_to_caret_visual, text_extent, caret_width);
+
+    return calculateTextOffset(text_area, text_extent, caret_width, extent_to_caret_logical);
 }
 
 //----------------------------------------------------------------------------//
@@ -292,9 +364,9 @@ void FalagardEditbox::createRenderGeometryForTextWithoutBidi(
     {
         // calculate required start and end offsets of selection imagery.
         float selStartOffset =
-            font->getTextAdvance(text.substr(0, w->getSelectionStart()));
+            font->getTextAdvance(text.substr(0, w->getSelectionStart()), defaultParagraphDir);
         float selEndOffset =
-            font->getTextAdvance(text.substr(0, w->getSelectionEnd()));
+            font->getTextAdvance(text.substr(0, w->getSelectionEnd()), defaultParagraphDir);
 
         // calculate area for selection imagery.
         Rectf hlarea(text_area);
@@ -471,7 +543,7 @@ size_t FalagardEditbox::getTextIndexFromPosition(const glm::vec2& pt) const
     String visual_text;
     setupVisualString(visual_text);
     const Rectf text_area(getLookNFeel().getNamedArea("TextArea").getArea().getPixelRect(*d_window));
-    const float text_extent = font->getTextExtent(visual_text);
+    const float text_extent = font->getTextExtent(visual_text, d_window->getDefaultParagraphDirection());
     wndx -= textOffsetVisual(text_area, text_extent);
     return w->getFont()->getCharAtPixel(visual_text, wndx);
 }
@@ -517,8 +589,8 @@ void FalagardEditbox::update(float elapsed)
         {
             d_caretBlinkElapsed = 0.0f;
             d_showCaret ^= true;
-            // state changed, so need a redraw
-            d_window->invalidate();
+            // state changed, so need to redraw the caret
+            d_window->invalidateOverlay();
         }
     }
 }
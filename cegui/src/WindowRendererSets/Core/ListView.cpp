@@ -86,7 +86,7 @@ void FalagardListView::createRenderGeometry(ListView* list_view)
 
         if (!item->d_icon.empty())
         {
-            Image& img = ImageManager::getSingleton().get(item->d_icon);
+            Image& img = item->d_icon.get();
 
             Rectf icon_rect(item_rect);
             icon_rect.setWidth(size.d_height);
@@ -97,14 +97,20 @@ namespace CEGUI
         // calculate position of area we have to render into
         Rectf itemsArea(getListRenderArea());
 
+        // skip the rows scrolled out above the items area
+        const float vertScrollPos = vertScrollbar->getScrollPosition();
+        const unsigned int firstRow = w->getRowAtOffset(vertScrollPos);
+
         // set up initial positional details for items
-        itemPos.y = itemsArea.top() - vertScrollbar->getScrollPosition();
+        itemPos.y = itemsArea.top() - vertScrollPos +
+            (firstRow < w->getRowCount() ? w->getRowOffset(firstRow) : 0.0f);
         itemPos.z = 0.0f;
 
         const float alpha = w->getEffectiveAlpha();
 
-        // loop through the items
-        for (unsigned int i = 0; i < w->getRowCount(); ++i)
+        // loop through the visible items
+        for (unsigned int i = firstRow;
+             i < w->getRowCount() && itemPos.y < itemsArea.bottom(); ++i)
         {
             // set initial x position for this row.
             itemPos.x = itemsArea.left() - horzScrollbar->getScrollPosition();
@@ -50,7 +50,8 @@ FalagardMultiLineEditbox::FalagardMultiLineEditbox(const String& type) :
     d_blinkCaret(false),
     d_caretBlinkTimeout(DefaultCaretBlinkTimeout),
     d_caretBlinkElapsed(0.0f),
-    d_showCaret(true)
+    d_showCaret(true),
+    d_textInOverlay(false)
 {
 
     CEGUI_DEFINE_WINDOW_RENDERER_PROPERTY(FalagardMultiLineEditbox,bool,
@@ -145,7 +146,8 @@ void FalagardMultiLineEditbox::cacheCaretImagery(const Rectf& textArea)
             // calculate pixel offsets to where caret should be drawn
             size_t caretLineIdx = w->getCaretIndex() - d_lines[caretLine].d_startIdx;
             float ypos = caretLine * fnt->getLineSpacing();
-            float xpos = fnt->getTextAdvance(w->getText().substr(d_lines[caretLine].d_startIdx, caretLineIdx));
+            float xpos = fnt->getTextAdvance(w->getText().substr(d_lines[caretLine].d_startIdx, caretLineIdx),
+                                             w->getDefaultParagraphDirection());
 
             // get WidgetLookFeel for the assigned look.
             const WidgetLookFeel& wlf = getLookNFeel();
@@ -168,18 +170,45 @@ void FalagardMultiLineEditbox::cacheCaretImagery(const Rectf& textArea)
 
 void FalagardMultiLineEditbox::createRenderGeometry()
 {
-    MultiLineEditbox* w = static_cast<MultiLineEditbox*>(d_window);
     // Create the render geometry for the general frame and stuff before we handle the text itself
     cacheEditboxBaseImagery();
 
+    // The text is coloured by the selection, so while there is one the text
+    // is part of the overlay; see createOverlayRenderGeometry.
+    d_textInOverlay = isTextSelectionRendered();
+
     // Create the render geometry for the edit box text
+    if (!d_textInOverlay)
+        cacheTextLines(getTextRenderArea());
+}
+
+bool FalagardMultiLineEditbox::createOverlayRenderGeometry()
+{
+    MultiLineEditbox* w = static_cast<MultiLineEditbox*>(d_window);
+
+    // the text moves between the overlay and the cached geometry when the
+    // selection starts or ends.
+    if (isTextSelectionRendered() != d_textInOverlay)
+        return false;
+
     Rectf textarea(getTextRenderArea());
-    cacheTextLines(textarea);
+
+    // Create the render geometry for the selected text
+    if (d_textInOverlay)
+        cacheTextLines(textarea);
 
     // Create the render geometry for the caret
     if ((w->hasInputFocus() && !w->isReadOnly()) &&
         (!d_blinkCaret || d_showCaret))
             cacheCaretImagery(textarea);
+
+    return true;
+}
+
+bool FalagardMultiLineEditbox::isTextSelectionRendered() const
+{
+    MultiLineEditbox* w = static_cast<MultiLineEditbox*>(d_window);
+    return w->getSelectionLength() != 0 && w->getSelectionBrushImage() != nullptr;
 }
 
 void FalagardMultiLineEditbox::cacheTextLines(const Rectf& dest_area)
@@ -273,18 +302,18 @@ void FalagardMultiLineEditbox::cacheTextLines(const Rectf& dest_area)
 
 #if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
                 // get the pixel offset to the beginning of the selection area highlight.
-                selStartOffset = fnt->getTextAdvance(sect);
+                selStartOffset = fnt->getTextAdvance(sect, defaultParagraphDir);
 #else
                 if (sect.isUtf8StringValid())
                 {
-                    selStartOffset = fnt->getTextAdvance(sect);
+                    selStartOffset = fnt->getTextAdvance(sect, defaultParagraphDir);
                 }
                 else
                 {
                     // The section string is invalid, use the entire line instead
                     sect = lineText;
                     sectIdx = lineText.size();
-                    selStartOffset = fnt->getTextAdvance(sect);
+                    selStartOffset = fnt->getTextAdvance(sect, defaultParagraphDir);
                     w->setCaretIndex(0);
                     w->setSelectionLength(0);
                 }
@@ -308,7 +337,7 @@ void FalagardMultiLineEditbox::cacheTextLines(const Rectf& dest_area)
             sectIdx += sectLen;
 
             // get the extent to use as the width of the selection area highlight
-            selAreaWidth = fnt->getTextAdvance(sect);
+            selAreaWidth = fnt->getTextAdvance(sect, defaultParagraphDir);
 
             const float text_top = lineRect.top();
             lineRect.top(old_top);
@@ -422,8 +451,8 @@ void FalagardMultiLineEditbox::update(float elapsed)
         {
             d_caretBlinkElapsed = 0.0f;
             d_showCaret ^= true;
-            // state changed, so need a redraw
-            d_window->invalidate();
+            // state changed, so need to redraw the caret
+            d_window->invalidateOverlay();
         }
     }
 }
@@ -40,6 +40,9 @@
 #include "CEGUI/TplWindowRendererProperty.h"
 #include "CEGUI/CoordConverter.h"
 
+#include <cmath>
+#include <limits>
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
@@ -64,7 +67,8 @@ namespace CEGUI
         d_enableVertScrollbar(false),
         d_enableHorzScrollbar(false),
         d_formattedRenderedString(nullptr),
-        d_formatValid(false)
+        d_formatValid(false),
+        d_measuredRenderedString(nullptr)
     {
         CEGUI_DEFINE_WINDOW_RENDERER_PROPERTY(FalagardStaticText, ColourRect,
             "TextColours", "Property to get/set the text colours for the FalagardStaticText widget."
@@ -120,6 +124,8 @@ namespace CEGUI
     {
         if (d_formattedRenderedString)
             delete d_formattedRenderedString;
+
+        delete d_measuredRenderedString;
     }
 
 //----------------------------------------------------------------------------//
@@ -269,30 +275,39 @@ UDim FalagardStaticText::getHeightOfAreaReservedForContentLowerBoundAsFuncOfWind
 //----------------------------------------------------------------------------//
 void FalagardStaticText::adjustSizeToContent()
 {
-    const float epsilon = getWindow()->adjustSizeToContent_getEpsilon();
     getHorzScrollbarWithoutUpdate()->hide();
     getVertScrollbarWithoutUpdate()->hide();
+    if (isSizeAdjustedToContentKeepingAspectRatio() ||
+        (isWordWrapOn() && getWindow()->isWidthAdjustedToContent()))
+    {
+        getWindow()->setSize(getSizeAdjustedToContent(), false);
+        return;
+    }
+    adjustSizeToContent_direct();
+}
+
+//----------------------------------------------------------------------------//
+USize FalagardStaticText::getSizeAdjustedToContent() const
+{
     if (isWordWrapOn())
     {
-        LeftAlignedRenderedString orig_str(d_formattedRenderedString->getRenderedString());
-        USize size_func(UDim(-1.f, -1.f), UDim(-1.f, -1.f));
-        size_func.d_width = getWindow()->getElementWidthLowerBoundAsFuncOfWidthOfAreaReservedForContent();
-        size_func.d_height = getWindow()->getElementHeightLowerBoundAsFuncOfHeightOfAreaReservedForContent();
-        float content_max_width(orig_str.getHorizontalExtent(getWindow()));
-        float window_max_width((content_max_width+epsilon)*size_func.d_width.d_scale + size_func.d_width.d_offset);
+        const float epsilon = getWindow()->adjustSizeToContent_getEpsilon();
+        const LeftAlignedRenderedString orig_str(getWindow()->getRenderedString());
+        const USize size_func(
+          getWindow()->getElementWidthLowerBoundAsFuncOfWidthOfAreaReservedForContent(),
+          getWindow()->getElementHeightLowerBoundAsFuncOfHeightOfAreaReservedForContent());
+        const Sizef content_max_size(orig_str.getHorizontalExtent(getWindow()),
+                                     orig_str.getVerticalExtent(getWindow()));
+        const float window_max_width((content_max_size.d_width+epsilon)*size_func.d_width.d_scale +
+                                     size_func.d_width.d_offset);
         if (isSizeAdjustedToContentKeepingAspectRatio())
-        {
-            adjustSizeToContent_wordWrap_keepingAspectRatio(
-              orig_str, size_func, content_max_width, window_max_width, epsilon);
-            return;
-        }
+            return getSizeAdjustedToContent_wordWrap_keepingAspectRatio(
+              size_func, content_max_size, window_max_width, epsilon);
         if (getWindow()->isWidthAdjustedToContent())
-        {
-            adjustSizeToContent_wordWrap_notKeepingAspectRatio(size_func, content_max_width, window_max_width, epsilon);
-            return;
-        }
+            return getSizeAdjustedToContent_wordWrap_notKeepingAspectRatio(
+              size_func, content_max_size.d_width, window_max_width, epsilon);
     }
-    adjustSizeToContent_direct();
+    return getWindow()->getSizeAdjustedToContent_direct();
 }
 
 //----------------------------------------------------------------------------//
@@ -312,7 +327,50 @@ bool FalagardStaticText::isSizeAdjustedToContentKeepingAspectRatio() const
 //----------------------------------------------------------------------------//
 bool FalagardStaticText::contentFitsForSpecifiedWindowSize(const Sizef& window_size) const
 {
-    return getWindow()->contentFitsForSpecifiedElementSize_tryByResizing(window_size);
+    /* The content only fits if no scrollbar is needed, so it's enough to
+       check the text area the window would have without scrollbars. */
+    const Rectf area(getTextComponentArea(false, false).getPixelRect(
+      *getWindow(), Rectf(glm::vec2(0.f, 0.f), window_size)));
+    const TextMeasurement& measurement(measureText(area.getWidth()));
+    return
+      !measurement.d_wordSplit  &&
+      measurement.d_extent.d_width <= area.getWidth()  &&
+      measurement.d_extent.d_height <= area.getHeight();
+}
+
+//----------------------------------------------------------------------------//
+const FalagardStaticText::TextMeasurement& FalagardStaticText::measureText(float area_width) const
+{
+    std::unordered_map<float, TextMeasurement>::const_iterator i =
+        d_textMeasurements.find(area_width);
+    if (i != d_textMeasurements.end())
+        return i->second;
+
+    if (!d_measuredRenderedString)
+        d_measuredRenderedString = createFormattedRenderedString(getHorizontalFormatting());
+
+    // only the width matters for the formatting, the height is not limited
+    d_measuredRenderedString->format(
+      getWindow(), Sizef(area_width, std::numeric_limits<float>::max()));
+
+    TextMeasurement measurement;
+    measurement.d_extent = Sizef(d_measuredRenderedString->getHorizontalExtent(getWindow()),
+                                 d_measuredRenderedString->getVerticalExtent(getWindow()));
+    measurement.d_wordSplit = d_measuredRenderedString->wasWordSplit();
+
+    // widths tried by past layouts are rarely useful again once this many piled up
+    if (d_textMeasurements.size() >= 256)
+        d_textMeasurements.clear();
+
+    return d_textMeasurements[area_width] = measurement;
+}
+
+//----------------------------------------------------------------------------//
+void FalagardStaticText::invalidateTextMeasurements() const
+{
+    d_textMeasurements.clear();
+    delete d_measuredRenderedString;
+    d_measuredRenderedString = nullptr;
 }
 
 //----------------------------------------------------------------------------//
@@ -499,6 +557,7 @@ void FalagardStaticText::setNumOfTextLinesToShow(NumOfTextLinesToShow newValue)
         if (h_fmt == d_horzFormatting)
             return;
         d_horzFormatting = h_fmt;
+        invalidateTextMeasurements();
         invalidateFormatting();
         getWindow()->adjustSizeToContent();
     }
@@ -592,6 +651,7 @@ void FalagardStaticText::setNumOfTextLinesToShow(NumOfTextLinesToShow newValue)
     *************************************************************************/
     bool FalagardStaticText::onTextChanged(const EventArgs&)
     {
+        invalidateTextMeasurements();
         invalidateFormatting();
         getWindow()->adjustSizeToContent();
         return true;
@@ -613,6 +673,7 @@ void FalagardStaticText::setNumOfTextLinesToShow(NumOfTextLinesToShow newValue)
     *************************************************************************/
     bool FalagardStaticText::onFontChanged(const EventArgs&)
     {
+        invalidateTextMeasurements();
         invalidateFormatting();
         getWindow()->adjustSizeToContent();
         return true;
@@ -701,6 +762,7 @@ bool FalagardStaticText::onIsSizeAdjustedToContentChanged(const EventArgs&)
             d_window->subscribeEvent(Window::EventIsSizeAdjustedToContentChanged,
                 Event::Subscriber(&FalagardStaticText::onIsSizeAdjustedToContentChanged, this)));
 
+        invalidateTextMeasurements();
         invalidateFormatting();
         getWindow()->adjustSizeToContent();
     }
@@ -724,54 +786,48 @@ bool FalagardStaticText::onIsSizeAdjustedToContentChanged(const EventArgs&)
         delete d_formattedRenderedString;
         d_formattedRenderedString = nullptr;
 
-        // create new formatter of whichever type...
-        switch(getActualHorizontalFormatting())
-        {
-        case HorizontalTextFormatting::LeftAligned:
-            d_formattedRenderedString =
-                new LeftAlignedRenderedString(d_window->getRenderedString());
-            break;
+        d_formattedRenderedString =
+            createFormattedRenderedString(getActualHorizontalFormatting());
+    }
 
-        case HorizontalTextFormatting::RightAligned:
-            d_formattedRenderedString =
-                new RightAlignedRenderedString(d_window->getRenderedString());
-            break;
+//----------------------------------------------------------------------------//
+FormattedRenderedString* FalagardStaticText::createFormattedRenderedString(
+    HorizontalTextFormatting formatting) const
+{
+    switch(formatting)
+    {
+    case HorizontalTextFormatting::LeftAligned:
+        return new LeftAlignedRenderedString(d_window->getRenderedString());
 
-        case HorizontalTextFormatting::CentreAligned:
-            d_formattedRenderedString =
-                new CentredRenderedString(d_window->getRenderedString());
-            break;
+    case HorizontalTextFormatting::RightAligned:
+        return new RightAlignedRenderedString(d_window->getRenderedString());
 
-        case HorizontalTextFormatting::Justified:
-            d_formattedRenderedString =
-                new JustifiedRenderedString(d_window->getRenderedString());
-            break;
+    case HorizontalTextFormatting::CentreAligned:
+        return new CentredRenderedString(d_window->getRenderedString());
 
-        case HorizontalTextFormatting::WordWrapLeftAligned:
-            d_formattedRenderedString =
-                new RenderedStringWordWrapper
-                    <LeftAlignedRenderedString>(d_window->getRenderedString());
-            break;
+    case HorizontalTextFormatting::Justified:
+        return new JustifiedRenderedString(d_window->getRenderedString());
 
-        case HorizontalTextFormatting::WordWrapRightAligned:
-            d_formattedRenderedString =
-                new RenderedStringWordWrapper
-                    <RightAlignedRenderedString>(d_window->getRenderedString());
-            break;
+    case HorizontalTextFormatting::WordWrapLeftAligned:
+        return new RenderedStringWordWrapper
+            <LeftAlignedRenderedString>(d_window->getRenderedString());
 
-        case HorizontalTextFormatting::WordWrapCentreAligned:
-            d_formattedRenderedString =
-                new RenderedStringWordWrapper
-                    <CentredRenderedString>(d_window->getRenderedString());
-            break;
+    case HorizontalTextFormatting::WordWrapRightAligned:
+        return new RenderedStringWordWrapper
+            <RightAlignedRenderedString>(d_window->getRenderedString());
 
-        case HorizontalTextFormatting::WordWraperJustified:
-            d_formattedRenderedString =
-                new RenderedStringWordWrapper
-                    <JustifiedRenderedString>(d_window->getRenderedString());
-            break;
-        }
+    case HorizontalTextFormatting::WordWrapCentreAligned:
+        return new RenderedStringWordWrapper
+            <CentredRenderedString>(d_window->getRenderedString());
+
+    case HorizontalTextFormatting::WordWraperJustified:
+        return new RenderedStringWordWrapper
+            <JustifiedRenderedString>(d_window->getRenderedString());
+
+    default:
+        throw InvalidRequestException("Invalid horizontal formatting.");
     }
+}
 
 //----------------------------------------------------------------------------//
 float FalagardStaticText::getHorizontalTextExtent() const
@@ -869,7 +925,7 @@ void FalagardStaticText::updateFormatting() const
         {
             d_actualHorzFormatting = isWordWrapOn() ? HorizontalTextFormatting::WordWrapCentreAligned : HorizontalTextFormatting::CentreAligned;
             setupStringFormatter();
-            d_formattedRenderedString->format(getWindow(), getTextRenderArea().getSize());
+            d_formattedRenderedString->format(getWindow(), getTextRenderAreaWithoutUpdate().getSize());
         }
         if (getWindow()->isHeightAdjustedToContent()    &&
             (getNumOfTextLinesToShow().isAuto()  ||
@@ -892,6 +948,7 @@ bool FalagardStaticText::handleFontRenderSizeChange(const Font* const font)
 
     if (d_window->getFont() == font)
     {
+        invalidateTextMeasurements();
         invalidateFormatting();
         getWindow()->adjustSizeToContent();
         return true;
@@ -931,11 +988,14 @@ bool FalagardStaticText::handleFontRenderSizeChange(const Font* const font)
 //----------------------------------------------------------------------------//
 const ComponentArea& FalagardStaticText::getTextComponentAreaWithoutUpdate() const
 {
-    Scrollbar* vertScrollbar = getVertScrollbarWithoutUpdate();
-    Scrollbar* horzScrollbar = getHorzScrollbarWithoutUpdate();
-    bool v_visible = vertScrollbar->isVisible();
-    bool h_visible = horzScrollbar->isVisible();
+    return getTextComponentArea(getHorzScrollbarWithoutUpdate()->isVisible(),
+                                getVertScrollbarWithoutUpdate()->isVisible());
+}
 
+//----------------------------------------------------------------------------//
+const ComponentArea& FalagardStaticText::getTextComponentArea(
+    bool h_visible, bool v_visible) const
+{
     // get WidgetLookFeel for the assigned look.
     const WidgetLookFeel& wlf = getLookNFeel();
 
@@ -974,14 +1034,33 @@ const ComponentArea& FalagardStaticText::getTextComponentAreaWithoutUpdate() con
     }
 
 /*----------------------------------------------------------------------------//
-    An implementation of "adjustSizeToContent" where we adjust both the window
-    width and the window height simultaneously, keeping the window's aspect
-    ratio according to "getWindow()->getAspectRatio()".
+    Return lower bounds for the window width and height as affine functions of
+    the width and height of the text area the window has with the given
+    scrollbars visible. See
+    "Element::getElementWidthLowerBoundAsFuncOfWidthOfAreaReservedForContent".
+------------------------------------------------------------------------------*/
+USize FalagardStaticText::getElementSizeLowerBoundAsFuncOfTextAreaSize(
+  bool h_visible, bool v_visible) const
+{
+    const ComponentArea& area(getTextComponentArea(h_visible, v_visible));
+    const UDim width_inverse(area.getWidthLowerBoundAsFuncOfWindowWidth(*getWindow()));
+    const UDim height_inverse(area.getHeightLowerBoundAsFuncOfWindowHeight(*getWindow()));
+    if (width_inverse.d_scale == 0.f || height_inverse.d_scale == 0.f)
+        throw InvalidRequestException("Text area size doesn't depend on the window size.");
+    return USize(UDim(1.f /width_inverse.d_scale, -width_inverse.d_offset /width_inverse.d_scale),
+                 UDim(1.f /height_inverse.d_scale, -height_inverse.d_offset /height_inverse.d_scale));
+}
+
+/*----------------------------------------------------------------------------//
+    Measure for "adjustSizeToContent" where we adjust both the window width and
+    the window height simultaneously, keeping the window's aspect ratio
+    according to "getWindow()->getAspectRatio()".
 
     We do that by try-and-error, using bisection.
 ------------------------------------------------------------------------------*/
-void FalagardStaticText::adjustSizeToContent_wordWrap_keepingAspectRatio(const LeftAlignedRenderedString& orig_str,
-  USize& size_func, float content_max_width, float window_max_width, float epsilon)
+USize FalagardStaticText::getSizeAdjustedToContent_wordWrap_keepingAspectRatio(
+  const USize& size_func, const Sizef& content_max_size, float window_max_width,
+  float epsilon) const
 {
     // Start by trying height that can fit 0 text lines.
     Sizef window_size(0.f, size_func.d_height.d_scale*epsilon + size_func.d_height.d_offset);
@@ -989,8 +1068,7 @@ void FalagardStaticText::adjustSizeToContent_wordWrap_keepingAspectRatio(const L
     if (getWindow()->contentFitsForSpecifiedElementSize(window_size))
     {
         // It fits - so we go for that size.
-        getWindow()->setSize(USize(UDim(0.f, window_size.d_width), UDim(0.f, window_size.d_height)));
-        return;
+        return USize(UDim(0.f, window_size.d_width), UDim(0.f, window_size.d_height));
     }
 
     /* It doesn't fit - so we try a positive integer number of text lines. Here
@@ -1002,34 +1080,33 @@ void FalagardStaticText::adjustSizeToContent_wordWrap_keepingAspectRatio(const L
     UDim height_sequence(size_func.d_height.d_scale*getVerticalAdvance() + size_func.d_height.d_offset,
                          size_func.d_height.d_scale*(getLineHeight()+epsilon) + size_func.d_height.d_offset);
     float max_num_of_lines(std::max(
-      static_cast<float>(d_formattedRenderedString->getNumOfOriginalTextLines() -1),
+      static_cast<float>(getWindow()->getRenderedString().getLineCount()) - 1.f,
       (window_max_width / getWindow()->getAspectRatio() - height_sequence_precise.d_offset)
         / height_sequence_precise.d_scale));
     window_size = getWindow()->getSizeAdjustedToContent_bisection(
       USize(height_sequence *getWindow()->getAspectRatio(), height_sequence), -1.f, max_num_of_lines);
-    getWindow()->setSize(USize(UDim(0.f, window_size.d_width), UDim(0.f, window_size.d_height)), false);
 
     /* It's possible that due to a too low "getWindow()->getMaxSize().d_height",
        we're unable to make the whole text fit without the need for a vertical
-       scrollbar. In that case, we need to redo the computations, with the
-       vertical scrollbar visible. We go for the maximal size that makes sense,
-       which is the size of "orig_str", expanded to keep the aspect ratio
-       "getWindow()->getAspectRatio()". */
-    updateFormatting();
-    if (getVertScrollbar()->isVisible())
+       scrollbar. In that case, we go for the maximal size that makes sense,
+       which is the size of the unwrapped text, expanded to keep the aspect
+       ratio "getWindow()->getAspectRatio()". */
+    if (!getWindow()->contentFitsForSpecifiedElementSize(
+          getWindow()->constrainPixelSize(window_size)))
     {
-        size_func.d_width = getWindow()->getElementWidthLowerBoundAsFuncOfWidthOfAreaReservedForContent();
-        size_func.d_height = getWindow()->getElementHeightLowerBoundAsFuncOfHeightOfAreaReservedForContent();
-        window_size.d_width = (content_max_width+epsilon)*size_func.d_width.d_scale + size_func.d_width.d_offset;
-        window_size.d_height = (orig_str.getVerticalExtent(getWindow())+epsilon)*size_func.d_height.d_scale +
-                                size_func.d_height.d_offset;
+        const USize scroll_size_func(getElementSizeLowerBoundAsFuncOfTextAreaSize(false, true));
+        window_size.d_width = (content_max_size.d_width+epsilon)*scroll_size_func.d_width.d_scale +
+                               scroll_size_func.d_width.d_offset;
+        window_size.d_height = (content_max_size.d_height+epsilon)*scroll_size_func.d_height.d_scale +
+                                scroll_size_func.d_height.d_offset;
         window_size.scaleToAspect(AspectMode::Expand, getWindow()->getAspectRatio());
-        getWindow()->setSize(USize(UDim(0.f, window_size.d_width), UDim(0.f, window_size.d_height)), false);
     }
+
+    return USize(UDim(0.f, window_size.d_width), UDim(0.f, window_size.d_height));
 }
 
 /*----------------------------------------------------------------------------//
-    An implementation of "adjustSizeToContent" where we do the following:
+    Measure for "adjustSizeToContent" where we do the following:
 
     1) If "getWindow()->isHeightAdjustedToContent()" is true, adjust the height
        of the window so that the text fits in without the need for a vertical
@@ -1039,8 +1116,8 @@ void FalagardStaticText::adjustSizeToContent_wordWrap_keepingAspectRatio(const L
        word-wrapping.
     2) Adjust the window width by try-and-error, using bisection.
 ------------------------------------------------------------------------------*/
-void FalagardStaticText::adjustSizeToContent_wordWrap_notKeepingAspectRatio(
-  USize& size_func, float content_max_width, float window_max_width, float epsilon)
+USize FalagardStaticText::getSizeAdjustedToContent_wordWrap_notKeepingAspectRatio(
+  const USize& size_func, float content_max_width, float window_max_width, float epsilon) const
 {
     float height(getWindow()->isHeightAdjustedToContent()  ?
       size_func.d_height.d_scale*(getContentHeight()+epsilon) + size_func.d_height.d_offset  :
@@ -1049,20 +1126,21 @@ void FalagardStaticText::adjustSizeToContent_wordWrap_notKeepingAspectRatio(
     float window_width(getWindow()->getSizeAdjustedToContent_bisection(
                          USize(UDim(1.f, 0.f), UDim(0.f, height)), -1.f, window_max_width)
                        .d_width);
-    getWindow()->setSize(USize(UDim(0.f, window_width), height_as_u_dim), false);
 
      /* It's possible that due to a too low height we're unable to make the
         whole text fit without the need for a vertical scrollbar. In that case,
-        we need to redo the computations, with the vertical scrollbar visible.
-        We go for the maximal width that makes sense, which is the width of the
+        we go for the maximal width that makes sense, which is the width of the
         original string (i.e. not divided to lines by word-wrapping). */
-    updateFormatting();
-    if (getVertScrollbar()->isVisible())
+    if (!getWindow()->contentFitsForSpecifiedElementSize(
+          getWindow()->constrainPixelSize(Sizef(window_width, height))))
     {
-        size_func.d_width = getWindow()->getElementWidthLowerBoundAsFuncOfWidthOfAreaReservedForContent();
-        window_max_width = (content_max_width+epsilon)*size_func.d_width.d_scale + size_func.d_width.d_offset;
-        getWindow()->setSize(USize(UDim(0.f, std::ceil(window_max_width)), height_as_u_dim));
+        const UDim scroll_width_func(
+          getElementSizeLowerBoundAsFuncOfTextAreaSize(false, true).d_width);
+        window_width = std::ceil((content_max_width+epsilon)*scroll_width_func.d_scale +
+                                 scroll_width_func.d_offset);
     }
+
+    return USize(UDim(0.f, window_width), height_as_u_dim);
 }
 
 /*----------------------------------------------------------------------------//
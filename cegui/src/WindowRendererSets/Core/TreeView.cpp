@@ -107,7 +107,7 @@ void FalagardTreeView::renderTreeItem(TreeView* tree_view, const Rectf& items_ar
 
         if (!item->d_icon.empty())
         {
-            Image& img = ImageManager::getSingleton().get(item->d_icon);
+            Image& img = item->d_icon.get();
 
             Rectf icon_rect(item_rect);
             icon_rect.setWidth(size.d_height);
@@ -434,19 +434,19 @@ ImageDim::ImageDim(const String& image_name, DimensionType dim) :
 //----------------------------------------------------------------------------//
 const String& ImageDim::getSourceImage() const
 {
-    return d_imageName;
+    return d_imageName.getName();
 }
 
 //----------------------------------------------------------------------------//
 void ImageDim::setSourceImage(const String& image_name)
 {
-    d_imageName = image_name;
+    d_imageName.setName(image_name);
 }
 
 //----------------------------------------------------------------------------//
 const Image* ImageDim::getSourceImage(const Window& /*wnd*/) const
 {
-    return &ImageManager::getSingleton().get(d_imageName);
+    return &d_imageName.get();
 }
 
 //----------------------------------------------------------------------------//
@@ -465,7 +465,7 @@ void ImageDim::writeXMLElementName_impl(XMLSerializer& xml_stream) const
 void ImageDim::writeXMLElementAttributes_impl(XMLSerializer& xml_stream) const
 {
     ImageDimBase::writeXMLElementAttributes_impl(xml_stream);
-    xml_stream.attribute(Falagard_xmlHandler::NameAttribute, d_imageName);
+    xml_stream.attribute(Falagard_xmlHandler::NameAttribute, d_imageName.getName());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -493,8 +493,8 @@ void ImagePropertyDim::setSourceProperty(const String& property_name)
 //----------------------------------------------------------------------------//
 const Image* ImagePropertyDim::getSourceImage(const Window& wnd) const
 {
-    const String& image_name(wnd.getProperty(d_propertyName));
-    return image_name.empty() ? 0 : &ImageManager::getSingleton().get(image_name);
+    // natively typed image properties are read without a by-name lookup.
+    return wnd.getProperty<Image*>(d_propertyName);
 }
 
 //----------------------------------------------------------------------------//
@@ -736,7 +736,8 @@ float FontDim::getValue(const Window& wnd) const
                 return fontObj->getBaseline() + d_padding;
                 break;
             case FontMetricType::HorzExtent:
-                return fontObj->getTextExtent(d_text.empty() ? sourceWindow.getText() : d_text) + d_padding;
+                return fontObj->getTextExtent(d_text.empty() ? sourceWindow.getText() : d_text,
+                                              sourceWindow.getDefaultParagraphDirection()) + d_padding;
                 break;
             default:
                 throw InvalidRequestException(
@@ -47,6 +47,12 @@
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+    namespace
+    {
+        //! serialises use of the string parsers, which are shared between windows.
+        std::mutex s_parserMutex;
+    }
+
     TextComponent::TextComponent() :
 #if defined (CEGUI_USE_FRIBIDI)
         d_bidiVisualMapping(new FribidiVisualMapping),
@@ -269,6 +275,8 @@ namespace CEGUI
       const ColourRect* modColours, const Rectf* clipper,
       bool /*clipToDisplay*/) const
     {
+        std::lock_guard<std::mutex> lock(d_formattingMutex);
+
         updateFormatting(srcWindow, destRect.getSize());
 
         // Get total formatted height.
@@ -415,12 +423,16 @@ namespace CEGUI
 
     float TextComponent::getHorizontalTextExtent(const Window& window) const
     {
+        std::lock_guard<std::mutex> lock(d_formattingMutex);
+
         updateFormatting(window);
         return d_formattedRenderedString->getHorizontalExtent(&window);
     }
 
     float TextComponent::getVerticalTextExtent(const Window& window) const
     {
+        std::lock_guard<std::mutex> lock(d_formattingMutex);
+
         updateFormatting(window);
         return d_formattedRenderedString->getVerticalExtent(&window);
     }
@@ -458,6 +470,7 @@ namespace CEGUI
             throw InvalidRequestException("Window doesn't have a font.");
 
         const RenderedString* rs = &d_renderedString;
+        std::unique_lock<std::mutex> parserLock(s_parserMutex);
         // do we fetch text from a property
         if (!d_textPropertyName.empty())
         {
@@ -486,6 +499,7 @@ namespace CEGUI
         // use ready-made RenderedString from the Window itself
         else
             rs = &srcWindow.getRenderedString();
+        parserLock.unlock();
 
         setupStringFormatter(srcWindow, *rs);
         d_formattedRenderedString->format(&srcWindow, size);
@@ -34,6 +34,9 @@
 // for the XML parsing part.
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/XMLAttributes.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/PropertyHelper.h"
 
 namespace CEGUI
 {
@@ -94,9 +97,21 @@ const String SVGLineAttributeY1( "y1" );
 const String SVGLineAttributeX2( "x2" );
 const String SVGLineAttributeY2( "y2" );
 
+// Maximum number of distinct tesselation settings kept in the cache
+static const std::size_t MaxCachedTesselations = 16;
+// Used to give every rasterisation texture a unique name
+static std::uint32_t RasterisationCounter = 0;
+
+std::list<SVGData::Rasterisation*> SVGData::d_rasterisationUsage;
+std::size_t SVGData::d_rasterisationBudget = 32 * 1024 * 1024;
+std::size_t SVGData::d_rasterisationMemoryUsage = 0;
+std::vector<SVGData::Rasterisation*> SVGData::d_retiredRasterisations;
+
 //----------------------------------------------------------------------------//
 SVGData::SVGData(const String& name) :
-    d_name(name)
+    d_name(name),
+    d_tesselationCacheHits(0),
+    d_tesselationCacheMisses(0)
 {
 }
 
@@ -104,7 +119,9 @@ SVGData::SVGData(const String& name) :
 SVGData::SVGData(const String& name,
                  const String& filename,
                  const String& resourceGroup) :
-    d_name(name)
+    d_name(name),
+    d_tesselationCacheHits(0),
+    d_tesselationCacheMisses(0)
 {
     loadFromFile(filename, resourceGroup);
 }
@@ -113,6 +130,13 @@ SVGData::SVGData(const String& name,
 SVGData::~SVGData()
 {
     destroyShapes();
+
+    while (!d_rasterisations.empty())
+    {
+        Rasterisation* rasterisation = d_rasterisations.begin()->second;
+        removeRasterisation(rasterisation);
+        destroyRasterisation(rasterisation);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -134,6 +158,7 @@ void SVGData::loadFromFile(const String& file_name,
 void SVGData::addShape(SVGBasicShape* svg_shape)
 {
     d_svgBasicShapes.push_back(svg_shape);
+    invalidateTesselationCache();
 }
 
 //----------------------------------------------------------------------------//
@@ -144,6 +169,7 @@ void SVGData::destroyShapes()
         delete d_svgBasicShapes[i];
 
     d_svgBasicShapes.clear();
+    invalidateTesselationCache();
 }
 
 //----------------------------------------------------------------------------//
@@ -176,6 +202,218 @@ void SVGData::setHeight(float height)
     d_height = height;
 }
 
+//----------------------------------------------------------------------------//
+const SVGData::TesselatedGeometryList* SVGData::getCachedTesselation(
+    const glm::vec2& scale_factor,
+    bool anti_aliasing) const
+{
+    const auto iter = d_tesselationCache.find(
+        TesselationKey(scale_factor.x, scale_factor.y, anti_aliasing));
+
+    if (iter == d_tesselationCache.end())
+    {
+        ++d_tesselationCacheMisses;
+        return nullptr;
+    }
+
+    ++d_tesselationCacheHits;
+    return &iter->second;
+}
+
+//----------------------------------------------------------------------------//
+const SVGData::TesselatedGeometryList& SVGData::cacheTesselation(
+    const glm::vec2& scale_factor,
+    bool anti_aliasing,
+    TesselatedGeometryList geometry) const
+{
+    // Continuously resized images would otherwise grow the cache without bound
+    if (d_tesselationCache.size() >= MaxCachedTesselations)
+        d_tesselationCache.clear();
+
+    TesselatedGeometryList& cached_geometry =
+        d_tesselationCache[TesselationKey(scale_factor.x, scale_factor.y, anti_aliasing)];
+    cached_geometry = std::move(geometry);
+
+    return cached_geometry;
+}
+
+//----------------------------------------------------------------------------//
+void SVGData::invalidateTesselationCache()
+{
+    d_tesselationCache.clear();
+    retireRasterisations();
+}
+
+//----------------------------------------------------------------------------//
+std::size_t SVGData::getTesselationCacheHits() const
+{
+    return d_tesselationCacheHits;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t SVGData::getTesselationCacheMisses() const
+{
+    return d_tesselationCacheMisses;
+}
+
+//----------------------------------------------------------------------------//
+const BitmapImage* SVGData::getCachedRasterisation(const Rectf& image_area,
+                                                   const Sizef& pixel_size,
+                                                   bool anti_aliasing) const
+{
+    const auto iter = d_rasterisations.find(RasterisationKey(
+        image_area.d_min.x, image_area.d_min.y, image_area.d_max.x, image_area.d_max.y,
+        pixel_size.d_width, pixel_size.d_height, anti_aliasing));
+
+    if (iter == d_rasterisations.end())
+        return nullptr;
+
+    Rasterisation* rasterisation = iter->second;
+    d_rasterisationUsage.splice(d_rasterisationUsage.begin(), d_rasterisationUsage,
+                                rasterisation->d_usagePosition);
+
+    return rasterisation->d_image;
+}
+
+//----------------------------------------------------------------------------//
+const BitmapImage* SVGData::cacheRasterisation(const Rectf& image_area,
+                                               const Sizef& pixel_size,
+                                               bool anti_aliasing,
+                                               const std::vector<std::uint8_t>& rgba_pixels) const
+{
+    const std::size_t byte_size = rgba_pixels.size();
+    if (!makeRoomForRasterisation(byte_size))
+        return nullptr;
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+
+    const String name(d_name + "/Rasterisation" +
+        PropertyHelper<std::uint32_t>::toString(RasterisationCounter++));
+
+    Texture& texture = renderer.createTexture(name, pixel_size);
+    texture.loadFromMemory(rgba_pixels.data(), pixel_size, Texture::PixelFormat::Rgba);
+
+    Rasterisation* rasterisation = new Rasterisation;
+    rasterisation->d_owner = this;
+    rasterisation->d_key = RasterisationKey(
+        image_area.d_min.x, image_area.d_min.y, image_area.d_max.x, image_area.d_max.y,
+        pixel_size.d_width, pixel_size.d_height, anti_aliasing);
+    rasterisation->d_texture = &texture;
+    rasterisation->d_image = new BitmapImage(name, &texture,
+        Rectf(glm::vec2(0.0f, 0.0f), pixel_size), glm::vec2(0.0f, 0.0f),
+        AutoScaledMode::Disabled, pixel_size);
+    rasterisation->d_byteSize = byte_size;
+    rasterisation->d_usagePosition =
+        d_rasterisationUsage.insert(d_rasterisationUsage.begin(), rasterisation);
+
+    d_rasterisations[rasterisation->d_key] = rasterisation;
+    d_rasterisationMemoryUsage += byte_size;
+
+    return rasterisation->d_image;
+}
+
+//----------------------------------------------------------------------------//
+bool SVGData::makeRoomForRasterisation(std::size_t bytes)
+{
+    if (bytes > d_rasterisationBudget)
+        return false;
+
+    if (d_rasterisationMemoryUsage + bytes <= d_rasterisationBudget)
+        return true;
+
+    // Evicting rasterisations that windows still render with would force them
+    // to redraw, and visible rasterisations exceeding the budget would then
+    // evict each other every frame. Such renders fall back to geometry instead.
+    const Renderer& renderer = *System::getSingleton().getRenderer();
+
+    auto iter = d_rasterisationUsage.end();
+    while (iter != d_rasterisationUsage.begin() &&
+           d_rasterisationMemoryUsage + bytes > d_rasterisationBudget)
+    {
+        Rasterisation* rasterisation = *--iter;
+
+        if (!renderer.isTextureUsedByGeometry(rasterisation->d_texture))
+        {
+            ++iter;
+            retireRasterisation(rasterisation);
+        }
+    }
+
+    return d_rasterisationMemoryUsage + bytes <= d_rasterisationBudget;
+}
+
+//----------------------------------------------------------------------------//
+void SVGData::setRasterisationBudget(std::size_t bytes)
+{
+    d_rasterisationBudget = bytes;
+
+    if (makeRoomForRasterisation(0))
+        return;
+
+    while (!d_rasterisationUsage.empty() &&
+           d_rasterisationMemoryUsage > d_rasterisationBudget)
+        retireRasterisation(d_rasterisationUsage.back());
+
+    // Windows still holding geometry of the evicted textures must redraw
+    System::getSingleton().invalidateAllCachedRendering();
+}
+
+//----------------------------------------------------------------------------//
+std::size_t SVGData::getRasterisationBudget()
+{
+    return d_rasterisationBudget;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t SVGData::getRasterisationMemoryUsage()
+{
+    return d_rasterisationMemoryUsage;
+}
+
+//----------------------------------------------------------------------------//
+void SVGData::destroyRetiredRasterisations()
+{
+    for (Rasterisation* rasterisation : d_retiredRasterisations)
+        destroyRasterisation(rasterisation);
+
+    d_retiredRasterisations.clear();
+}
+
+//----------------------------------------------------------------------------//
+void SVGData::removeRasterisation(Rasterisation* rasterisation)
+{
+    rasterisation->d_owner->d_rasterisations.erase(rasterisation->d_key);
+    d_rasterisationUsage.erase(rasterisation->d_usagePosition);
+    d_rasterisationMemoryUsage -= rasterisation->d_byteSize;
+}
+
+//----------------------------------------------------------------------------//
+void SVGData::destroyRasterisation(Rasterisation* rasterisation)
+{
+    delete rasterisation->d_image;
+    System::getSingleton().getRenderer()->destroyTexture(*rasterisation->d_texture);
+    delete rasterisation;
+}
+
+//----------------------------------------------------------------------------//
+void SVGData::retireRasterisation(Rasterisation* rasterisation)
+{
+    removeRasterisation(rasterisation);
+    d_retiredRasterisations.push_back(rasterisation);
+}
+
+//----------------------------------------------------------------------------//
+void SVGData::retireRasterisations() const
+{
+    if (d_rasterisations.empty())
+        return;
+
+    while (!d_rasterisations.empty())
+        retireRasterisation(d_rasterisations.begin()->second);
+
+    System::getSingleton().invalidateAllCachedRendering();
+}
+
 //----------------------------------------------------------------------------//
 void SVGData::elementStartLocal(const String& element,
                                 const XMLAttributes& attributes)
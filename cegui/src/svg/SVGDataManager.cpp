@@ -48,6 +48,7 @@ SVGDataManager::SVGDataManager()
 SVGDataManager::~SVGDataManager()
 {
     destroyAll();
+    SVGData::destroyRetiredRasterisations();
 }
 
 //----------------------------------------------------------------------------//
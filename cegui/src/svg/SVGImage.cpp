@@ -31,7 +31,15 @@
 #include "CEGUI/svg/SVGData.h"
 #include "CEGUI/svg/SVGBasicShape.h"
 #include "CEGUI/svg/SVGDataManager.h"
+#include "CEGUI/svg/SVGRasteriser.h"
+#include "CEGUI/BitmapImage.h"
 #include "CEGUI/XMLAttributes.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Window.h"
+
+#include <algorithm>
+#include <cmath>
 
 
 
@@ -55,7 +63,10 @@ const String ImageNativeVertResAttribute( "nativeVertRes" );
 SVGImage::SVGImage(const String& name) :
     Image(name),
     d_svgData(nullptr),
-    d_useGeometryAntialiasing(true)
+    d_useGeometryAntialiasing(true),
+    d_useRasterisation(false),
+    d_rasterSizePolicy(RasterSizePolicy::Step),
+    d_rasterSizeStep(16)
 {
 }
 
@@ -68,7 +79,10 @@ SVGImage::SVGImage(const String& name, SVGData& svg_data) :
           AutoScaledMode::Disabled,
           Sizef(640, 480)),
     d_svgData(&svg_data),
-    d_useGeometryAntialiasing(true)
+    d_useGeometryAntialiasing(true),
+    d_useRasterisation(false),
+    d_rasterSizePolicy(RasterSizePolicy::Step),
+    d_rasterSizeStep(16)
 {
 }
 
@@ -86,7 +100,10 @@ SVGImage::SVGImage(const XMLAttributes& attributes) :
                 static_cast<float>(attributes.getValueAsInteger(ImageNativeVertResAttribute, 480)))),
     d_svgData(&SVGDataManager::getSingleton().getSVGData(
               attributes.getValueAsString(ImageSVGDataAttribute))),
-    d_useGeometryAntialiasing(true)
+    d_useGeometryAntialiasing(true),
+    d_useRasterisation(false),
+    d_rasterSizePolicy(RasterSizePolicy::Step),
+    d_rasterSizeStep(16)
 {
 }
 
@@ -106,6 +123,14 @@ SVGData* SVGImage::getSVGData()
 std::vector<GeometryBuffer*> SVGImage::createRenderGeometry(
     const ImageRenderSettings& render_settings) const
 {
+    // the tesselation and rasterisation caches of the SVGData are only
+    // maintained on the main thread
+    if (Window::isGeometryBuildWorker())
+    {
+        Window::deferGeometryBuildToMainThread();
+        return std::vector<GeometryBuffer*>();
+    }
+
     Rectf dest(render_settings.d_destArea);
     // apply rendering offset to the destination Rect
     dest.offset(d_scaledOffset);
@@ -128,25 +153,169 @@ std::vector<GeometryBuffer*> SVGImage::createRenderGeometry(
     final_rect.d_max.x = CoordConverter::alignToPixels(final_rect.d_max.x);
     final_rect.d_max.y = CoordConverter::alignToPixels(final_rect.d_max.y);
 
+    if (d_useRasterisation)
+    {
+        const BitmapImage* rasterisation = getRasterisation(dest.getSize());
+
+        if (rasterisation)
+        {
+            ImageRenderSettings raster_render_settings(render_settings);
+            raster_render_settings.d_destArea = dest;
+            return rasterisation->createRenderGeometry(raster_render_settings);
+        }
+    }
+
     SVGImageRenderSettings svg_render_settings(render_settings,
                                                scale_factor,
                                                d_useGeometryAntialiasing);
 
+    return createTesselatedRenderGeometry(getTesselation(svg_render_settings),
+                                          svg_render_settings);
+}
+
+//----------------------------------------------------------------------------//
+const SVGData::TesselatedGeometryList& SVGImage::getTesselation(
+    const SVGImageRenderSettings& render_settings) const
+{
+    // The tesselated vertices only depend on the scale and anti-aliasing, so
+    // a cached tesselation can be re-emitted with any other buffer settings
+    const SVGData::TesselatedGeometryList* cached_geometry =
+        d_svgData->getCachedTesselation(render_settings.d_scaleFactor,
+                                        render_settings.d_antiAliasing);
+
+    if (cached_geometry)
+        return *cached_geometry;
+
     std::vector<GeometryBuffer*> geometryBuffers;
     const std::vector<SVGBasicShape*>& shapes = d_svgData->getShapes();
     
     for(SVGBasicShape* currentShape : shapes)
     {
         std::vector<GeometryBuffer*> currentRenderGeometry =
-            currentShape->createRenderGeometry(svg_render_settings);
+            currentShape->createRenderGeometry(render_settings);
 
         geometryBuffers.insert(geometryBuffers.end(), currentRenderGeometry.begin(),
             currentRenderGeometry.end());
     }
 
+    SVGData::TesselatedGeometryList tesselated_geometry;
+    tesselated_geometry.reserve(geometryBuffers.size());
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+
+    for (GeometryBuffer* currentBuffer : geometryBuffers)
+    {
+        SVGData::TesselatedGeometry geometry;
+        geometry.d_vertexData = currentBuffer->getVertexData();
+        geometry.d_customTransform = currentBuffer->getCustomTransform();
+        geometry.d_fillRule = currentBuffer->getStencilFillRule();
+        geometry.d_postStencilVertexCount = currentBuffer->getStencilPostRenderingVertexCount();
+        tesselated_geometry.push_back(std::move(geometry));
+
+        renderer.destroyGeometryBuffer(*currentBuffer);
+    }
+
+    return d_svgData->cacheTesselation(render_settings.d_scaleFactor,
+                                       render_settings.d_antiAliasing,
+                                       std::move(tesselated_geometry));
+}
+
+//----------------------------------------------------------------------------//
+std::vector<GeometryBuffer*> SVGImage::createTesselatedRenderGeometry(
+    const SVGData::TesselatedGeometryList& tesselation,
+    const SVGImageRenderSettings& render_settings) const
+{
+    std::vector<GeometryBuffer*> geometryBuffers;
+    geometryBuffers.reserve(tesselation.size());
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+
+    for (const SVGData::TesselatedGeometry& geometry : tesselation)
+    {
+        GeometryBuffer& buffer = renderer.createGeometryBufferColoured();
+
+        buffer.appendGeometry(geometry.d_vertexData.data(), geometry.d_vertexData.size());
+        buffer.setStencilRenderingActive(geometry.d_fillRule);
+        buffer.setStencilPostRenderingVertexCount(geometry.d_postStencilVertexCount);
+        SVGTesselator::setupGeometryBufferSettings(&buffer, render_settings,
+                                                   geometry.d_customTransform);
+
+        geometryBuffers.push_back(&buffer);
+    }
+
     return geometryBuffers;
 }
 
+//----------------------------------------------------------------------------//
+const BitmapImage* SVGImage::getRasterisation(const Sizef& dest_size) const
+{
+    const Sizef pixel_size(getRasterSize(dest_size.d_width),
+                           getRasterSize(dest_size.d_height));
+
+    const float max_texture_size = static_cast<float>(
+        System::getSingleton().getRenderer()->getMaxTextureSize());
+
+    if (pixel_size.d_width > max_texture_size || pixel_size.d_height > max_texture_size)
+        return nullptr;
+
+    const BitmapImage* rasterisation = d_svgData->getCachedRasterisation(
+        d_imageArea, pixel_size, d_useGeometryAntialiasing);
+
+    if (rasterisation)
+        return rasterisation;
+
+    // Skip rasterising on the CPU if the result could not be cached anyway
+    const std::size_t byte_size = static_cast<std::size_t>(pixel_size.d_width) *
+        static_cast<std::size_t>(pixel_size.d_height) * 4;
+    if (!SVGData::makeRoomForRasterisation(byte_size))
+        return nullptr;
+
+    const glm::vec2 scale_factor(pixel_size.d_width / d_imageArea.getWidth(),
+                                 pixel_size.d_height / d_imageArea.getHeight());
+
+    const SVGImageRenderSettings raster_render_settings(
+        ImageRenderSettings(Rectf(glm::vec2(0.0f, 0.0f), pixel_size)),
+        scale_factor, d_useGeometryAntialiasing);
+
+    std::vector<std::uint8_t> pixels;
+    SVGRasteriser::rasterise(getTesselation(raster_render_settings), scale_factor,
+                             d_imageArea.d_min * scale_factor,
+                             static_cast<unsigned int>(pixel_size.d_width),
+                             static_cast<unsigned int>(pixel_size.d_height),
+                             pixels);
+
+    return d_svgData->cacheRasterisation(d_imageArea, pixel_size,
+                                         d_useGeometryAntialiasing, pixels);
+}
+
+//----------------------------------------------------------------------------//
+float SVGImage::getRasterSize(float dest_size) const
+{
+    const unsigned int size = std::max(1u, static_cast<unsigned int>(std::ceil(dest_size)));
+
+    switch (d_rasterSizePolicy)
+    {
+    case RasterSizePolicy::Step:
+    {
+        const unsigned int step = std::max(1u, d_rasterSizeStep);
+        return static_cast<float>((size + step - 1) / step * step);
+    }
+
+    case RasterSizePolicy::PowerOfTwo:
+    {
+        unsigned int power_of_two = 1;
+        while (power_of_two < size)
+            power_of_two <<= 1;
+        return static_cast<float>(power_of_two);
+    }
+
+    case RasterSizePolicy::Exact:
+    default:
+        return static_cast<float>(size);
+    }
+}
+
+//----------------------------------------------------------------------------//
 void SVGImage::addToRenderGeometry(
     GeometryBuffer&, const Rectf& /*renderArea*/,
     const Rectf* /*clipArea*/, const ColourRect& /*colours*/
@@ -167,6 +336,42 @@ void SVGImage::setUseGeometryAntialiasing(bool use_geometry_antialiasing)
     d_useGeometryAntialiasing = use_geometry_antialiasing;
 }
 
+//----------------------------------------------------------------------------//
+bool SVGImage::getUsesRasterisation() const
+{
+    return d_useRasterisation;
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::setUseRasterisation(bool use_rasterisation)
+{
+    d_useRasterisation = use_rasterisation;
+}
+
+//----------------------------------------------------------------------------//
+SVGImage::RasterSizePolicy SVGImage::getRasterSizePolicy() const
+{
+    return d_rasterSizePolicy;
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::setRasterSizePolicy(RasterSizePolicy policy)
+{
+    d_rasterSizePolicy = policy;
+}
+
+//----------------------------------------------------------------------------//
+unsigned int SVGImage::getRasterSizeStep() const
+{
+    return d_rasterSizeStep;
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::setRasterSizeStep(unsigned int step)
+{
+    d_rasterSizeStep = step;
+}
+
 //----------------------------------------------------------------------------//
 }
 
@@ -0,0 +1,232 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    CPU rasteriser for tesselated SVG geometry
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/svg/SVGRasteriser.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//! Number of floats per vertex in the vertex data of coloured GeometryBuffers
+static const std::size_t ColouredVertexSize = 7;
+
+//----------------------------------------------------------------------------//
+void SVGRasteriser::rasterise(const SVGData::TesselatedGeometryList& geometry,
+                              const glm::vec2& scale_factor,
+                              const glm::vec2& origin,
+                              unsigned int width,
+                              unsigned int height,
+                              std::vector<std::uint8_t>& rgba_pixels)
+{
+    RasterTarget target;
+    target.d_width = width;
+    target.d_height = height;
+    target.d_colours.assign(static_cast<std::size_t>(width) * height, glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
+    target.d_fillRule = PolygonFillRule::NoFilling;
+
+    std::vector<glm::vec2> positions;
+    std::vector<glm::vec4> colours;
+
+    for (const SVGData::TesselatedGeometry& buffer : geometry)
+    {
+        const std::size_t vertex_count = buffer.d_vertexData.size() / ColouredVertexSize;
+
+        positions.resize(vertex_count);
+        colours.resize(vertex_count);
+
+        // Apply the same transformation the Renderers would: the shape's
+        // transform followed by the image scale, then move into the buffer.
+        for (std::size_t i = 0; i < vertex_count; ++i)
+        {
+            const float* vertex = &buffer.d_vertexData[i * ColouredVertexSize];
+
+            const glm::vec4 transformed =
+                buffer.d_customTransform * glm::vec4(vertex[0], vertex[1], vertex[2], 1.0f);
+
+            positions[i] = glm::vec2(transformed.x * scale_factor.x - origin.x,
+                                     transformed.y * scale_factor.y - origin.y);
+            colours[i] = glm::vec4(vertex[3], vertex[4], vertex[5], vertex[6]);
+        }
+
+        target.d_fillRule = buffer.d_fillRule;
+
+        if (buffer.d_fillRule == PolygonFillRule::NoFilling)
+        {
+            rasteriseTriangles(target, positions, colours, 0, vertex_count,
+                               PixelOperation::Blend);
+            continue;
+        }
+
+        const std::size_t stencil_vertex_count =
+            vertex_count - std::min<std::size_t>(buffer.d_postStencilVertexCount, vertex_count);
+
+        target.d_stencil.assign(target.d_colours.size(), 0);
+
+        rasteriseTriangles(target, positions, colours, 0, stencil_vertex_count,
+                           buffer.d_fillRule == PolygonFillRule::EvenOdd ?
+                           PixelOperation::StencilInvert : PixelOperation::StencilWinding);
+
+        rasteriseTriangles(target, positions, colours, stencil_vertex_count, vertex_count,
+                           PixelOperation::BlendStencilled);
+    }
+
+    rgba_pixels.resize(target.d_colours.size() * 4);
+
+    for (std::size_t i = 0; i < target.d_colours.size(); ++i)
+    {
+        const glm::vec4& colour = target.d_colours[i];
+        rgba_pixels[i * 4 + 0] = static_cast<std::uint8_t>(std::lround(std::min(std::max(colour.x, 0.0f), 1.0f) * 255.0f));
+        rgba_pixels[i * 4 + 1] = static_cast<std::uint8_t>(std::lround(std::min(std::max(colour.y, 0.0f), 1.0f) * 255.0f));
+        rgba_pixels[i * 4 + 2] = static_cast<std::uint8_t>(std::lround(std::min(std::max(colour.z, 0.0f), 1.0f) * 255.0f));
+        rgba_pixels[i * 4 + 3] = static_cast<std::uint8_t>(std::lround(std::min(std::max(colour.w, 0.0f), 1.0f) * 255.0f));
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SVGRasteriser::rasteriseTriangles(RasterTarget& target,
+                                       const std::vector<glm::vec2>& positions,
+                                       const std::vector<glm::vec4>& colours,
+                                       std::size_t first, std::size_t last,
+                                       PixelOperation operation)
+{
+    for (std::size_t i = first; i + 3 <= last; i += 3)
+        rasteriseTriangle(target, &positions[i], &colours[i], operation);
+}
+
+//----------------------------------------------------------------------------//
+void SVGRasteriser::rasteriseTriangle(RasterTarget& target,
+                                      const glm::vec2* positions,
+                                      const glm::vec4* colours,
+                                      PixelOperation operation)
+{
+    glm::vec2 a = positions[0];
+    glm::vec2 b = positions[1];
+    glm::vec2 c = positions[2];
+    glm::vec4 colour_a = colours[0];
+    glm::vec4 colour_b = colours[1];
+    glm::vec4 colour_c = colours[2];
+
+    float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    if (area == 0.0f)
+        return;
+
+    // Bring every triangle into the same winding, but remember the original
+    // one since the non-zero fill rule counts front and back faces apart.
+    const std::uint8_t winding_step = area > 0.0f ? 1 : 0xFF;
+    if (area < 0.0f)
+    {
+        std::swap(b, c);
+        std::swap(colour_b, colour_c);
+        area = -area;
+    }
+
+    const int min_x = std::max(0, static_cast<int>(std::floor(std::min(std::min(a.x, b.x), c.x))));
+    const int min_y = std::max(0, static_cast<int>(std::floor(std::min(std::min(a.y, b.y), c.y))));
+    const int max_x = std::min(static_cast<int>(target.d_width) - 1,
+                               static_cast<int>(std::ceil(std::max(std::max(a.x, b.x), c.x))));
+    const int max_y = std::min(static_cast<int>(target.d_height) - 1,
+                               static_cast<int>(std::ceil(std::max(std::max(a.y, b.y), c.y))));
+
+    // Pixels exactly on an edge shared by two triangles must only be covered
+    // once, or the stencil operations would count them twice.
+    const glm::vec2 edges[3] = { c - b, a - c, b - a };
+    bool edge_inclusive[3];
+    for (int i = 0; i < 3; ++i)
+        edge_inclusive[i] = edges[i].y > 0.0f || (edges[i].y == 0.0f && edges[i].x < 0.0f);
+
+    for (int y = min_y; y <= max_y; ++y)
+    {
+        for (int x = min_x; x <= max_x; ++x)
+        {
+            const glm::vec2 p(x + 0.5f, y + 0.5f);
+
+            const float w0 = (c.x - b.x) * (p.y - b.y) - (c.y - b.y) * (p.x - b.x);
+            const float w1 = (a.x - c.x) * (p.y - c.y) - (a.y - c.y) * (p.x - c.x);
+            const float w2 = (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+
+            if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f ||
+                (w0 == 0.0f && !edge_inclusive[0]) ||
+                (w1 == 0.0f && !edge_inclusive[1]) ||
+                (w2 == 0.0f && !edge_inclusive[2]))
+                continue;
+
+            const std::size_t index = static_cast<std::size_t>(y) * target.d_width + x;
+
+            switch (operation)
+            {
+            case PixelOperation::StencilInvert:
+                target.d_stencil[index] = static_cast<std::uint8_t>(~target.d_stencil[index]);
+                break;
+
+            case PixelOperation::StencilWinding:
+                target.d_stencil[index] = static_cast<std::uint8_t>(target.d_stencil[index] + winding_step);
+                break;
+
+            case PixelOperation::BlendStencilled:
+                if (!isStencilTestPassing(target.d_fillRule, target.d_stencil[index]))
+                    break;
+                // fall through
+            case PixelOperation::Blend:
+                blendColour(target.d_colours[index],
+                            (colour_a * w0 + colour_b * w1 + colour_c * w2) / area);
+                break;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool SVGRasteriser::isStencilTestPassing(PolygonFillRule fill_rule, std::uint8_t stencil_value)
+{
+    if (fill_rule == PolygonFillRule::EvenOdd)
+        return stencil_value == 0xFF;
+
+    return stencil_value != 0;
+}
+
+//----------------------------------------------------------------------------//
+void SVGRasteriser::blendColour(glm::vec4& destination, const glm::vec4& source)
+{
+    const float remaining = destination.w * (1.0f - source.w);
+    const float alpha = source.w + remaining;
+
+    if (alpha <= 0.0f)
+    {
+        destination = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+        return;
+    }
+
+    destination.x = (source.x * source.w + destination.x * remaining) / alpha;
+    destination.y = (source.y * source.w + destination.y * remaining) / alpha;
+    destination.z = (source.z * source.w + destination.z * remaining) / alpha;
+    destination.w = alpha;
+}
+
+//----------------------------------------------------------------------------//
+}
@@ -529,14 +529,14 @@ void EditboxBase::onMaximumTextLengthChanged(WindowEventArgs& e)
 
 void EditboxBase::onCaretMoved(WindowEventArgs& e)
 {
-    invalidate();
+    invalidateOverlay();
     fireEvent(EventCaretMoved , e, EventNamespace);
 }
 
 
 void EditboxBase::onTextSelectionChanged(WindowEventArgs& e)
 {
-    invalidate();
+    invalidateOverlay();
     fireEvent(EventTextSelectionChanged , e, EventNamespace);
 }
 
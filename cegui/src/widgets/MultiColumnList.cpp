@@ -87,6 +87,7 @@ MultiColumnList::MultiColumnList(const String& type, const String& name) :
 	d_nominatedSelectRow(0),
 	d_lastSelected(nullptr),
     d_columnCount(0),
+    d_rowOffsetsValid(false),
     d_autoSizeColumnUsesHeader(false)
 {
 	// add properties
@@ -803,6 +804,8 @@ void MultiColumnList::removeColumn(unsigned int col_idx)
 		getListHeader()->removeColumn(col_idx);
         --d_columnCount;
 
+		invalidateRowHeights();
+
 		// signal a change to the list contents
 		WindowEventArgs args(this);
 		onListContentsChanged(args);
@@ -1022,6 +1025,7 @@ void MultiColumnList::setItem(ListboxItem* item, const MCLGridRef& position)
 		item->setOwnerWindow(this);
 
 	d_grid[position.row][position.column] = item;
+	d_grid[position.row].d_height = -1.0f;
 
 
 	// signal a change to the list contents
@@ -1322,6 +1326,7 @@ void MultiColumnList::setItemSelectState(const MCLGridRef& grid_ref, bool state)
 *************************************************************************/
 void MultiColumnList::handleUpdatedItemData(void)
 {
+    invalidateRowHeights();
     resortList();
 	configureScrollbars();
 	invalidate();
@@ -1459,14 +1464,76 @@ bool MultiColumnList::selectRange(const MCLGridRef& start, const MCLGridRef& end
 *************************************************************************/
 float MultiColumnList::getTotalRowsHeight(void) const
 {
-	float height = 0.0f;
+	return getRowOffset(getRowCount());
+}
+
+
+/*************************************************************************
+	Return the offset of the top of a row from the top of the first row
+*************************************************************************/
+float MultiColumnList::getRowOffset(unsigned int row_idx) const
+{
+	if (row_idx > getRowCount())
+	{
+		throw InvalidRequestException(
+            "specified row is out of range.");
+	}
+
+	updateRowOffsets();
+
+	return d_rowOffsets[row_idx];
+}
+
+
+/*************************************************************************
+	Return the first row ending below the given offset
+*************************************************************************/
+unsigned int MultiColumnList::getRowAtOffset(float offset) const
+{
+	updateRowOffsets();
+
+	// d_rowOffsets[i + 1] is the bottom edge of row i
+	const std::vector<float>::const_iterator first = d_rowOffsets.begin() + 1;
+	const std::vector<float>::const_iterator bottom =
+		std::upper_bound(first, d_rowOffsets.cend(), offset);
+
+	return static_cast<unsigned int>(std::distance(first, bottom));
+}
+
+
+/*************************************************************************
+	Recalculate the row offsets from the (cached) row heights
+*************************************************************************/
+void MultiColumnList::updateRowOffsets() const
+{
+	if (d_rowOffsetsValid)
+	{
+		return;
+	}
+
+	d_rowOffsets.resize(getRowCount() + 1);
+	d_rowOffsets[0] = 0.0f;
 
 	for (unsigned int i = 0; i < getRowCount(); ++i)
 	{
-		height += getHighestRowItemHeight(i);
+		d_rowOffsets[i + 1] = d_rowOffsets[i] + getHighestRowItemHeight(i);
 	}
 
-	return height;
+	d_rowOffsetsValid = true;
+}
+
+
+/*************************************************************************
+	Forget the cached heights of all rows
+*************************************************************************/
+void MultiColumnList::invalidateRowHeights()
+{
+	for (unsigned int i = 0; i < getRowCount(); ++i)
+	{
+		d_grid[i].d_height = -1.0f;
+	}
+
+	d_rowOffsetsValid = false;
 }
 
 
@@ -1522,6 +1589,10 @@ float MultiColumnList::getHighestRowItemHeight(unsigned int row_idx) const
 		throw InvalidRequestException(
             "specified row is out of range.");
 	}
+	else if (d_grid[row_idx].d_height >= 0.0f)
+	{
+		return d_grid[row_idx].d_height;
+	}
 	else
 	{
 		float height = 0.0f;
@@ -1547,7 +1618,8 @@ float MultiColumnList::getHighestRowItemHeight(unsigned int row_idx) const
 
 		}
 
-		// return the hightest item.
+		// cache and return the hightest item.
+		d_grid[row_idx].d_height = height;
 		return height;
 	}
 
@@ -1593,29 +1665,27 @@ ListboxItem* MultiColumnList::getItemAtPoint(const glm::vec2& pt) const
     const ListHeader* header = getListHeader();
     const Rectf listArea(getListRenderArea());
 
-    float y = listArea.d_min.y - getVertScrollbar()->getScrollPosition();
+    const float y = listArea.d_min.y - getVertScrollbar()->getScrollPosition();
     float x = listArea.d_min.x - getHorzScrollbar()->getScrollPosition();
 
-    for (unsigned int i = 0; i < getRowCount(); ++i)
+    // locate the row
+    const unsigned int i = getRowAtOffset(pt.y - y);
+    if (i >= getRowCount())
     {
-        y += getHighestRowItemHeight(i);
+        return nullptr;
+    }
+
+    // scan across to find column that was clicked
+    for (unsigned int j = 0; j < getColumnCount(); ++j)
+    {
+        const ListHeaderSegment& seg = header->getSegmentFromColumn(j);
+        x += CoordConverter::asAbsolute(seg.getWidth(), header->getPixelSize().d_width);
 
-        // have we located the row?
-        if (pt.y < y)
+        // was this the column?
+        if (pt.x < x)
         {
-            // scan across to find column that was clicked
-            for (unsigned int j = 0; j < getColumnCount(); ++j)
-            {
-                const ListHeaderSegment& seg = header->getSegmentFromColumn(j);
-                x += CoordConverter::asAbsolute(seg.getWidth(), header->getPixelSize().d_width);
-
-                // was this the column?
-                if (pt.x < x)
-                {
-                    // return contents of grid element that was clicked.
-                    return d_grid[i][j];
-                }
-            }
+            // return contents of grid element that was clicked.
+            return d_grid[i][j];
         }
     }
 
@@ -1834,6 +1904,8 @@ void MultiColumnList::onSelectionChanged(WindowEventArgs& e)
 *************************************************************************/
 void MultiColumnList::onListContentsChanged(WindowEventArgs& e)
 {
+	// rows may have been added, removed or changed.
+	d_rowOffsetsValid = false;
 	configureScrollbars();
 	invalidate();
 	fireEvent(EventListContentsChanged, e, EventNamespace);
@@ -1892,6 +1964,8 @@ void MultiColumnList::onFontChanged(WindowEventArgs& e)
         getHeaderSegmentForColumn(col).setFont(d_font);
     }
 
+    invalidateRowHeights();
+
     // Call base class handler
     Window::onFontChanged(e);
 }
@@ -2538,17 +2612,11 @@ void MultiColumnList::ensureRowIsVisible(unsigned int row_idx)
     }
     else
     {
-        float bottom;
-        float top = 0.0f;
         float listHeight = getListRenderArea().getHeight();
 
-        // get distance to top of item
-        unsigned int row;
-        for (row = 0; row < row_idx; ++row)
-            top += getHighestRowItemHeight(row);
-
-        // calculate distance to bottom of item
-        bottom = top + getHighestRowItemHeight(row);
+        // get distance to top and bottom of item
+        float top = getRowOffset(row_idx);
+        float bottom = getRowOffset(row_idx + 1);
 
         // account for current scrollbar value
         float currPos = vertScrollbar->getScrollPosition();
@@ -2695,6 +2763,7 @@ void MultiColumnList::resortList()
 {
     // re-sort list according to direction
     ListHeaderSegment::SortDirection dir = getSortDirection();
+    d_rowOffsetsValid = false;
 
     if (dir == ListHeaderSegment::SortDirection::Descending)
     {
@@ -162,11 +162,11 @@ void MultiLineEditbox::ensureCaretIsVisible(void)
         float xpos = 0;
         String caretLineSubstr = getText().substr(d_lines[caretLine].d_startIdx, caretLineIdx);
 #if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
-        xpos = fnt->getTextAdvance(caretLineSubstr);
+        xpos = fnt->getTextAdvance(caretLineSubstr, getDefaultParagraphDirection());
 #else
         if(caretLineSubstr.isUtf8StringValid())
         {
-            xpos = fnt->getTextAdvance(caretLineSubstr);
+            xpos = fnt->getTextAdvance(caretLineSubstr, getDefaultParagraphDirection());
         }
         else
         {
@@ -306,7 +306,7 @@ void MultiLineEditbox::formatText(const bool update_scrollbars)
 				// no word wrapping, so we are just one long line.
 				line.d_startIdx = currPos;
 				line.d_length	= paraLen;
-				line.d_extent	= fnt->getTextExtent(paraText);
+				line.d_extent	= fnt->getTextExtent(paraText, getDefaultParagraphDirection());
 				d_lines.push_back(line);
 
 				// update widest, if needed.
@@ -334,7 +334,8 @@ void MultiLineEditbox::formatText(const bool update_scrollbars)
 						size_t nextTokenSize = getNextTokenLength(paraText, lineIndex + lineLen);
 
 						// get pixel width of the token
-						float tokenExtent  = fnt->getTextExtent(paraText.substr(lineIndex + lineLen, nextTokenSize));
+						float tokenExtent  = fnt->getTextExtent(paraText.substr(lineIndex + lineLen, nextTokenSize),
+						                                        getDefaultParagraphDirection());
 
 						// would adding this token would overflow the available width
 						if ((lineExtent + tokenExtent) > areaWidth)
@@ -691,7 +692,8 @@ void MultiLineEditbox::handleLineUp(bool select)
 
 	if (caretLine > 0)
 	{
-        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx));
+        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx),
+                                                           getDefaultParagraphDirection());
 
 		--caretLine;
 
@@ -717,7 +719,8 @@ void MultiLineEditbox::handleLineDown(bool select)
 
 	if ((d_lines.size() > 1) && (caretLine < (d_lines.size() - 1)))
 	{
-        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx));
+        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx),
+                                                           getDefaultParagraphDirection());
 
 		++caretLine;
 
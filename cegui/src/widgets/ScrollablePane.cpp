@@ -135,6 +135,18 @@ void ScrollablePane::setContentPaneAutoSized(bool setting)
     getScrolledContainer()->setContentPaneAutoSized(setting);
 }
 
+//----------------------------------------------------------------------------//
+bool ScrollablePane::isContentCullingEnabled(void) const
+{
+    return getScrolledContainer()->isContentCullingEnabled();
+}
+
+//----------------------------------------------------------------------------//
+void ScrollablePane::setContentCullingEnabled(bool setting)
+{
+    getScrolledContainer()->setContentCullingEnabled(setting);
+}
+
 //----------------------------------------------------------------------------//
 const Rectf& ScrollablePane::getContentPaneArea(void) const
 {
@@ -239,6 +251,7 @@ void ScrollablePane::initialiseComponents(void)
     container->banPropertyFromXML(Window::CursorInputPropagationEnabledPropertyName);
     container->banPropertyFromXML("ContentArea");
     container->banPropertyFromXML("ContentPaneAutoSized");
+    container->banPropertyFromXML("ContentCullingEnabled");
     horzScrollbar->banPropertyFromXML(Window::AlwaysOnTopPropertyName);
     vertScrollbar->banPropertyFromXML(Window::AlwaysOnTopPropertyName);
 
@@ -433,6 +446,20 @@ bool ScrollablePane::handleAutoSizePaneChanged(const EventArgs&)
     return args.handled > 0;
 }
 
+//----------------------------------------------------------------------------//
+void ScrollablePane::beginInitialisation(void)
+{
+    Window::beginInitialisation();
+    getScrolledContainer()->beginInitialisation();
+}
+
+//----------------------------------------------------------------------------//
+void ScrollablePane::endInitialisation(void)
+{
+    Window::endInitialisation();
+    getScrolledContainer()->endInitialisation();
+}
+
 //----------------------------------------------------------------------------//
 void ScrollablePane::addChild_impl(Element* element)
 {
@@ -565,6 +592,12 @@ void ScrollablePane::addScrollablePaneProperties(void)
         &ScrollablePane::setContentPaneAutoSized, &ScrollablePane::isContentPaneAutoSized, true
     );
 
+    CEGUI_DEFINE_PROPERTY(ScrollablePane, bool,
+        "ContentCullingEnabled", "Property to get/set whether children of the content pane outside the viewable area "
+        "are neither drawn nor updated while scrolling.  Value is either \"true\" or \"false\".",
+        &ScrollablePane::setContentCullingEnabled, &ScrollablePane::isContentCullingEnabled, false
+    );
+
     CEGUI_DEFINE_PROPERTY(ScrollablePane, Rectf,
         "ContentArea", "Property to get/set the current content area rectangle of the content pane.  Value is \"l:[float] t:[float] r:[float] b:[float]\" (where l is left, t is top, r is right, and b is bottom).",
         &ScrollablePane::setContentPaneArea, &ScrollablePane::getContentPaneArea, Rectf::zero() /* TODO: Inconsistency */
@@ -28,6 +28,8 @@
 #include "CEGUI/CoordConverter.h"
 #include "CEGUI/RenderingSurface.h"
 
+#include <algorithm>
+
 #if defined(_MSC_VER)
 #   pragma warning(push)
 #   pragma warning(disable : 4355)
@@ -48,7 +50,13 @@ ScrolledContainer::ScrolledContainer(const String& type, const String& name) :
     d_contentArea(0, 0, 0, 0),
     d_autosizePane(true),
 
-    d_clientChildContentArea(this, static_cast<Element::CachedRectf::DataGenerator>(&ScrolledContainer::getClientChildContentArea_impl))
+    d_clientChildContentArea(this, static_cast<Element::CachedRectf::DataGenerator>(&ScrolledContainer::getClientChildContentArea_impl)),
+    d_childExtents(0, 0, 0, 0),
+    d_childExtentsPixelSize(0, 0),
+    d_childExtentsValid(false),
+    d_contentChangePending(false),
+    d_contentCullingEnabled(false),
+    d_movingContent(false)
 {
     addScrolledContainerProperties();
     setCursorInputPropagationEnabled(true);
@@ -94,8 +102,7 @@ void ScrolledContainer::setContentArea(const Rectf& area)
         setSize(USize(cegui_absdim(d_contentArea.getWidth()), cegui_absdim(d_contentArea.getHeight())));
 
         // Fire event
-        WindowEventArgs args(this);
-        onContentChanged(args);
+        notifyContentChanged();
    }
 
 }
@@ -112,49 +119,303 @@ const Element::CachedRectf& ScrolledContainer::getNonClientChildContentArea() co
     return d_clientChildContentArea;
 }
 
+//----------------------------------------------------------------------------//
+bool ScrolledContainer::isContentCullingEnabled(void) const
+{
+    return d_contentCullingEnabled;
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::setContentCullingEnabled(bool setting)
+{
+    if (d_contentCullingEnabled == setting)
+        return;
+
+    d_contentCullingEnabled = setting;
+
+    if (d_contentCullingEnabled)
+    {
+        updateChildrenInView(false);
+    }
+    else
+    {
+        d_childrenInView.clear();
+        // bring the children that stayed out of view up to date.
+        notifyScreenAreaChanged(true);
+    }
+
+    invalidate();
+}
+
 //----------------------------------------------------------------------------//
 void ScrolledContainer::notifyScreenAreaChanged(bool recursive)
 {
     d_clientChildContentArea.invalidateCache();
 
-    Window::notifyScreenAreaChanged(recursive);
+    if (!recursive || !d_movingContent)
+    {
+        Window::notifyScreenAreaChanged(recursive);
+
+        if (recursive && d_contentCullingEnabled)
+            updateChildrenInView(false);
+
+        return;
+    }
+
+    // we are being scrolled: only the children that were in view, or come
+    // into view, need to follow; the rest are updated when they come into view.
+    Window::notifyScreenAreaChanged(false);
+
+    for (Window* child : d_childrenInView)
+        child->notifyScreenAreaChanged();
+
+    updateChildrenInView(true);
 }
 
 //----------------------------------------------------------------------------//
 Rectf ScrolledContainer::getChildExtentsArea(void) const
 {
-    Rectf extents(0, 0, 0, 0);
+    // centred and relatively positioned children move with our size without
+    // notifying us, so their areas have to be fetched again after a resize.
+    if (d_childExtentsPixelSize != d_pixelSize)
+    {
+        for (ChildArea& childArea : d_childAreas)
+            childArea.d_area = getChildArea(*childArea.d_window);
+
+        d_childExtentsPixelSize = d_pixelSize;
+        d_childExtentsValid = false;
+    }
 
-    const size_t childCount = getChildCount();
-    if (childCount == 0)
-        return extents;
+    if (d_childExtentsValid)
+        return d_childExtents;
 
-    for (size_t i = 0; i < childCount; ++i)
+    d_childExtents = Rectf(0, 0, 0, 0);
+
+    for (const ChildArea& childArea : d_childAreas)
     {
-        const Window* const wnd = getChildAtIdx(i);
-        Rectf area(
-            CoordConverter::asAbsolute(wnd->getPosition(), d_pixelSize),
-            wnd->getPixelSize());
+        const Rectf& area = childArea.d_area;
 
-        if (wnd->getHorizontalAlignment() == HorizontalAlignment::Centre)
-            area.setPosition(area.getPosition() - glm::vec2(area.getWidth() * 0.5f - d_pixelSize.d_width * 0.5f, 0.0f));
-        if (wnd->getVerticalAlignment() == VerticalAlignment::Centre)
-            area.setPosition(area.getPosition() - glm::vec2(0.0f, area.getHeight() * 0.5f - d_pixelSize.d_height * 0.5f));
+        if (area.d_min.x < d_childExtents.d_min.x)
+            d_childExtents.d_min.x = area.d_min.x;
 
-        if (area.d_min.x < extents.d_min.x)
-            extents.d_min.x = area.d_min.x;
+        if (area.d_min.y < d_childExtents.d_min.y)
+            d_childExtents.d_min.y = area.d_min.y;
 
-        if (area.d_min.y < extents.d_min.y)
-            extents.d_min.y = area.d_min.y;
+        if (area.d_max.x > d_childExtents.d_max.x)
+            d_childExtents.d_max.x = area.d_max.x;
 
-        if (area.d_max.x > extents.d_max.x)
-            extents.d_max.x = area.d_max.x;
+        if (area.d_max.y > d_childExtents.d_max.y)
+            d_childExtents.d_max.y = area.d_max.y;
+    }
+
+    d_childExtentsValid = true;
+
+    return d_childExtents;
+}
+
+//----------------------------------------------------------------------------//
+Rectf ScrolledContainer::getChildArea(const Window& wnd) const
+{
+    Rectf area(
+        CoordConverter::asAbsolute(wnd.getPosition(), d_pixelSize),
+        wnd.getPixelSize());
+
+    if (wnd.getHorizontalAlignment() == HorizontalAlignment::Centre)
+        area.setPosition(area.getPosition() - glm::vec2(area.getWidth() * 0.5f - d_pixelSize.d_width * 0.5f, 0.0f));
+    if (wnd.getVerticalAlignment() == VerticalAlignment::Centre)
+        area.setPosition(area.getPosition() - glm::vec2(0.0f, area.getHeight() * 0.5f - d_pixelSize.d_height * 0.5f));
+
+    return area;
+}
 
-        if (area.d_max.y > extents.d_max.y)
-            extents.d_max.y = area.d_max.y;
+//----------------------------------------------------------------------------//
+Rectf ScrolledContainer::getViewArea() const
+{
+    Rectf area(getInnerRectClipper());
+    area.offset(-getUnclippedOuterRect().get().d_min);
+
+    area.d_min -= glm::vec2(1.0f, 1.0f);
+    area.d_max += glm::vec2(1.0f, 1.0f);
+
+    return area;
+}
+
+//----------------------------------------------------------------------------//
+bool ScrolledContainer::isInViewArea(const Rectf& area, const Rectf& view_area)
+{
+    return area.d_max.x > view_area.d_min.x && area.d_min.x < view_area.d_max.x &&
+           area.d_max.y > view_area.d_min.y && area.d_min.y < view_area.d_max.y;
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::updateChildrenInView(bool notify_entering)
+{
+    // fetches the child areas again if we were resized.
+    getChildExtentsArea();
+
+    const Rectf view_area(getViewArea());
+
+    ChildInViewList children_in_view;
+    for (const ChildArea& childArea : d_childAreas)
+        if (!childArea.d_window->isClippedByParent() ||
+            isInViewArea(childArea.d_area, view_area))
+            children_in_view.push_back(childArea.d_window);
+
+    std::sort(children_in_view.begin(), children_in_view.end());
+
+    if (notify_entering)
+    {
+        for (Window* child : children_in_view)
+            if (!std::binary_search(d_childrenInView.begin(), d_childrenInView.end(), child))
+                child->notifyScreenAreaChanged();
     }
 
-    return extents;
+    d_childrenInView.swap(children_in_view);
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::updateChildInView(Window& wnd)
+{
+    if (!d_contentCullingEnabled)
+        return;
+
+    if (wnd.isClippedByParent() && !isInViewArea(getChildArea(wnd), getViewArea()))
+        return;
+
+    const ChildInViewList::iterator pos = std::lower_bound(
+        d_childrenInView.begin(), d_childrenInView.end(), &wnd);
+
+    if (pos == d_childrenInView.end() || *pos != &wnd)
+        d_childrenInView.insert(pos, &wnd);
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::drawChildren()
+{
+    if (!d_contentCullingEnabled)
+    {
+        Window::drawChildren();
+        return;
+    }
+
+    const Rectf view_area(getViewArea());
+
+    for (Window* child : d_drawList)
+    {
+        if (child->isClippedByParent() && !isInViewArea(getChildArea(*child), view_area))
+            continue;
+
+        // a child can also come into view without us moving, e.g. when the
+        // visible area grows, so make sure its screen area is up to date.
+        const ChildInViewList::iterator pos = std::lower_bound(
+            d_childrenInView.begin(), d_childrenInView.end(), child);
+
+        if (pos == d_childrenInView.end() || *pos != child)
+        {
+            d_childrenInView.insert(pos, child);
+            child->notifyScreenAreaChanged();
+        }
+
+        child->draw();
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool ScrolledContainer::isOnChildExtentsEdge(const Rectf& area) const
+{
+    // the extents always contain the origin, so only edges away from it count.
+    return (d_childExtents.d_min.x < 0 && area.d_min.x <= d_childExtents.d_min.x) ||
+           (d_childExtents.d_min.y < 0 && area.d_min.y <= d_childExtents.d_min.y) ||
+           (d_childExtents.d_max.x > 0 && area.d_max.x >= d_childExtents.d_max.x) ||
+           (d_childExtents.d_max.y > 0 && area.d_max.y >= d_childExtents.d_max.y);
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::updateChildExtents(Window& wnd)
+{
+    const Rectf area(getChildArea(wnd));
+
+    const std::unordered_map<const Window*, size_t>::const_iterator index =
+        d_childAreaIndices.find(&wnd);
+
+    if (index == d_childAreaIndices.end())
+    {
+        d_childAreaIndices[&wnd] = d_childAreas.size();
+        const ChildArea childArea = { &wnd, area };
+        d_childAreas.push_back(childArea);
+    }
+    else if (d_childExtentsValid)
+    {
+        const Rectf& oldArea = d_childAreas[index->second].d_area;
+        const bool movedInwards =
+            area.d_min.x > oldArea.d_min.x || area.d_min.y > oldArea.d_min.y ||
+            area.d_max.x < oldArea.d_max.x || area.d_max.y < oldArea.d_max.y;
+
+        // the extents might shrink; recompute them when next needed.
+        if (movedInwards && isOnChildExtentsEdge(oldArea))
+            d_childExtentsValid = false;
+
+        d_childAreas[index->second].d_area = area;
+    }
+    else
+    {
+        d_childAreas[index->second].d_area = area;
+    }
+
+    if (d_childExtentsValid)
+    {
+        d_childExtents.d_min.x = std::min(d_childExtents.d_min.x, area.d_min.x);
+        d_childExtents.d_min.y = std::min(d_childExtents.d_min.y, area.d_min.y);
+        d_childExtents.d_max.x = std::max(d_childExtents.d_max.x, area.d_max.x);
+        d_childExtents.d_max.y = std::max(d_childExtents.d_max.y, area.d_max.y);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::removeChildExtents(const Window& wnd)
+{
+    const std::unordered_map<const Window*, size_t>::iterator index =
+        d_childAreaIndices.find(&wnd);
+    if (index == d_childAreaIndices.end())
+        return;
+
+    if (d_childExtentsValid && isOnChildExtentsEdge(d_childAreas[index->second].d_area))
+        d_childExtentsValid = false;
+
+    // move the last entry into the gap.
+    if (index->second != d_childAreas.size() - 1)
+    {
+        d_childAreas[index->second] = d_childAreas.back();
+        d_childAreaIndices[d_childAreas.back().d_window] = index->second;
+    }
+
+    d_childAreas.pop_back();
+    d_childAreaIndices.erase(index);
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::notifyContentChanged()
+{
+    if (d_initialising)
+    {
+        d_contentChangePending = true;
+        return;
+    }
+
+    WindowEventArgs args(this);
+    onContentChanged(args);
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::endInitialisation(void)
+{
+    Window::endInitialisation();
+
+    if (d_contentChangePending)
+    {
+        d_contentChangePending = false;
+        notifyContentChanged();
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -178,33 +439,36 @@ void ScrolledContainer::onAutoSizeSettingChanged(WindowEventArgs& e)
     fireEvent(EventAutoSizeSettingChanged, e, EventNamespace);
 
     if (d_autosizePane)
-    {
-        WindowEventArgs args(this);
-        onContentChanged(args);
-    }
+        notifyContentChanged();
 }
 
 //----------------------------------------------------------------------------//
 bool ScrolledContainer::handleChildSized(const EventArgs& e)
 {
+    Window* const child = static_cast<Window*>(static_cast<const ElementEventArgs&>(e).element);
     if (d_autosizePane)
-        makeSureChildUsesAbsoluteArea(static_cast<const ElementEventArgs&>(e).element);
+        makeSureChildUsesAbsoluteArea(child);
+
+    updateChildExtents(*child);
+    updateChildInView(*child);
 
     // Fire event that notifies that a child's area has changed.
-    WindowEventArgs args(this);
-    onContentChanged(args);
+    notifyContentChanged();
     return true;
 }
 
 //----------------------------------------------------------------------------//
 bool ScrolledContainer::handleChildMoved(const EventArgs& e)
 {
+    Window* const child = static_cast<Window*>(static_cast<const ElementEventArgs&>(e).element);
     if (d_autosizePane)
-        makeSureChildUsesAbsoluteArea(static_cast<const ElementEventArgs&>(e).element);
+        makeSureChildUsesAbsoluteArea(child);
+
+    updateChildExtents(*child);
+    updateChildInView(*child);
 
     // Fire event that notifies that a child's area has changed.
-    WindowEventArgs args(this);
-    onContentChanged(args);
+    notifyContentChanged();
     return true;
 }
 
@@ -268,13 +532,22 @@ void ScrolledContainer::onChildAdded(ElementEventArgs& e)
     d_eventConnections.insert(std::make_pair(static_cast<Window*>(e.element),
         static_cast<Window*>(e.element)->subscribeEvent(Window::EventMoved,
             Event::Subscriber(&ScrolledContainer::handleChildMoved, this))));
+    // alignment changes move centred children, too.
+    d_eventConnections.insert(std::make_pair(static_cast<Window*>(e.element),
+        static_cast<Window*>(e.element)->subscribeEvent(Window::EventHorizontalAlignmentChanged,
+            Event::Subscriber(&ScrolledContainer::handleChildMoved, this))));
+    d_eventConnections.insert(std::make_pair(static_cast<Window*>(e.element),
+        static_cast<Window*>(e.element)->subscribeEvent(Window::EventVerticalAlignmentChanged,
+            Event::Subscriber(&ScrolledContainer::handleChildMoved, this))));
 
     // force window to update what it thinks it's screen / pixel areas are.
     static_cast<Window*>(e.element)->notifyScreenAreaChanged(false);
 
+    updateChildExtents(*static_cast<Window*>(e.element));
+    updateChildInView(*static_cast<Window*>(e.element));
+
     // perform notification.
-    WindowEventArgs args(this);
-    onContentChanged(args);
+    notifyContentChanged();
 }
 
 //----------------------------------------------------------------------------//
@@ -282,6 +555,13 @@ void ScrolledContainer::onChildRemoved(ElementEventArgs& e)
 {
     Window::onChildRemoved(e);
 
+    removeChildExtents(*static_cast<Window*>(e.element));
+
+    const ChildInViewList::iterator pos = std::lower_bound(
+        d_childrenInView.begin(), d_childrenInView.end(), static_cast<Window*>(e.element));
+    if (pos != d_childrenInView.end() && *pos == e.element)
+        d_childrenInView.erase(pos);
+
     // disconnect from events for this window.
     ConnectionTracker::iterator conn;
     while ((conn = d_eventConnections.find(static_cast<Window*>(e.element))) != d_eventConnections.end())
@@ -292,10 +572,7 @@ void ScrolledContainer::onChildRemoved(ElementEventArgs& e)
 
     // perform notification only if we're not currently being destroyed
     if (!d_destructionStarted)
-    {
-        WindowEventArgs args(this);
-        onContentChanged(args);
-    }
+        notifyContentChanged();
 }
 
 //----------------------------------------------------------------------------//
@@ -304,8 +581,7 @@ void ScrolledContainer::onParentSized(ElementEventArgs& e)
     Window::onParentSized(e);
 
     // perform notification.
-    WindowEventArgs args(this);
-    onContentChanged(args);
+    notifyContentChanged();
 }
 
 //----------------------------------------------------------------------------//
@@ -330,6 +606,12 @@ void ScrolledContainer::addScrolledContainerProperties(void)
         "  Value is \"l:[float] t:[float] r:[float] b:[float]\" (where l is left, t is top, r is right, and b is bottom).",
         nullptr, &ScrolledContainer::getChildExtentsArea, Rectf::zero()
     );
+
+    CEGUI_DEFINE_PROPERTY(ScrolledContainer, bool,
+        "ContentCullingEnabled", "Property to get/set whether children outside the visible area are "
+        "neither drawn nor updated while scrolling.  Value is either \"true\" or \"false\".",
+        &ScrolledContainer::setContentCullingEnabled, &ScrolledContainer::isContentCullingEnabled, false
+    );
 }
 
 //----------------------------------------------------------------------------//
@@ -348,7 +630,11 @@ void ScrolledContainer::setArea_impl(const UVector2& pos, const USize& size, boo
                                      bool adjust_size)
 {
     d_clientChildContentArea.invalidateCache();
+
+    // moving without being sized is how we are scrolled.
+    d_movingContent = d_contentCullingEnabled && size == getSize();
     Window::setArea_impl(pos, size, topLeftSizing, fireEvents, adjust_size);
+    d_movingContent = false;
 }
 
 //----------------------------------------------------------------------------//
@@ -0,0 +1,202 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Performance tests for the ColourPicker dialog
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifdef CEGUI_TESTS_HAVE_COMMON_DIALOGS
+
+#include <boost/test/unit_test.hpp>
+
+#include "ScenarioBenchmark.h"
+#include "CEGUI/Config.h"
+#include "CEGUI/CommonDialogs/Module.h"
+#include "CEGUI/CommonDialogs/ColourPicker/Controls.h"
+#include "CEGUI/CommonDialogs/ColourPicker/Conversions.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/WindowFactoryManager.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/widgets/RadioButton.h"
+#include "CEGUI/widgets/Slider.h"
+
+#include <iostream>
+#include <vector>
+
+//! Size of the colour picking image of the ColourPickerControls.
+static const size_t PICKING_IMAGE_SIZE = 260;
+
+//----------------------------------------------------------------------------//
+static void reportRegenerationRate(const ScenarioBenchmark::Result& result)
+{
+    std::cout << "  " << 1.0 / result.mean << " regenerations per second" << std::endl;
+}
+
+/*!
+\brief
+    Converts the colours of a picking image to RGB one at a time, as the
+    ColourPickerControls used to, and in batches.
+*/
+class ColourPickerConversionBenchmark
+{
+public:
+    ColourPickerConversionBenchmark() :
+        d_c0(PICKING_IMAGE_SIZE * PICKING_IMAGE_SIZE),
+        d_c1(d_c0.size()),
+        d_c2(d_c0.size()),
+        d_out(d_c0.size())
+    {
+    }
+
+    void run(const std::string& name, bool lab)
+    {
+        for (size_t y = 0; y < PICKING_IMAGE_SIZE; ++y)
+            for (size_t x = 0; x < PICKING_IMAGE_SIZE; ++x)
+            {
+                const size_t i = y * PICKING_IMAGE_SIZE + x;
+                const float xRel = x / static_cast<float>(PICKING_IMAGE_SIZE - 1);
+                const float yRel = y / static_cast<float>(PICKING_IMAGE_SIZE - 1);
+
+                d_c0[i] = lab ? 50.0f : xRel;
+                d_c1[i] = lab ? 127.0f - 255.0f * xRel : yRel;
+                d_c2[i] = lab ? 127.0f - 255.0f * yRel : 0.75f;
+            }
+
+        ScenarioBenchmark scalar(name + ", one colour at a time", 2, 20);
+        reportRegenerationRate(scalar.run([this, lab]()
+        {
+            for (size_t i = 0; i < d_out.size(); ++i)
+                d_out[i] = lab ?
+                    CEGUI::RGB_Colour(CEGUI::Lab_Colour(d_c0[i], d_c1[i], d_c2[i])) :
+                    CEGUI::RGB_Colour(CEGUI::HSV_Colour(d_c0[i], d_c1[i], d_c2[i]));
+        }));
+
+        ScenarioBenchmark batch(name + ", batched", 2, 20);
+        reportRegenerationRate(batch.run([this, lab]()
+        {
+            if (lab)
+                CEGUI::ColourPickerConversions::labToRGB(
+                    d_c0.data(), d_c1.data(), d_c2.data(), d_out.data(), d_out.size());
+            else
+                CEGUI::ColourPickerConversions::hsvToRGB(
+                    d_c0.data(), d_c1.data(), d_c2.data(), d_out.data(), d_out.size());
+        }));
+    }
+
+private:
+    std::vector<float> d_c0;
+    std::vector<float> d_c1;
+    std::vector<float> d_c2;
+    std::vector<CEGUI::RGB_Colour> d_out;
+};
+
+BOOST_AUTO_TEST_SUITE(ColourPickerPerformance)
+
+BOOST_AUTO_TEST_CASE(ConvertPickingImage)
+{
+    ColourPickerConversionBenchmark benchmark;
+    benchmark.run("ColourPicker Lab picking image conversion", true);
+    benchmark.run("ColourPicker HSV picking image conversion", false);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// the controls validate their edit boxes with a regular expression matcher.
+#ifdef CEGUI_HAS_PCRE_REGEX
+
+/*!
+\brief
+    Drags the colour slider of a ColourPickerControls window in each of its
+    modes. Every move regenerates the colour picking and slider images and
+    uploads them to the texture.
+*/
+class ColourPickerFixture
+{
+public:
+    ColourPickerFixture() :
+        d_controls(nullptr)
+    {
+        if (!CEGUI::WindowFactoryManager::getSingleton().isFactoryPresent(
+                CEGUI::ColourPickerControls::WidgetTypeName))
+            initialiseCEGUICommonDialogs();
+
+        CEGUI::SchemeManager& schemes = CEGUI::SchemeManager::getSingleton();
+        if (!schemes.isDefined("VanillaSkin"))
+            schemes.createFromFile("VanillaSkin.scheme");
+        if (!schemes.isDefined("VanillaCommonDialogs"))
+            schemes.createFromFile("VanillaCommonDialogs.scheme");
+
+        d_controls = static_cast<CEGUI::ColourPickerControls*>(
+            CEGUI::WindowManager::getSingleton().createWindow(
+                "Vanilla/ColourPickerControls"));
+    }
+
+    ~ColourPickerFixture()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_controls);
+        CEGUI::WindowManager::getSingleton().cleanDeadPool();
+    }
+
+    void dragSlider(const CEGUI::String& mode_button)
+    {
+        static_cast<CEGUI::RadioButton*>(d_controls->getChild(mode_button))->
+            setSelected(true);
+
+        CEGUI::Slider* slider = static_cast<CEGUI::Slider*>(
+            d_controls->getChild("__auto_colourpickerimageslider__"));
+
+        unsigned int step = 0;
+        ScenarioBenchmark benchmark(
+            "ColourPicker slider move, mode " +
+            std::string(mode_button.begin(), mode_button.end()), 5, 100);
+
+        reportRegenerationRate(benchmark.run([slider, &step]()
+        {
+            slider->setCurrentValue(static_cast<float>(++step % 100) / 100.0f);
+        }));
+    }
+
+    CEGUI::ColourPickerControls* d_controls;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ColourPickerControlsPerformance, ColourPickerFixture)
+
+BOOST_AUTO_TEST_CASE(DragSliderLab)
+{
+    dragSlider("__auto_LabradiobuttonL__");
+    dragSlider("__auto_Labradiobuttona__");
+    dragSlider("__auto_Labradiobuttonb__");
+}
+
+BOOST_AUTO_TEST_CASE(DragSliderHSV)
+{
+    dragSlider("__auto_HSVradiobuttonH__");
+    dragSlider("__auto_HSVradiobuttonS__");
+    dragSlider("__auto_HSVradiobuttonV__");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
+
+#endif
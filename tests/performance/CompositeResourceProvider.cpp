@@ -0,0 +1,138 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Performance test of file look-ups in CompositeResourceProvider
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Config.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "PerformanceTest.h"
+#include "CEGUI/CompositeResourceProvider.h"
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+
+#ifdef CEGUI_HAS_MINIZIP_RESOURCE_PROVIDER
+#   include "CEGUI/MinizipResourceProvider.h"
+#   include "minizip/zip.h"
+#endif
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+static const char COMPOSITE_PACK_FILENAME[] = "performance-test-composite-pack.zip";
+static const unsigned int COMPOSITE_FILE_COUNT = 1000;
+
+//----------------------------------------------------------------------------//
+static std::string getCompositeFileName(unsigned int index)
+{
+    std::stringstream s;
+    s << "performance-test-composite-" << index << ".xml";
+    return s.str();
+}
+
+/*!
+\brief
+    Loads files through a CompositeResourceProvider holding a directory
+    provider and, where available, an archive provider. Every other file is
+    written to the working directory and the rest to an archive.
+*/
+class CompositeResourceProviderPerformanceTest : public PerformanceTest
+{
+public:
+    CompositeResourceProviderPerformanceTest(const CEGUI::String& test_name) :
+        PerformanceTest(test_name),
+        d_archived(false)
+    {
+        d_provider.add<CEGUI::DefaultResourceProvider>("directory");
+
+#ifdef CEGUI_HAS_MINIZIP_RESOURCE_PROVIDER
+        zipFile zfile = zipOpen64(COMPOSITE_PACK_FILENAME, APPEND_STATUS_CREATE);
+        BOOST_REQUIRE(zfile != 0);
+        d_archived = true;
+#endif
+
+        const std::string content(512, 'x');
+
+        for (unsigned int i = 0; i < COMPOSITE_FILE_COUNT; ++i)
+        {
+#ifdef CEGUI_HAS_MINIZIP_RESOURCE_PROVIDER
+            if (i % 2)
+            {
+                zip_fileinfo info = zip_fileinfo();
+                BOOST_REQUIRE(zipOpenNewFileInZip64(zfile, getCompositeFileName(i).c_str(),
+                    &info, 0, 0, 0, 0, 0, 0, Z_DEFAULT_COMPRESSION, 0) == ZIP_OK);
+                zipWriteInFileInZip(zfile, content.c_str(),
+                                    static_cast<unsigned>(content.size()));
+                zipCloseFileInZip(zfile);
+                continue;
+            }
+#endif
+            std::ofstream file(getCompositeFileName(i).c_str(), std::ios::binary);
+            file << content;
+        }
+
+#ifdef CEGUI_HAS_MINIZIP_RESOURCE_PROVIDER
+        zipClose(zfile, 0);
+        d_provider.add(new CEGUI::MinizipResourceProvider(COMPOSITE_PACK_FILENAME, false), "archive");
+#endif
+    }
+
+    ~CompositeResourceProviderPerformanceTest()
+    {
+        for (unsigned int i = 0; i < COMPOSITE_FILE_COUNT; ++i)
+            if (!d_archived || i % 2 == 0)
+                std::remove(getCompositeFileName(i).c_str());
+
+        if (d_archived)
+            std::remove(COMPOSITE_PACK_FILENAME);
+    }
+
+    void doTest() override
+    {
+        for (unsigned int i = 0; i < COMPOSITE_FILE_COUNT; ++i)
+        {
+            CEGUI::RawDataContainer data;
+            d_provider.loadRawDataContainer(getCompositeFileName(i), data, "");
+            BOOST_REQUIRE_EQUAL(data.getSize(), 512u);
+            d_provider.unloadRawDataContainer(data);
+        }
+    }
+
+private:
+    CEGUI::CompositeResourceProvider d_provider;
+    bool d_archived;
+};
+
+BOOST_AUTO_TEST_SUITE(CompositeResourceProviderPerformance)
+
+BOOST_AUTO_TEST_CASE(LoadFiles)
+{
+    CompositeResourceProviderPerformanceTest test("CompositeResourceProvider load 1000 files");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,194 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Performance tests for FreeTypeFont glyph rasterisation
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Config.h"
+
+#ifdef CEGUI_HAS_FREETYPE
+
+#include <boost/test/unit_test.hpp>
+
+#include "ScenarioBenchmark.h"
+#include "CEGUI/FreeTypeFont.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+
+//! Number of characters never drawn before in the chat line of each repetition.
+static const size_t NEW_CHARACTER_COUNT = 30;
+
+/*!
+\brief
+    Draws a chat line of characters that were never drawn before with a
+    newly loaded font, which stalls the frame when the glyphs are rasterised
+    while the text geometry is built.
+*/
+class NewGlyphsBenchmark
+{
+public:
+    NewGlyphsBenchmark() :
+        d_font(nullptr),
+        d_firstCodePoint(0x0400)
+    {
+    }
+
+    void run(const std::string& name, bool async)
+    {
+        ScenarioBenchmark benchmark(name, 1, 20);
+        benchmark.run(
+            [this, async]() { setup(async); },
+            [this]() { draw(); },
+            [this]() { teardown(); });
+    }
+
+private:
+    void setup(bool async)
+    {
+        d_font = &static_cast<CEGUI::FreeTypeFont&>(
+            CEGUI::FontManager::getSingleton().createFreeTypeFont(
+                "NewGlyphsBenchmark", 48.0f, CEGUI::FontSizeUnit::Pixels, true,
+                "DejaVuSans.ttf"));
+        d_font->setUseAsyncRasterisation(async);
+
+        d_text.clear();
+        for (char32_t codePoint = d_firstCodePoint;
+             d_text.length() < NEW_CHARACTER_COUNT && codePoint < 0x10000; ++codePoint)
+        {
+            if (d_font->isCodepointAvailable(codePoint))
+                d_text += codePoint;
+        }
+    }
+
+    void draw()
+    {
+        std::vector<CEGUI::GeometryBuffer*> buffers = d_font->createTextRenderGeometry(
+            d_text, glm::vec2(0, 0), nullptr, false, CEGUI::ColourRect(),
+            CEGUI::DefaultParagraphDirection::LeftToRight);
+
+        for (CEGUI::GeometryBuffer* buffer : buffers)
+            CEGUI::System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+    }
+
+    void teardown()
+    {
+        d_font->waitForPendingGlyphs();
+        CEGUI::FontManager::getSingleton().destroy(*d_font);
+        d_font = nullptr;
+    }
+
+    CEGUI::FreeTypeFont* d_font;
+    char32_t d_firstCodePoint;
+    CEGUI::String d_text;
+};
+
+//! Font sizes a font is drawn at in each repetition, as after DPI changes.
+static const float RESCALE_SIZES[] = { 10.0f, 12.0f, 14.0f, 16.0f, 20.0f, 24.0f, 32.0f, 48.0f };
+
+/*!
+\brief
+    Changes the size of a font through several sizes and draws a paragraph at
+    each, which rasterises all of its glyphs again for every size unless the
+    glyphs are rendered from distance fields.
+*/
+class RescaleBenchmark
+{
+public:
+    RescaleBenchmark() :
+        d_font(nullptr),
+        d_text("The quick brown fox jumps over the lazy dog. "
+               "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG! 0123456789")
+    {
+    }
+
+    void run(const std::string& name, bool distance_field)
+    {
+        ScenarioBenchmark benchmark(name, 1, 20);
+        benchmark.run(
+            [this, distance_field]() { setup(distance_field); },
+            [this]() { rescale(); },
+            [this]() { teardown(); });
+    }
+
+private:
+    void setup(bool distance_field)
+    {
+        d_font = &static_cast<CEGUI::FreeTypeFont&>(
+            CEGUI::FontManager::getSingleton().createFreeTypeFont(
+                "RescaleBenchmark", 13.0f, CEGUI::FontSizeUnit::Pixels, true,
+                "DejaVuSans.ttf"));
+        d_font->setUseDistanceField(distance_field);
+        draw();
+    }
+
+    void rescale()
+    {
+        for (float size : RESCALE_SIZES)
+        {
+            d_font->setSize(size);
+            draw();
+        }
+    }
+
+    void draw()
+    {
+        std::vector<CEGUI::GeometryBuffer*> buffers = d_font->createTextRenderGeometry(
+            d_text, glm::vec2(0, 0), nullptr, false, CEGUI::ColourRect(),
+            CEGUI::DefaultParagraphDirection::LeftToRight);
+
+        for (CEGUI::GeometryBuffer* buffer : buffers)
+            CEGUI::System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+    }
+
+    void teardown()
+    {
+        CEGUI::FontManager::getSingleton().destroy(*d_font);
+        d_font = nullptr;
+    }
+
+    CEGUI::FreeTypeFont* d_font;
+    CEGUI::String d_text;
+};
+
+BOOST_AUTO_TEST_SUITE(FreeTypeFontPerformance)
+
+BOOST_AUTO_TEST_CASE(DrawNewGlyphs)
+{
+    NewGlyphsBenchmark benchmark;
+    benchmark.run("FreeTypeFont draw 30 new glyphs, rasterised on demand", false);
+    benchmark.run("FreeTypeFont draw 30 new glyphs, rasterised in the background", true);
+}
+
+BOOST_AUTO_TEST_CASE(RescaleFont)
+{
+    RescaleBenchmark benchmark;
+    benchmark.run("FreeTypeFont draw a paragraph at 8 sizes, bitmap glyphs", false);
+    benchmark.run("FreeTypeFont draw a paragraph at 8 sizes, distance field glyphs", true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,82 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Performance tests for the ImageManager
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "PerformanceTest.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/PropertyHelper.h"
+
+static const unsigned int IMAGE_COLLECTION_COUNT = 100;
+static const unsigned int IMAGES_PER_COLLECTION = 50;
+
+//----------------------------------------------------------------------------//
+static CEGUI::String getCollectionName(unsigned int index)
+{
+    return "PerfCollection" + CEGUI::PropertyHelper<std::uint32_t>::toString(index);
+}
+
+/*!
+\brief
+    Destroys many image collections, as unloading the imagesets of a few
+    schemes does, while all of their images are defined.
+*/
+class ImageCollectionPerformanceTest : public PerformanceTest
+{
+public:
+    ImageCollectionPerformanceTest(const CEGUI::String& test_name) :
+        PerformanceTest(test_name)
+    {
+        CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+
+        for (unsigned int c = 0; c < IMAGE_COLLECTION_COUNT; ++c)
+            for (unsigned int i = 0; i < IMAGES_PER_COLLECTION; ++i)
+                imgr.create("BitmapImage", getCollectionName(c) + "/Image" +
+                    CEGUI::PropertyHelper<std::uint32_t>::toString(i));
+    }
+
+    void doTest() override
+    {
+        CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+
+        for (unsigned int c = 0; c < IMAGE_COLLECTION_COUNT; ++c)
+            imgr.destroyImageCollection(getCollectionName(c), false);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(ImageManagerPerformance)
+
+BOOST_AUTO_TEST_CASE(DestroyImageCollections)
+{
+    ImageCollectionPerformanceTest test("ImageManager destroy 100 collections of 50 images");
+    test.execute();
+
+    BOOST_CHECK(CEGUI::ImageManager::getSingleton().getCollectionIterator(
+        getCollectionName(0)).isAtEnd());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
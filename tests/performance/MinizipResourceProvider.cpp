@@ -0,0 +1,149 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Performance test of archive look-ups in MinizipResourceProvider
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Config.h"
+
+#ifdef CEGUI_HAS_MINIZIP_RESOURCE_PROVIDER
+
+#include <boost/test/unit_test.hpp>
+
+#include "PerformanceTest.h"
+#include "CEGUI/MinizipResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+
+#include "minizip/zip.h"
+
+#include <cstdio>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+static const char PACK_FILENAME[] = "performance-test-pack.zip";
+static const unsigned int PACK_ENTRY_COUNT = 10000;
+
+//----------------------------------------------------------------------------//
+static std::string getPackEntryName(unsigned int index)
+{
+    std::stringstream s;
+    s << "pack/dir" << (index % 100) << "/entry" << index << ".xml";
+    return s.str();
+}
+
+//----------------------------------------------------------------------------//
+// Writes an archive of PACK_ENTRY_COUNT small files, alternating between
+// deflated and stored entries.
+static void createTestPack()
+{
+    zipFile zfile = zipOpen64(PACK_FILENAME, APPEND_STATUS_CREATE);
+    BOOST_REQUIRE(zfile != 0);
+
+    const std::string content(512, 'x');
+
+    for (unsigned int i = 0; i < PACK_ENTRY_COUNT; ++i)
+    {
+        zip_fileinfo info = zip_fileinfo();
+        const int method = (i % 2) ? 0 : Z_DEFLATED;
+
+        BOOST_REQUIRE(zipOpenNewFileInZip64(zfile, getPackEntryName(i).c_str(),
+            &info, 0, 0, 0, 0, 0, method, Z_DEFAULT_COMPRESSION, 0) == ZIP_OK);
+        zipWriteInFileInZip(zfile, content.c_str(),
+                            static_cast<unsigned>(content.size()));
+        zipCloseFileInZip(zfile);
+    }
+
+    zipClose(zfile, 0);
+}
+
+//----------------------------------------------------------------------------//
+class MinizipResourceProviderPerformanceTest : public PerformanceTest
+{
+public:
+    MinizipResourceProviderPerformanceTest(CEGUI::String test_name,
+                                           unsigned int threadCount) :
+        PerformanceTest(test_name),
+        d_threadCount(threadCount)
+    {
+    }
+
+    void doTest() override
+    {
+        CEGUI::MinizipResourceProvider provider(PACK_FILENAME, false);
+        BOOST_REQUIRE_EQUAL(provider.getArchiveEntryCount(), PACK_ENTRY_COUNT);
+
+        std::vector<CEGUI::String> names;
+        provider.getResourceGroupFileNames(names, "pack/dir7/*.xml", "");
+        BOOST_CHECK_EQUAL(names.size(), PACK_ENTRY_COUNT / 100);
+
+        std::vector<std::thread> threads;
+        for (unsigned int t = 0; t < d_threadCount; ++t)
+            threads.push_back(std::thread(&MinizipResourceProviderPerformanceTest::loadEntries,
+                                          this, std::ref(provider), t));
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+    void loadEntries(CEGUI::MinizipResourceProvider& provider, unsigned int first)
+    {
+        for (unsigned int i = first; i < PACK_ENTRY_COUNT; i += d_threadCount)
+        {
+            CEGUI::RawDataContainer data;
+            provider.loadRawDataContainer(getPackEntryName(i), data, "");
+            provider.unloadRawDataContainer(data);
+        }
+    }
+
+    unsigned int d_threadCount;
+};
+
+BOOST_AUTO_TEST_SUITE(MinizipResourceProviderPerformance)
+
+BOOST_AUTO_TEST_CASE(TenThousandEntriesTest)
+{
+    createTestPack();
+
+    MinizipResourceProviderPerformanceTest test(
+        "Load every file of a 10000 entry archive", 1);
+    test.execute();
+
+    std::remove(PACK_FILENAME);
+}
+
+BOOST_AUTO_TEST_CASE(TenThousandEntriesConcurrentTest)
+{
+    createTestPack();
+
+    MinizipResourceProviderPerformanceTest test(
+        "Load every file of a 10000 entry archive (4 threads)", 4);
+    test.execute();
+
+    std::remove(PACK_FILENAME);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
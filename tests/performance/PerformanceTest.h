@@ -31,6 +31,7 @@
 
 #include <boost/timer/timer.hpp>
 
+#include <fstream>
 #include <iostream>
 
 /*!
@@ -0,0 +1,114 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Performance tests for PropertyHelper parsing and formatting
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "PerformanceTest.h"
+#include "CEGUI/PropertyHelper.h"
+
+#include <iostream>
+#include <vector>
+
+/*!
+\brief
+    Parses a list of property strings of one type over and over again and
+    formats the results back, to measure the throughput of PropertyHelper.
+*/
+template<typename T>
+class PropertyHelperPerformanceTest : public PerformanceTest
+{
+public:
+    PropertyHelperPerformanceTest(const CEGUI::String& test_name,
+                                  const std::vector<CEGUI::String>& samples) :
+        PerformanceTest(test_name),
+        d_samples(samples)
+    {}
+
+    void doTest() override
+    {
+        const unsigned int iterations = 200000;
+        std::size_t formatted_length = 0;
+
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+            const CEGUI::String& sample = d_samples[i % d_samples.size()];
+            const T value = CEGUI::PropertyHelper<T>::fromString(sample);
+            formatted_length += CEGUI::PropertyHelper<T>::toString(value).length();
+        }
+
+        std::cout << "Parsed and formatted " << iterations << " values ("
+                  << formatted_length << " code units)" << std::endl;
+    }
+
+    std::vector<CEGUI::String> d_samples;
+};
+
+BOOST_AUTO_TEST_SUITE(PropertyHelperPerformance)
+
+BOOST_AUTO_TEST_CASE(Float)
+{
+    PropertyHelperPerformanceTest<float> test("PropertyHelper float",
+        { "0", "1", "-12.5", "0.333333343", "1024", "1e-05", "  7.25" });
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(Integer)
+{
+    PropertyHelperPerformanceTest<std::int32_t> test("PropertyHelper int32",
+        { "0", "42", "-1230", "2147483647", "  17" });
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(UDim)
+{
+    PropertyHelperPerformanceTest<CEGUI::UDim> test("PropertyHelper UDim",
+        { "{0.5,0}", "{1,-10}", "{0.25,12.5}", "0 32" });
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(UVector2)
+{
+    PropertyHelperPerformanceTest<CEGUI::UVector2> test("PropertyHelper UVector2",
+        { "{{0.5,0},{0.5,0}}", "{{0,10},{1,-24}}", "{ { 1, 0 }, {0.5, 100} }" });
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(URect)
+{
+    PropertyHelperPerformanceTest<CEGUI::URect> test("PropertyHelper URect",
+        { "{{0,0},{0,0},{1,0},{1,0}}", "{{0.05,4},{0.1,0},{0.95,-4},{0.9,22.5}}" });
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(ColourRect)
+{
+    PropertyHelperPerformanceTest<CEGUI::ColourRect> test("PropertyHelper ColourRect",
+        { "FFFFFFFF", "tl:FF000000 tr:FF00FF00 bl:FF0000FF br:80FFFFFF" });
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
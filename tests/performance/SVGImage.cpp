@@ -0,0 +1,106 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Performance test of repeated SVGImage rendering
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "PerformanceTest.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/svg/SVGImage.h"
+#include "CEGUI/svg/SVGData.h"
+#include "CEGUI/svg/SVGDataManager.h"
+
+#include <iostream>
+
+class SVGImageRenderPerformanceTest : public PerformanceTest
+{
+public:
+    SVGImageRenderPerformanceTest(const CEGUI::String& test_name,
+                                  const CEGUI::SVGImage& image) :
+        PerformanceTest(test_name),
+        d_image(image)
+    {}
+
+    void doTest() override
+    {
+        CEGUI::Renderer& renderer = *CEGUI::System::getSingleton().getRenderer();
+
+        for (unsigned int i = 0; i < 10000; ++i)
+        {
+            // Only the position changes, as it does when a widget is moved
+            const glm::vec2 position(static_cast<float>(i % 100), static_cast<float>(i % 37));
+            const CEGUI::ImageRenderSettings settings(
+                CEGUI::Rectf(position, CEGUI::Sizef(512.0f, 360.0f)));
+
+            std::vector<CEGUI::GeometryBuffer*> buffers = d_image.createRenderGeometry(settings);
+
+            for (CEGUI::GeometryBuffer* buffer : buffers)
+                renderer.destroyGeometryBuffer(*buffer);
+        }
+    }
+
+    const CEGUI::SVGImage& d_image;
+};
+
+BOOST_AUTO_TEST_SUITE(SVGImagePerformance)
+
+BOOST_AUTO_TEST_CASE(RepeatedRender)
+{
+    CEGUI::ImageManager::getSingleton().loadImageset("SVGSampleImageset.imageset");
+
+    const CEGUI::SVGImage& image = static_cast<const CEGUI::SVGImage&>(
+        CEGUI::ImageManager::getSingleton().get("SVGSampleImageset/SVGTestImage1"));
+
+    SVGImageRenderPerformanceTest test("SVGImage repeated render", image);
+    test.execute();
+
+    const CEGUI::SVGData& data = *const_cast<CEGUI::SVGImage&>(image).getSVGData();
+    std::cout << "Tesselation cache hits: " << data.getTesselationCacheHits()
+              << ", misses: " << data.getTesselationCacheMisses() << std::endl;
+
+    CEGUI::ImageManager::getSingleton().destroyImageCollection("SVGSampleImageset");
+    CEGUI::SVGDataManager::getSingleton().destroy("SVGSampleImageset");
+}
+
+BOOST_AUTO_TEST_CASE(RepeatedRasterisedRender)
+{
+    CEGUI::ImageManager::getSingleton().loadImageset("SVGSampleImageset.imageset");
+
+    CEGUI::SVGImage& image = static_cast<CEGUI::SVGImage&>(
+        CEGUI::ImageManager::getSingleton().get("SVGSampleImageset/SVGTestImage1"));
+    image.setUseRasterisation(true);
+
+    SVGImageRenderPerformanceTest test("SVGImage repeated rasterised render", image);
+    test.execute();
+
+    CEGUI::ImageManager::getSingleton().destroyImageCollection("SVGSampleImageset");
+    CEGUI::SVGDataManager::getSingleton().destroy("SVGSampleImageset");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,231 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    End-to-end UI scenario benchmarks on the NullRenderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "ScenarioBenchmark.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/Base.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/InputAggregator.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+namespace
+{
+//! Time stepped per frame, i.e. 60 frames per second.
+const float FrameTime = 1.0f / 60.0f;
+
+#ifdef CEGUI_HAS_PCRE_REGEX
+//! Layout used by the frame scenarios.
+const char* const MainLayout = "TaharezLookOverview.layout";
+#else
+// TaharezLookOverview has a Spinner, which can not be created without a
+// RegexMatcher, so fall back to the next largest TaharezLook layout.
+const char* const MainLayout = "TextSample.layout";
+#endif
+
+//! Layouts from the bundled datafiles used by the scenarios.
+const char* const Layouts[] =
+{
+    MainLayout,
+    "VanillaWindows.layout",
+    "TreeSampleTaharez.layout"
+};
+}
+
+/*
+ * Brings a bundled layout up in the default GUIContext, at a fixed display
+ * size, and takes it down again afterwards.
+ */
+struct ScenarioFixture
+{
+    ScenarioFixture() :
+        d_system(CEGUI::System::getSingleton()),
+        d_context(d_system.getDefaultGUIContext()),
+        d_originalDisplaySize(d_system.getRenderer()->getDisplaySize()),
+        d_root(nullptr)
+    {
+        d_system.notifyDisplaySizeChanged(CEGUI::Sizef(1024, 768));
+    }
+
+    ~ScenarioFixture()
+    {
+        destroyLayout();
+        d_system.notifyDisplaySizeChanged(d_originalDisplaySize);
+    }
+
+    static void loadVanillaScheme()
+    {
+        CEGUI::SchemeManager::getSingleton().createFromFile("VanillaSkin.scheme");
+    }
+
+    void createLayout(const CEGUI::String& filename)
+    {
+        d_root = CEGUI::WindowManager::getSingleton().loadLayoutFromFile(filename);
+        d_context.setRootWindow(d_root);
+    }
+
+    void destroyLayout()
+    {
+        if (!d_root)
+            return;
+
+        d_context.setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+        CEGUI::WindowManager::getSingleton().cleanDeadPool();
+        d_root = nullptr;
+    }
+
+    void renderFrame()
+    {
+        d_system.injectTimePulse(FrameTime);
+        d_context.injectTimePulse(FrameTime);
+        d_system.renderAllGUIContexts();
+    }
+
+    CEGUI::System& d_system;
+    CEGUI::GUIContext& d_context;
+    CEGUI::Sizef d_originalDisplaySize;
+    CEGUI::Window* d_root;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ScenarioPerformance, ScenarioFixture)
+
+BOOST_AUTO_TEST_CASE(ColdStart)
+{
+    // only the first run in a process is cold, so this is measured once.
+    ScenarioBenchmark benchmark(
+        "Cold start: VanillaSkin scheme, VanillaWindows layout and first frame", 0, 1);
+
+    benchmark.run([this]()
+    {
+        loadVanillaScheme();
+        createLayout("VanillaWindows.layout");
+        renderFrame();
+    });
+}
+
+BOOST_AUTO_TEST_CASE(SchemeLoad)
+{
+    CEGUI::SchemeManager& schemes = CEGUI::SchemeManager::getSingleton();
+
+    ScenarioBenchmark benchmark("Scheme load: VanillaSkin", 2, 10);
+    benchmark.run(
+        [&schemes]()
+        {
+            if (schemes.isDefined("VanillaSkin"))
+                schemes.destroy("VanillaSkin");
+        },
+        &ScenarioFixture::loadVanillaScheme,
+        ScenarioBenchmark::Step());
+}
+
+BOOST_AUTO_TEST_CASE(LayoutInstantiate)
+{
+    loadVanillaScheme();
+
+    for (const char* layout : Layouts)
+    {
+        ScenarioBenchmark benchmark(std::string("Layout instantiate: ") + layout, 2, 20);
+        benchmark.run(
+            ScenarioBenchmark::Step(),
+            [this, layout]() { createLayout(layout); },
+            [this]() { destroyLayout(); });
+    }
+}
+
+BOOST_AUTO_TEST_CASE(FullRedraw)
+{
+    loadVanillaScheme();
+
+    for (const char* layout : Layouts)
+    {
+        createLayout(layout);
+
+        ScenarioBenchmark benchmark(std::string("Full redraw: ") + layout, 3, 50);
+        benchmark.run([this]()
+        {
+            d_root->invalidate(true);
+            renderFrame();
+        });
+
+        destroyLayout();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SteadyStateFrame)
+{
+    createLayout(MainLayout);
+
+    ScenarioBenchmark benchmark(std::string("Steady state frame: ") + MainLayout, 10, 500);
+    benchmark.run([this]() { renderFrame(); });
+}
+
+BOOST_AUTO_TEST_CASE(CursorSweep)
+{
+    createLayout(MainLayout);
+
+    CEGUI::InputAggregator aggregator(&d_context);
+    aggregator.initialise();
+
+    // moves the cursor diagonally across the display, one frame per step.
+    ScenarioBenchmark benchmark(
+        std::string("Cursor sweep, 64 frames: ") + MainLayout, 2, 20);
+    benchmark.run([this, &aggregator]()
+    {
+        for (int step = 0; step <= 64; ++step)
+        {
+            aggregator.injectMousePosition(1024.0f * step / 64, 768.0f * step / 64);
+            renderFrame();
+        }
+    });
+
+    aggregator.injectMouseLeaves();
+}
+
+BOOST_AUTO_TEST_CASE(ResizeStorm)
+{
+    createLayout(MainLayout);
+
+    ScenarioBenchmark benchmark(
+        std::string("Resize storm, 32 frames: ") + MainLayout, 2, 10);
+    benchmark.run([this]()
+    {
+        for (int step = 0; step < 32; ++step)
+        {
+            d_system.notifyDisplaySizeChanged(
+                CEGUI::Sizef(800.0f + 16.0f * step, 600.0f + 12.0f * (step % 8)));
+            renderFrame();
+        }
+    });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,225 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Repeated, percentile reporting measurements for scenario benchmarks
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITestsScenarioBenchmark_h_
+#define _CEGUITestsScenarioBenchmark_h_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*!
+\brief
+    Measures one step of an end-to-end scenario.
+
+    The step is run a number of warm-up times that are not measured, followed
+    by the measured repetitions, each optionally surrounded by an unmeasured
+    setup and teardown. The wall time percentiles of the repetitions are
+    printed to the console and every result of the run is written to the
+    performance-scenario-results.json file, so that regressions can be gated
+    by a script.
+
+    The number of repetitions can be scaled with the environment variable
+    CEGUI_SCENARIO_REPETITION_SCALE, e.g. to get more stable numbers on a
+    gating machine.
+*/
+class ScenarioBenchmark
+{
+public:
+    typedef std::function<void()> Step;
+
+    //! Statistics over the measured repetitions, in seconds.
+    struct Result
+    {
+        std::string name;
+        unsigned int warmups;
+        unsigned int repetitions;
+        double min;
+        double mean;
+        double median;
+        double p90;
+        double p99;
+        double max;
+    };
+
+    ScenarioBenchmark(const std::string& name, unsigned int warmups,
+                      unsigned int repetitions) :
+        d_name(name),
+        d_warmups(warmups),
+        d_repetitions(scaleRepetitions(repetitions))
+    {
+    }
+
+    //! Measure \a step.
+    Result run(const Step& step)
+    {
+        return run(Step(), step, Step());
+    }
+
+    //! Measure \a step, calling the unmeasured \a setup and \a teardown around it.
+    Result run(const Step& setup, const Step& step, const Step& teardown)
+    {
+        for (unsigned int i = 0; i < d_warmups; ++i)
+            runOnce(setup, step, teardown);
+
+        std::vector<double> samples;
+        samples.reserve(d_repetitions);
+        for (unsigned int i = 0; i < d_repetitions; ++i)
+            samples.push_back(runOnce(setup, step, teardown));
+
+        const Result result = makeResult(samples);
+        report(result);
+        return result;
+    }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    static unsigned int scaleRepetitions(unsigned int repetitions)
+    {
+        const char* scale = std::getenv("CEGUI_SCENARIO_REPETITION_SCALE");
+        if (!scale)
+            return repetitions;
+
+        const double factor = std::atof(scale);
+        return factor > 0.0 ?
+            std::max(1u, static_cast<unsigned int>(repetitions * factor)) :
+            repetitions;
+    }
+
+    static double runOnce(const Step& setup, const Step& step,
+                          const Step& teardown)
+    {
+        if (setup)
+            setup();
+
+        const Clock::time_point start = Clock::now();
+        step();
+        const Clock::time_point end = Clock::now();
+
+        if (teardown)
+            teardown();
+
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+    //! Return the nearest rank \a percentile of the sorted \a samples.
+    static double percentile(const std::vector<double>& samples, double percentile)
+    {
+        const size_t rank = static_cast<size_t>(
+            std::ceil(percentile / 100.0 * samples.size()));
+        return samples[std::min(samples.size(), std::max<size_t>(rank, 1)) - 1];
+    }
+
+    Result makeResult(std::vector<double>& samples) const
+    {
+        std::sort(samples.begin(), samples.end());
+
+        double total = 0.0;
+        for (double sample : samples)
+            total += sample;
+
+        Result result;
+        result.name = d_name;
+        result.warmups = d_warmups;
+        result.repetitions = static_cast<unsigned int>(samples.size());
+        result.min = samples.front();
+        result.mean = total / samples.size();
+        result.median = percentile(samples, 50.0);
+        result.p90 = percentile(samples, 90.0);
+        result.p99 = percentile(samples, 99.0);
+        result.max = samples.back();
+        return result;
+    }
+
+    static void report(const Result& result)
+    {
+        std::cout << "Scenario " << result.name << ": median "
+            << result.median * 1000.0 << " ms, p90 " << result.p90 * 1000.0
+            << " ms, p99 " << result.p99 * 1000.0 << " ms ("
+            << result.repetitions << " repetitions)" << std::endl;
+
+        std::vector<Result>& results = getResults();
+        results.push_back(result);
+        writeResults(results);
+    }
+
+    //! Return the results of all scenarios measured by this process.
+    static std::vector<Result>& getResults()
+    {
+        static std::vector<Result> results;
+        return results;
+    }
+
+    //! Rewrite the JSON results file with all the results so far.
+    static void writeResults(const std::vector<Result>& results)
+    {
+        std::ofstream fout("performance-scenario-results.json",
+            std::ofstream::out | std::ofstream::trunc);
+
+        fout << "{\n  \"unit\": \"seconds\",\n  \"results\": [";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& r = results[i];
+            fout << (i ? ",\n" : "\n")
+                << "    {\"name\": \"" << escape(r.name) << "\""
+                << ", \"warmups\": " << r.warmups
+                << ", \"repetitions\": " << r.repetitions
+                << ", \"min\": " << r.min
+                << ", \"mean\": " << r.mean
+                << ", \"median\": " << r.median
+                << ", \"p90\": " << r.p90
+                << ", \"p99\": " << r.p99
+                << ", \"max\": " << r.max << "}";
+        }
+        fout << "\n  ]\n}\n";
+    }
+
+    static std::string escape(const std::string& str)
+    {
+        std::string result;
+        for (char c : str)
+        {
+            if (c == '"' || c == '\\')
+                result += '\\';
+            result += c;
+        }
+        return result;
+    }
+
+    std::string d_name;
+    unsigned int d_warmups;
+    unsigned int d_repetitions;
+};
+
+#endif
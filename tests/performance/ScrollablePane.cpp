@@ -0,0 +1,180 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Performance tests for filling and rearranging a ScrollablePane
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "PerformanceTest.h"
+
+#include "CEGUI/widgets/ScrollablePane.h"
+#include "CEGUI/widgets/ScrolledContainer.h"
+
+#include <boost/test/unit_test.hpp>
+
+/*!
+\brief
+    Base of the ScrollablePane tests, which work on a pane holding items
+    stacked on top of each other.
+*/
+class ScrollablePanePerformanceTest : public WindowPerformanceTest<CEGUI::ScrollablePane>
+{
+public:
+    ScrollablePanePerformanceTest(const CEGUI::String& test_name) :
+        WindowPerformanceTest<CEGUI::ScrollablePane>("TaharezLook/ScrollablePane", "Core/ScrollablePane")
+    {
+        d_testName = test_name;
+        d_window->setSize(CEGUI::USize(cegui_absdim(400), cegui_absdim(300)));
+    }
+
+    ~ScrollablePanePerformanceTest()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_window);
+    }
+
+protected:
+    void addItems()
+    {
+        for (int i = 0; i < ItemCount; ++i)
+        {
+            CEGUI::Window* item = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+            item->setArea(CEGUI::UVector2(cegui_absdim(0), cegui_absdim(static_cast<float>(i * ItemHeight))),
+                          CEGUI::USize(cegui_absdim(380), cegui_absdim(static_cast<float>(ItemHeight))));
+            d_window->addChild(item);
+        }
+    }
+
+    static const int ItemCount = 10000;
+    static const int ItemHeight = 20;
+};
+
+//! Fills the pane, optionally as one batch of content changes.
+class ScrollablePaneFillPerformanceTest : public ScrollablePanePerformanceTest
+{
+public:
+    ScrollablePaneFillPerformanceTest(const CEGUI::String& test_name, bool batch_insertion) :
+        ScrollablePanePerformanceTest(test_name),
+        d_batchInsertion(batch_insertion)
+    {
+    }
+
+    void doTest() override
+    {
+        if (d_batchInsertion)
+            d_window->beginInitialisation();
+
+        addItems();
+
+        if (d_batchInsertion)
+            d_window->endInitialisation();
+
+        render();
+    }
+
+private:
+    bool d_batchInsertion;
+};
+
+//! Moves and resizes items in a filled pane, like dragging them would.
+class ScrollablePaneDragPerformanceTest : public ScrollablePanePerformanceTest
+{
+public:
+    ScrollablePaneDragPerformanceTest(const CEGUI::String& test_name) :
+        ScrollablePanePerformanceTest(test_name)
+    {
+        addItems();
+        render();
+    }
+
+    void doTest() override
+    {
+        const CEGUI::ScrolledContainer* container = d_window->getContentPane();
+        CEGUI::Window* middle = container->getChildAtIdx(ItemCount / 2);
+        CEGUI::Window* last = container->getChildAtIdx(ItemCount - 1);
+
+        for (int i = 0; i < 10000; ++i)
+        {
+            middle->setPosition(CEGUI::UVector2(cegui_absdim(static_cast<float>(i % 7)),
+                                                cegui_absdim(static_cast<float>(i % 1000))));
+            last->setHeight(cegui_absdim(static_cast<float>(ItemHeight + i % 10)));
+        }
+
+        render();
+    }
+};
+
+//! Scrolls through a filled pane, rendering after each step.
+class ScrollablePaneScrollPerformanceTest : public ScrollablePanePerformanceTest
+{
+public:
+    ScrollablePaneScrollPerformanceTest(const CEGUI::String& test_name, bool content_culling) :
+        ScrollablePanePerformanceTest(test_name)
+    {
+        d_window->setContentCullingEnabled(content_culling);
+        addItems();
+        render();
+    }
+
+    void doTest() override
+    {
+        for (int i = 0; i < 500; ++i)
+        {
+            d_window->setVerticalScrollPosition(static_cast<float>(i % 100) / 100.0f);
+            render();
+        }
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(ScrollablePanePerformance)
+
+BOOST_AUTO_TEST_CASE(Fill)
+{
+    ScrollablePaneFillPerformanceTest test("ScrollablePane fill 10000 items", false);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(BatchedFill)
+{
+    ScrollablePaneFillPerformanceTest test("ScrollablePane batched fill 10000 items", true);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(Drag)
+{
+    ScrollablePaneDragPerformanceTest test("ScrollablePane drag items among 10000");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(Scroll)
+{
+    ScrollablePaneScrollPerformanceTest test("ScrollablePane scroll through 10000 items", false);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(CulledScroll)
+{
+    ScrollablePaneScrollPerformanceTest test("ScrollablePane culled scroll through 10000 items", true);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,158 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Performance tests for sizing StaticText widgets to their content
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/Window.h"
+#include "CEGUI/PropertyHelper.h"
+
+class AutoSizedStaticTextPerformanceTest : public PerformanceTest
+{
+public:
+    AutoSizedStaticTextPerformanceTest(CEGUI::String test_name, bool keep_aspect_ratio) :
+        PerformanceTest(test_name)
+    {
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(0, 800), CEGUI::UDim(0, 600)));
+
+        for (unsigned int i = 0; i < 20; ++i)
+        {
+            CEGUI::Window* panel = d_root->createChild("TaharezLook/StaticText");
+            panel->setProperty("HorzFormatting", "WordWrapLeftAligned");
+            if (keep_aspect_ratio)
+            {
+                panel->setAspectMode(CEGUI::AspectMode::Expand);
+                panel->setAspectRatio(2.f);
+                panel->setAdjustHeightToContent(true);
+            }
+            else
+            {
+                panel->setSize(CEGUI::USize(CEGUI::UDim(0, 300), CEGUI::UDim(0, 200)));
+            }
+            panel->setAdjustWidthToContent(true);
+            d_panels.push_back(panel);
+        }
+    }
+
+    ~AutoSizedStaticTextPerformanceTest()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    void doTest() override
+    {
+        // every text change re-sizes the panel to its content
+        for (unsigned int i = 0; i < 50; ++i)
+        {
+            for (CEGUI::Window* panel : d_panels)
+            {
+                panel->setText(
+                    "Item " + CEGUI::PropertyHelper<std::uint32_t>::toString(i) +
+                    ": the quick brown fox jumps over the lazy dog, then packs "
+                    "my box with five dozen liquor jugs.");
+            }
+        }
+    }
+
+    CEGUI::Window* d_root;
+    std::vector<CEGUI::Window*> d_panels;
+};
+
+/*!
+    Redraws panels whose text does not change, as when they are invalidated
+    by hovering or by changes of their parent.
+*/
+class StaticTextRedrawPerformanceTest : public PerformanceTest
+{
+public:
+    StaticTextRedrawPerformanceTest(CEGUI::String test_name) :
+        PerformanceTest(test_name)
+    {
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(0, 800), CEGUI::UDim(0, 600)));
+
+        for (unsigned int i = 0; i < 20; ++i)
+        {
+            CEGUI::Window* panel = d_root->createChild("TaharezLook/StaticText");
+            panel->setProperty("HorzFormatting", "WordWrapLeftAligned");
+            panel->setSize(CEGUI::USize(CEGUI::UDim(0, 300), CEGUI::UDim(0, 200)));
+            panel->setText(
+                "Item " + CEGUI::PropertyHelper<std::uint32_t>::toString(i) +
+                ": the quick brown fox jumps over the lazy dog, then packs "
+                "my box with five dozen liquor jugs.");
+            d_panels.push_back(panel);
+        }
+
+        d_root->draw();
+    }
+
+    ~StaticTextRedrawPerformanceTest()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    void doTest() override
+    {
+        for (unsigned int i = 0; i < 500; ++i)
+        {
+            for (CEGUI::Window* panel : d_panels)
+                panel->invalidate();
+
+            d_root->draw();
+        }
+    }
+
+    CEGUI::Window* d_root;
+    std::vector<CEGUI::Window*> d_panels;
+};
+
+BOOST_AUTO_TEST_SUITE(StaticTextPerformance)
+
+BOOST_AUTO_TEST_CASE(AutoWidth)
+{
+    AutoSizedStaticTextPerformanceTest test(
+        "50x text change of 20 word-wrapped panels adjusting their width", false);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(AutoSizeKeepingAspectRatio)
+{
+    AutoSizedStaticTextPerformanceTest test(
+        "50x text change of 20 word-wrapped panels adjusting their size keeping aspect ratio", true);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(RedrawUnchangedText)
+{
+    StaticTextRedrawPerformanceTest test(
+        "500x redraw of 20 word-wrapped panels with unchanged text");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
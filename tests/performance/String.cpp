@@ -0,0 +1,100 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Performance tests for String transcoding
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "PerformanceTest.h"
+#include "CEGUI/String.h"
+
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
+
+#include <iostream>
+
+class StringTranscodingPerformanceTest : public PerformanceTest
+{
+public:
+    StringTranscodingPerformanceTest(const CEGUI::String& test_name,
+                                     const std::u32string& sample) :
+        PerformanceTest(test_name)
+    {
+        // repeat the sample to get a paragraph sized corpus
+        while (d_utf32.size() < 4096)
+            d_utf32 += sample;
+
+        d_utf8 = CEGUI::String::convertUtf32ToUtf8(d_utf32);
+    }
+
+    void doTest() override
+    {
+        size_t total = 0;
+
+        for (unsigned int i = 0; i < 20000; ++i)
+        {
+            total += CEGUI::String::convertUtf8ToUtf32(d_utf8).size();
+            total += CEGUI::String::convertUtf32ToUtf8(d_utf32).size();
+        }
+
+        std::cout << "Converted " << total << " code units" << std::endl;
+    }
+
+    std::u32string d_utf32;
+    std::string d_utf8;
+};
+
+BOOST_AUTO_TEST_SUITE(StringPerformance)
+
+BOOST_AUTO_TEST_CASE(TranscodeAscii)
+{
+    StringTranscodingPerformanceTest test("String transcoding ASCII",
+        U"The quick brown fox jumps over the lazy dog. ");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(TranscodeLatin1)
+{
+    StringTranscodingPerformanceTest test("String transcoding Latin-1",
+        U"Français: à bientôt, mañana, Straße, naïve café. ");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(TranscodeCjk)
+{
+    StringTranscodingPerformanceTest test("String transcoding CJK",
+        U"中文字符测试。日本語のテキスト。");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(TranscodeEmoji)
+{
+    StringTranscodingPerformanceTest test("String transcoding emoji",
+        U"\U0001F600\U0001F44D\U0001F680 ok \U0001F389\U0001F308\U0001F355 ");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
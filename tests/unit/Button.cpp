@@ -0,0 +1,162 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for the state geometry cache of FalagardButton
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/widgets/PushButton.h"
+#include "CEGUI/WindowRenderer.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/ImageManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct ButtonFixture
+{
+    ButtonFixture()
+    {
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(1, 0)));
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(d_root);
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        d_button = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/Button");
+        d_root->addChild(d_button);
+        d_button->setSize(CEGUI::USize(CEGUI::UDim(0, 120), CEGUI::UDim(0, 30)));
+        d_button->setText("Button");
+        d_button->setProperty("StateGeometryCacheEnabled", "true");
+
+        d_renderer = d_button->getWindowRenderer();
+    }
+
+    ~ButtonFixture()
+    {
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    void toggleDisabled()
+    {
+        d_button->setDisabled(!d_button->isDisabled());
+        d_root->draw();
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::Window* d_button;
+    CEGUI::WindowRenderer* d_renderer;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(Button, ButtonFixture)
+
+BOOST_AUTO_TEST_CASE(StateChangesReuseGeometry)
+{
+    BOOST_CHECK(d_renderer->isStateGeometryCacheEnabled());
+
+    d_root->draw();
+    const size_t normalBufferCount = d_button->getGeometryBuffers().size();
+    BOOST_CHECK(normalBufferCount > 0);
+
+    toggleDisabled();
+    toggleDisabled();
+    toggleDisabled();
+    toggleDisabled();
+
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheMissCount(), 2u);
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheHitCount(), 3u);
+    BOOST_CHECK_EQUAL(d_button->getGeometryBuffers().size(), normalBufferCount);
+    BOOST_CHECK(d_renderer->getStateGeometryCacheVertexCount() > 0);
+}
+
+BOOST_AUTO_TEST_CASE(ContentChangesRebuildGeometry)
+{
+    d_root->draw();
+    toggleDisabled();
+    toggleDisabled();
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheHitCount(), 1u);
+
+    d_renderer->resetStateGeometryCacheStatistics();
+    d_button->setText("Other");
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheMissCount(), 1u);
+
+    d_button->setProperty("NormalTextColour", "FF00FF00");
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheMissCount(), 2u);
+
+    toggleDisabled();
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheMissCount(), 3u);
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheHitCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(UntrackedInputsRebuildGeometry)
+{
+    d_root->draw();
+    d_renderer->resetStateGeometryCacheStatistics();
+
+    d_button->setTextParsingEnabled(false);
+    d_button->invalidate();
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheMissCount(), 1u);
+
+    // redefining any image could affect the imagery
+    CEGUI::ImageManager::getSingleton().create("BitmapImage", "ButtonTest/Image");
+    CEGUI::ImageManager::getSingleton().destroy("ButtonTest/Image");
+    d_button->invalidate();
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheMissCount(), 2u);
+
+    d_button->invalidate();
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheMissCount(), 2u);
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheHitCount(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(VertexLimitIsRespected)
+{
+    d_root->draw();
+    toggleDisabled();
+    const size_t oneStateVertexCount = d_renderer->getStateGeometryCacheVertexCount() / 2;
+    BOOST_REQUIRE(oneStateVertexCount > 0);
+
+    d_renderer->setStateGeometryCacheVertexLimit(oneStateVertexCount);
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheVertexCount(), 0u);
+
+    toggleDisabled();
+    toggleDisabled();
+    toggleDisabled();
+    BOOST_CHECK(d_renderer->getStateGeometryCacheVertexCount() <= oneStateVertexCount);
+    BOOST_CHECK(!d_button->getGeometryBuffers().empty());
+
+    d_renderer->setStateGeometryCacheEnabled(false);
+    BOOST_CHECK_EQUAL(d_renderer->getStateGeometryCacheVertexCount(), 0u);
+    d_root->draw();
+    BOOST_CHECK(!d_button->getGeometryBuffers().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
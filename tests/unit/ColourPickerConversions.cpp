@@ -0,0 +1,101 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for the batch colour conversions of the ColourPicker
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifdef CEGUI_TESTS_HAVE_COMMON_DIALOGS
+
+#include "CEGUI/CommonDialogs/ColourPicker/Conversions.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+void checkClose(const CEGUI::RGB_Colour& batch, const CEGUI::RGB_Colour& scalar)
+{
+    // the batch conversions may round a component differently.
+    BOOST_CHECK_LE(std::abs(batch.r - scalar.r), 1);
+    BOOST_CHECK_LE(std::abs(batch.g - scalar.g), 1);
+    BOOST_CHECK_LE(std::abs(batch.b - scalar.b), 1);
+}
+}
+
+BOOST_AUTO_TEST_SUITE(ColourPickerConversions)
+
+BOOST_AUTO_TEST_CASE(LabToRGBMatchesScalar)
+{
+    std::vector<float> L, a, b;
+    for (float l = 0.0f; l <= 100.0f; l += 12.5f)
+        for (float ca = -128.0f; ca <= 127.0f; ca += 15.0f)
+            for (float cb = -128.0f; cb <= 127.0f; cb += 15.0f)
+            {
+                L.push_back(l);
+                a.push_back(ca);
+                b.push_back(cb);
+            }
+
+    std::vector<CEGUI::RGB_Colour> out(L.size());
+    CEGUI::ColourPickerConversions::labToRGB(L.data(), a.data(), b.data(),
+                                             out.data(), out.size());
+
+    for (size_t i = 0; i < out.size(); ++i)
+        checkClose(out[i], CEGUI::ColourPickerConversions::toRGB(L[i], a[i], b[i]));
+}
+
+BOOST_AUTO_TEST_CASE(HSVToRGBMatchesScalar)
+{
+    std::vector<float> H, S, V;
+    for (float h = 0.0f; h <= 1.0f; h += 1.0f / 48.0f)
+        for (float s = 0.0f; s <= 1.0f; s += 0.125f)
+            for (float v = 0.0f; v <= 1.0f; v += 0.125f)
+            {
+                H.push_back(h);
+                S.push_back(s);
+                V.push_back(v);
+            }
+    // the end of the hue range wraps around to red.
+    H.push_back(1.0f);
+    S.push_back(1.0f);
+    V.push_back(1.0f);
+
+    std::vector<CEGUI::RGB_Colour> out(H.size());
+    CEGUI::ColourPickerConversions::hsvToRGB(H.data(), S.data(), V.data(),
+                                             out.data(), out.size());
+
+    for (size_t i = 0; i < out.size(); ++i)
+        checkClose(out[i], CEGUI::ColourPickerConversions::toRGB(
+            CEGUI::HSV_Colour(H[i], S[i], V[i])));
+
+    BOOST_CHECK_EQUAL(out.back().r, 255);
+    BOOST_CHECK_EQUAL(out.back().g, 0);
+    BOOST_CHECK_EQUAL(out.back().b, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
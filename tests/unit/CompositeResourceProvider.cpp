@@ -0,0 +1,116 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for the file index of CompositeResourceProvider
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/CompositeResourceProvider.h"
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/*
+ * Writes files to the working directory, which the fixture's provider
+ * loads from, and removes them again when done.
+ */
+struct CompositeResourceProviderFixture
+{
+    CompositeResourceProviderFixture()
+    {
+        d_provider.add<CEGUI::DefaultResourceProvider>("directory");
+    }
+
+    ~CompositeResourceProviderFixture()
+    {
+        for (const std::string& filename : d_files)
+            std::remove(filename.c_str());
+    }
+
+    void writeFile(const std::string& filename, const std::string& content)
+    {
+        std::ofstream file(filename.c_str(), std::ios::binary);
+        file << content;
+        d_files.push_back(filename);
+    }
+
+    std::string load(const CEGUI::String& filename)
+    {
+        CEGUI::RawDataContainer data;
+        d_provider.loadRawDataContainer(filename, data, "");
+        const std::string content(reinterpret_cast<const char*>(data.getDataPtr()), data.getSize());
+        d_provider.unloadRawDataContainer(data);
+
+        return content;
+    }
+
+    CEGUI::CompositeResourceProvider d_provider;
+    std::vector<std::string> d_files;
+};
+
+BOOST_FIXTURE_TEST_SUITE(CompositeResourceProvider, CompositeResourceProviderFixture)
+
+BOOST_AUTO_TEST_CASE(LoadIndexedFiles)
+{
+    writeFile("composite-test-a.txt", "first");
+    writeFile("composite-test-b.txt", "second");
+
+    BOOST_CHECK_EQUAL(load("composite-test-a.txt"), "first");
+    BOOST_CHECK_EQUAL(load("composite-test-b.txt"), "second");
+
+    BOOST_CHECK_THROW(load("composite-test-missing.txt"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(load(""), CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_CASE(FindFilesAddedLater)
+{
+    writeFile("composite-test-a.txt", "first");
+    BOOST_CHECK_EQUAL(load("composite-test-a.txt"), "first");
+
+    // the group has been indexed by now; a miss indexes it again.
+    writeFile("composite-test-c.txt", "third");
+    BOOST_CHECK_EQUAL(load("composite-test-c.txt"), "third");
+}
+
+BOOST_AUTO_TEST_CASE(InvalidateRemovedFiles)
+{
+    writeFile("composite-test-a.txt", "first");
+    BOOST_CHECK_EQUAL(load("composite-test-a.txt"), "first");
+
+    std::remove("composite-test-a.txt");
+    d_provider.invalidateFileIndex("");
+    BOOST_CHECK_THROW(load("composite-test-a.txt"), CEGUI::InvalidRequestException);
+
+    d_provider.invalidateFileIndex();
+    BOOST_CHECK_THROW(load("composite-test-a.txt"), CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,174 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for the overlay geometry of FalagardEditbox
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/widgets/Editbox.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct EditboxFixture
+{
+    EditboxFixture() :
+        d_renderCount(0)
+    {
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(1, 0)));
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(d_root);
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        d_editbox = static_cast<CEGUI::Editbox*>(
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/Editbox"));
+        d_root->addChild(d_editbox);
+        d_editbox->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 32)));
+        d_editbox->setText("Hello world");
+        d_editbox->subscribeEvent(CEGUI::Window::EventRenderingStarted,
+            CEGUI::Event::Subscriber(&EditboxFixture::handleRenderingStarted, this));
+        d_editbox->activate();
+
+        d_root->draw();
+        d_renderCount = 0;
+    }
+
+    ~EditboxFixture()
+    {
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    bool handleRenderingStarted(const CEGUI::EventArgs&)
+    {
+        ++d_renderCount;
+        return true;
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::Editbox* d_editbox;
+    int d_renderCount;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(Editbox, EditboxFixture)
+
+BOOST_AUTO_TEST_CASE(CaretKeepsTextGeometry)
+{
+    d_editbox->setCaretIndex(3);
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderCount, 0);
+
+    d_editbox->setProperty("BlinkCaret", "true");
+    d_editbox->setProperty("BlinkCaretTimeout", "0.1");
+    CEGUI::System::getSingleton().getDefaultGUIContext().injectTimePulse(0.2f);
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderCount, 0);
+}
+
+BOOST_AUTO_TEST_CASE(SelectionChangesKeepFrameGeometry)
+{
+    // the text moves to the overlay when a selection starts
+    d_editbox->setSelection(1, 5);
+    d_root->draw();
+    BOOST_REQUIRE_EQUAL(d_renderCount, 1);
+
+    d_editbox->setSelection(2, 7);
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderCount, 1);
+
+    d_editbox->setProperty("BlinkCaret", "true");
+    d_editbox->setProperty("BlinkCaretTimeout", "0.1");
+    CEGUI::System::getSingleton().getDefaultGUIContext().injectTimePulse(0.2f);
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderCount, 1);
+
+    // and back when it ends
+    d_editbox->setSelection(0, 0);
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderCount, 2);
+}
+
+BOOST_AUTO_TEST_CASE(ScrollingRebuildsTextGeometry)
+{
+    d_editbox->setText(CEGUI::String(200, 'x'));
+    d_root->draw();
+    BOOST_REQUIRE_EQUAL(d_renderCount, 1);
+
+    // moving the caret to the end scrolls the text
+    d_editbox->setCaretIndex(200);
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderCount, 2);
+
+    d_editbox->setCaretIndex(199);
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderCount, 2);
+}
+
+BOOST_AUTO_TEST_CASE(MultiLineSelectionKeepsFrameGeometry)
+{
+    CEGUI::Window* mle = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/MultiLineEditbox");
+    d_root->addChild(mle);
+    mle->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 200)));
+    mle->setText("First line\nSecond line\nThird line");
+    mle->subscribeEvent(CEGUI::Window::EventRenderingStarted,
+        CEGUI::Event::Subscriber(&EditboxFixture::handleRenderingStarted, static_cast<EditboxFixture*>(this)));
+    d_root->draw();
+    d_renderCount = 0;
+
+    static_cast<CEGUI::EditboxBase*>(mle)->setSelection(3, 17);
+    d_root->draw();
+    BOOST_REQUIRE_EQUAL(d_renderCount, 1);
+
+    static_cast<CEGUI::EditboxBase*>(mle)->setSelection(5, 25);
+    static_cast<CEGUI::EditboxBase*>(mle)->setCaretIndex(25);
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderCount, 1);
+
+    static_cast<CEGUI::EditboxBase*>(mle)->setCaretIndex(2);
+    static_cast<CEGUI::EditboxBase*>(mle)->setSelection(0, 0);
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderCount, 2);
+}
+
+BOOST_AUTO_TEST_CASE(OverlayWithoutSupportRebuildsWindow)
+{
+    // FalagardButton has no overlay of its own
+    CEGUI::Window* button = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/Button");
+    d_root->addChild(button);
+    button->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 30)));
+    button->subscribeEvent(CEGUI::Window::EventRenderingStarted,
+        CEGUI::Event::Subscriber(&EditboxFixture::handleRenderingStarted, static_cast<EditboxFixture*>(this)));
+    d_root->draw();
+    d_renderCount = 0;
+
+    button->invalidateOverlay();
+    d_root->draw();
+    BOOST_CHECK_EQUAL(d_renderCount, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
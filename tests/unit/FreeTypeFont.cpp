@@ -0,0 +1,445 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests glyph rasterisation and lookup of FreeTypeFont
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Config.h"
+
+#ifdef CEGUI_HAS_FREETYPE
+
+#include "CEGUI/FreeTypeFont.h"
+#include "CEGUI/DistanceFieldGlyphAtlas.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+CEGUI::FreeTypeFont& createFont(const CEGUI::String& name, float size = 12.0f,
+                                const CEGUI::String& filename = "DejaVuSans.ttf")
+{
+    return static_cast<CEGUI::FreeTypeFont&>(
+        CEGUI::FontManager::getSingleton().createFreeTypeFont(
+            name, size, CEGUI::FontSizeUnit::Pixels, true, filename));
+}
+
+//! Lays out \a text, which prepares its glyphs, and returns the vertex count.
+size_t drawText(const CEGUI::Font& font, const CEGUI::String& text)
+{
+    std::vector<CEGUI::GeometryBuffer*> buffers = font.createTextRenderGeometry(
+        text, glm::vec2(0, 0), nullptr, false, CEGUI::ColourRect(),
+        CEGUI::DefaultParagraphDirection::LeftToRight);
+
+    size_t vertexCount = 0;
+    for (CEGUI::GeometryBuffer* buffer : buffers)
+    {
+        vertexCount += buffer->getVertexCount();
+        CEGUI::System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+    }
+
+    return vertexCount;
+}
+
+struct RenderSizeChangedCounter
+{
+    RenderSizeChangedCounter(CEGUI::Font& font) :
+        d_count(0),
+        d_connection(font.subscribeEvent(CEGUI::Font::EventRenderSizeChanged,
+            CEGUI::Event::Subscriber(&RenderSizeChangedCounter::handle, this)))
+    {
+    }
+
+    ~RenderSizeChangedCounter()
+    {
+        d_connection->disconnect();
+    }
+
+    bool handle(const CEGUI::EventArgs&)
+    {
+        ++d_count;
+        return true;
+    }
+
+    int d_count;
+    CEGUI::Event::Connection d_connection;
+};
+}
+
+BOOST_AUTO_TEST_SUITE(FreeTypeFont)
+
+BOOST_AUTO_TEST_CASE(AsyncGlyphsAreDrawnAfterProcessing)
+{
+    CEGUI::FreeTypeFont& font = createFont("AsyncRasterisationTest");
+    font.setUseAsyncRasterisation(true);
+    RenderSizeChangedCounter counter(font);
+
+    // the glyphs are queued and take up space, but are not drawn yet
+    BOOST_CHECK_EQUAL(drawText(font, "AB"), 0u);
+    BOOST_CHECK(font.getTextAdvance("AB") > 0.0f);
+    BOOST_CHECK(font.getGlyphForCodepoint('A')->getImage() == nullptr);
+    BOOST_CHECK(font.getGlyphForCodepoint('A')->getAdvance() > 0.0f);
+    BOOST_CHECK(font.getPendingGlyphCount() <= 2u);
+
+    font.waitForPendingGlyphs();
+
+    BOOST_CHECK_EQUAL(font.getPendingGlyphCount(), 0u);
+    BOOST_CHECK_EQUAL(counter.d_count, 1);
+    BOOST_CHECK(font.getGlyphForCodepoint('A')->getImage() != nullptr);
+    BOOST_CHECK(drawText(font, "AB") > drawText(font, "A"));
+
+    CEGUI::FontManager::getSingleton().destroy(font);
+}
+
+BOOST_AUTO_TEST_CASE(AsyncGlyphsMatchSynchronousGlyphs)
+{
+    CEGUI::FreeTypeFont& syncFont = createFont("SyncRasterisationTest");
+    CEGUI::FreeTypeFont& asyncFont = createFont("AsyncRasterisationTest");
+    asyncFont.setUseAsyncRasterisation(true);
+
+    const CEGUI::String text("Quick brown fox");
+    drawText(syncFont, text);
+    asyncFont.prewarmGlyphs(text);
+    asyncFont.waitForPendingGlyphs();
+
+    for (size_t i = 0; i < text.length(); ++i)
+    {
+        const CEGUI::FontGlyph* syncGlyph = syncFont.getGlyphForCodepoint(text[i]);
+        const CEGUI::FontGlyph* asyncGlyph = asyncFont.getGlyphForCodepoint(text[i]);
+
+        BOOST_CHECK_EQUAL(syncGlyph->getAdvance(), asyncGlyph->getAdvance());
+        BOOST_CHECK(syncGlyph->getImage()->getRenderedSize() ==
+                    asyncGlyph->getImage()->getRenderedSize());
+        BOOST_CHECK(syncGlyph->getImage()->getRenderedOffset() ==
+                    asyncGlyph->getImage()->getRenderedOffset());
+    }
+
+    CEGUI::FontManager::getSingleton().destroy(asyncFont);
+    CEGUI::FontManager::getSingleton().destroy(syncFont);
+}
+
+BOOST_AUTO_TEST_CASE(PrewarmRasterisesSynchronously)
+{
+    CEGUI::FreeTypeFont& font = createFont("PrewarmTest");
+
+    font.prewarmGlyphs('a', 'z');
+
+    BOOST_CHECK(font.getGlyphForCodepoint('a')->getImage() != nullptr);
+    BOOST_CHECK(font.getGlyphForCodepoint('z')->getImage() != nullptr);
+    BOOST_CHECK(font.getGlyphForCodepoint('A')->getImage() == nullptr);
+
+    CEGUI::FontManager::getSingleton().destroy(font);
+}
+
+BOOST_AUTO_TEST_CASE(DisablingAsyncKeepsFinishedGlyphs)
+{
+    CEGUI::FreeTypeFont& font = createFont("AsyncRasterisationTest");
+    font.setUseAsyncRasterisation(true);
+
+    font.prewarmGlyphs('a', 'z');
+    font.setUseAsyncRasterisation(false);
+
+    // glyphs the worker did not get to are rasterised on demand again
+    BOOST_CHECK_EQUAL(font.getPendingGlyphCount(), 0u);
+    BOOST_CHECK(drawText(font, "az") > drawText(font, "a"));
+    BOOST_CHECK(font.getGlyphForCodepoint('z')->getImage() != nullptr);
+
+    CEGUI::FontManager::getSingleton().destroy(font);
+}
+
+BOOST_AUTO_TEST_CASE(GrowingAtlasKeepsIndexedGlyphQuads)
+{
+    CEGUI::FreeTypeFont& font = createFont("AtlasGrowthTest");
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+
+    std::vector<CEGUI::GeometryBuffer*> buffers = font.createTextRenderGeometry(
+        "AB", glm::vec2(0, 0), nullptr, false, CEGUI::ColourRect(),
+        CEGUI::DefaultParagraphDirection::LeftToRight);
+    BOOST_REQUIRE_EQUAL(buffers.size(), 1u);
+    CEGUI::GeometryBuffer& buffer = *buffers.front();
+    BOOST_REQUIRE(buffer.isQuadIndexed());
+
+    const size_t vertexCount = buffer.getVertexCount();
+    const std::vector<float> vertexData(buffer.getVertexData());
+
+    // the initial atlas is far too small for all of these
+    const unsigned int generation = font.getGlyphGeometryGeneration();
+    font.prewarmGlyphs('a', 'z');
+    BOOST_REQUIRE(font.getGlyphGeometryGeneration() != generation);
+
+    // the texture coordinates are rescaled in place, the quads stay indexed
+    BOOST_CHECK(buffer.isQuadIndexed());
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), vertexCount);
+    BOOST_REQUIRE_EQUAL(buffer.getVertexData().size(), vertexData.size());
+    for (size_t i = 0; i < vertexData.size(); ++i)
+        if (i % 9 < 7)
+            BOOST_CHECK_EQUAL(buffer.getVertexData()[i], vertexData[i]);
+
+    renderer->destroyGeometryBuffer(buffer);
+    CEGUI::FontManager::getSingleton().destroy(font);
+}
+
+BOOST_AUTO_TEST_CASE(DistanceFieldOfSquare)
+{
+    // a 4x4 square in the middle of an 8x8 bitmap
+    std::vector<std::uint8_t> coverage(8 * 8, 0);
+    for (int y = 2; y < 6; ++y)
+        for (int x = 2; x < 6; ++x)
+            coverage[y * 8 + x] = 255;
+
+    std::vector<std::uint8_t> field;
+    CEGUI::DistanceFieldGlyphAtlas::generateDistanceField(
+        coverage.data(), 8, 8, 8, 4, field);
+
+    const int width = 16;
+    BOOST_REQUIRE_EQUAL(field.size(), 16u * 16u);
+
+    // the row through the middle of the square, which starts at x = 6
+    const std::uint8_t* row = field.data() + 7 * width;
+    BOOST_CHECK_EQUAL(row[0], 0);
+    BOOST_CHECK(row[5] < 128);
+    BOOST_CHECK(row[6] > 128);
+    BOOST_CHECK_EQUAL(static_cast<int>(row[5]) + row[6], 255);
+    for (int x = 1; x < 8; ++x)
+    {
+        BOOST_CHECK(row[x] >= row[x - 1]);
+        BOOST_CHECK_EQUAL(row[x], row[width - 1 - x]);
+    }
+
+    // the corners are further from the square than the sides
+    BOOST_CHECK(field[5 * width + 5] < field[7 * width + 5]);
+}
+
+BOOST_AUTO_TEST_CASE(DistanceFieldUsesEdgeCoverage)
+{
+    const std::uint8_t coverage[3] = { 255, 128, 0 };
+
+    std::vector<std::uint8_t> field;
+    CEGUI::DistanceFieldGlyphAtlas::generateDistanceField(
+        coverage, 3, 1, 3, 2, field);
+
+    // the edge lies in the middle of the half covered pixel
+    const std::uint8_t* row = field.data() + 2 * 7;
+    BOOST_CHECK_EQUAL(row[3], 128);
+    BOOST_CHECK(row[2] > 128);
+    BOOST_CHECK(row[4] < 128);
+}
+
+BOOST_AUTO_TEST_CASE(DistanceFieldFontsShareAtlas)
+{
+    CEGUI::FreeTypeFont& small = createFont("DistanceFieldSmall", 12.0f);
+    CEGUI::FreeTypeFont& large = createFont("DistanceFieldLarge", 24.0f);
+    small.setUseDistanceField(true);
+    large.setUseDistanceField(true);
+
+    BOOST_REQUIRE(small.getDistanceFieldAtlas() != nullptr);
+    BOOST_CHECK(small.getDistanceFieldAtlas() == large.getDistanceFieldAtlas());
+    BOOST_CHECK_EQUAL(CEGUI::DistanceFieldGlyphAtlas::getAtlasCount(), 1u);
+
+    BOOST_CHECK(drawText(small, "AB") > drawText(small, "A"));
+    const size_t glyphCount = small.getDistanceFieldAtlas()->getGlyphCount();
+    BOOST_CHECK_EQUAL(glyphCount, 2u);
+
+    // the large font draws the glyphs of the small one, scaled
+    BOOST_CHECK(drawText(large, "AB") > 0u);
+    BOOST_CHECK_EQUAL(large.getDistanceFieldAtlas()->getGlyphCount(), glyphCount);
+
+    const CEGUI::FontGlyph* smallGlyph = small.getGlyphForCodepoint('A');
+    const CEGUI::FontGlyph* largeGlyph = large.getGlyphForCodepoint('A');
+    BOOST_CHECK_CLOSE(largeGlyph->getAdvance(), 2.0f * smallGlyph->getAdvance(), 0.01f);
+    BOOST_CHECK_CLOSE(largeGlyph->getImage()->getRenderedSize().d_width,
+        2.0f * smallGlyph->getImage()->getRenderedSize().d_width, 0.01f);
+    BOOST_CHECK_CLOSE(largeGlyph->getImage()->getRenderedOffset().y,
+        2.0f * smallGlyph->getImage()->getRenderedOffset().y, 0.01f);
+
+    CEGUI::FontManager::getSingleton().destroy(large);
+    BOOST_CHECK_EQUAL(CEGUI::DistanceFieldGlyphAtlas::getAtlasCount(), 1u);
+    CEGUI::FontManager::getSingleton().destroy(small);
+    BOOST_CHECK_EQUAL(CEGUI::DistanceFieldGlyphAtlas::getAtlasCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(DistanceFieldSizeChangeKeepsGlyphs)
+{
+    CEGUI::FreeTypeFont& font = createFont("DistanceFieldResize");
+    font.setUseDistanceField(true);
+    RenderSizeChangedCounter counter(font);
+
+    drawText(font, "Quick brown fox");
+    const CEGUI::DistanceFieldGlyphAtlas* atlas = font.getDistanceFieldAtlas();
+    const size_t glyphCount = atlas->getGlyphCount();
+    const float advance = font.getTextAdvance("Quick brown fox");
+
+    font.setSize(36.0f);
+
+    BOOST_CHECK_EQUAL(counter.d_count, 1);
+    BOOST_CHECK(font.getDistanceFieldAtlas() == atlas);
+    drawText(font, "Quick brown fox");
+    BOOST_CHECK_CLOSE(font.getTextAdvance("Quick brown fox"), 3.0f * advance, 1.0f);
+    BOOST_CHECK_EQUAL(atlas->getGlyphCount(), glyphCount);
+
+    font.setUseDistanceField(false);
+    BOOST_CHECK(font.getDistanceFieldAtlas() == nullptr);
+    BOOST_CHECK_EQUAL(CEGUI::DistanceFieldGlyphAtlas::getAtlasCount(), 0u);
+    BOOST_CHECK(drawText(font, "AB") > drawText(font, "A"));
+
+    CEGUI::FontManager::getSingleton().destroy(font);
+}
+
+// GreatVibes has no cyrillic glyphs, which DejaVuSans has
+BOOST_AUTO_TEST_CASE(FallbackGlyphsAreDrawn)
+{
+    CEGUI::FreeTypeFont& font = createFont("FallbackDraw", 12.0f,
+                                           "GreatVibes-Regular.ttf");
+    const CEGUI::String text(U"\u0416");
+
+    BOOST_CHECK(!font.isCodepointAvailable(0x416));
+    BOOST_CHECK_EQUAL(drawText(font, text), 0u);
+
+    RenderSizeChangedCounter counter(font);
+    font.addFallbackFont("DejaVuSans.ttf");
+
+    BOOST_CHECK_EQUAL(counter.d_count, 1);
+    BOOST_CHECK_EQUAL(font.getFallbackFontCount(), 1u);
+    BOOST_CHECK(font.isCodepointAvailable(0x416));
+    BOOST_CHECK(drawText(font, text) > 0u);
+
+    // the font's own glyphs are not looked up in the fallback
+    const CEGUI::FreeTypeFont* fallback = font.getFallbackFont(0);
+    BOOST_CHECK(font.getGlyphForCodepoint(0x416) == fallback->getGlyphForCodepoint(0x416));
+    BOOST_CHECK(font.getGlyphForCodepoint('A') != fallback->getGlyphForCodepoint('A'));
+    BOOST_CHECK(font.getTextAdvance(text) > 0.0f);
+
+    font.clearFallbackFonts();
+    BOOST_CHECK_EQUAL(counter.d_count, 2);
+    BOOST_CHECK(!font.isCodepointAvailable(0x416));
+    BOOST_CHECK_EQUAL(drawText(font, text), 0u);
+
+    CEGUI::FontManager::getSingleton().destroy(font);
+}
+
+BOOST_AUTO_TEST_CASE(FallbackFontsAreSharedPerSize)
+{
+    CEGUI::FreeTypeFont& first = createFont("FallbackFirst", 12.0f,
+                                            "GreatVibes-Regular.ttf");
+    CEGUI::FreeTypeFont& second = createFont("FallbackSecond", 12.0f,
+                                             "mizufalp.ttf");
+    first.addFallbackFont("DejaVuSans.ttf");
+    second.addFallbackFont("DejaVuSans.ttf");
+
+    // a glyph rasterised for one font is reused by the other
+    BOOST_CHECK(first.getFallbackFont(0) == second.getFallbackFont(0));
+    drawText(first, U"\u0416");
+    BOOST_CHECK(second.getGlyphForCodepoint(0x416)->getImage() != nullptr);
+
+    second.setSize(24.0f);
+    BOOST_CHECK(first.getFallbackFont(0) != second.getFallbackFont(0));
+    BOOST_CHECK_EQUAL(second.getFallbackFontCount(), 1u);
+    BOOST_CHECK(drawText(second, U"\u0416") > 0u);
+
+    second.setSize(12.0f);
+    BOOST_CHECK(first.getFallbackFont(0) == second.getFallbackFont(0));
+
+    CEGUI::FontManager::getSingleton().destroy(first);
+    BOOST_CHECK(second.isCodepointAvailable(0x416));
+    BOOST_CHECK(drawText(second, U"\u0416") > 0u);
+    CEGUI::FontManager::getSingleton().destroy(second);
+}
+
+BOOST_AUTO_TEST_CASE(FallbackFontsFromXml)
+{
+    CEGUI::FontManager& fontManager = CEGUI::FontManager::getSingleton();
+    fontManager.createFromString(
+        "<Fonts version=\"4\">"
+        "<Font name=\"FallbackXml\" filename=\"GreatVibes-Regular.ttf\" "
+        "type=\"FreeType\" size=\"12\" sizeUnit=\"Pixels\">"
+        "<Fallback filename=\"mizufalp.ttf\" />"
+        "<Fallback filename=\"DejaVuSans.ttf\" resourceGroup=\"fonts\" />"
+        "</Font>"
+        "</Fonts>");
+
+    CEGUI::FreeTypeFont& font =
+        static_cast<CEGUI::FreeTypeFont&>(fontManager.get("FallbackXml"));
+    BOOST_CHECK_EQUAL(font.getFallbackFontCount(), 2u);
+    BOOST_CHECK(font.isCodepointAvailable(0x416));
+
+    fontManager.destroy(font);
+}
+
+#ifdef CEGUI_USE_RAQM
+BOOST_AUTO_TEST_CASE(ShapedAdvanceMatchesRenderedPen)
+{
+    // a fractional size, so the glyph advances are fractional too
+    CEGUI::FreeTypeFont& font = createFont("ShapedAdvance", 11.3f);
+    const CEGUI::String text("Wavy AV, text.");
+
+    for (const CEGUI::DefaultParagraphDirection dir :
+         { CEGUI::DefaultParagraphDirection::LeftToRight,
+           CEGUI::DefaultParagraphDirection::RightToLeft })
+    {
+        float nextPenPosX = 0.0f;
+        std::vector<CEGUI::GeometryBuffer*> buffers = font.createTextRenderGeometry(
+            text, nextPenPosX, glm::vec2(0, 0), nullptr, false, CEGUI::ColourRect(), dir);
+
+        for (CEGUI::GeometryBuffer* buffer : buffers)
+            CEGUI::System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+
+        BOOST_CHECK_EQUAL(font.getTextAdvance(text, dir), nextPenPosX);
+        BOOST_CHECK(font.getTextExtent(text, dir) >= font.getTextAdvance(text, dir) - 1.0f);
+    }
+
+    CEGUI::FontManager::getSingleton().destroy(font);
+}
+
+BOOST_AUTO_TEST_CASE(MeasuringUsesTheRenderedDirection)
+{
+    CEGUI::FreeTypeFont& font = createFont("ShapedDirection");
+    const CEGUI::String text("Direction");
+    const CEGUI::ShapedTextCache& cache = font.getShapedTextCache();
+
+    font.getTextExtent(text, CEGUI::DefaultParagraphDirection::RightToLeft);
+    const size_t misses = cache.getMissCount();
+
+    // rendering in the measured direction reuses the measured run
+    std::vector<CEGUI::GeometryBuffer*> buffers = font.createTextRenderGeometry(
+        text, glm::vec2(0, 0), nullptr, false, CEGUI::ColourRect(),
+        CEGUI::DefaultParagraphDirection::RightToLeft);
+    for (CEGUI::GeometryBuffer* buffer : buffers)
+        CEGUI::System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+
+    BOOST_CHECK_EQUAL(cache.getMissCount(), misses);
+
+    // while the other direction is shaped separately
+    drawText(font, text);
+    BOOST_CHECK_EQUAL(cache.getMissCount(), misses + 1);
+
+    CEGUI::FontManager::getSingleton().destroy(font);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,210 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for building window geometry on several threads
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/PropertyHelper.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+namespace
+{
+struct GeometryBuildFixture
+{
+    GeometryBuildFixture() :
+        d_context(CEGUI::System::getSingleton().getDefaultGUIContext()),
+        d_startedCount(0),
+        d_endedCount(0)
+    {
+        CEGUI::WindowManager& wm = CEGUI::WindowManager::getSingleton();
+
+        d_root = wm.createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(1, 0)));
+        d_context.setRootWindow(d_root);
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        for (int i = 0; i < 24; ++i)
+        {
+            CEGUI::Window* const button = wm.createWindow("TaharezLook/Button");
+            d_root->addChild(button);
+            button->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 10.0f + (i % 4) * 130.0f),
+                                                CEGUI::UDim(0, 10.0f + (i / 4) * 40.0f)));
+            button->setSize(CEGUI::USize(CEGUI::UDim(0, 120), CEGUI::UDim(0, 30)));
+            button->setText("Button " + CEGUI::PropertyHelper<int>::toString(i));
+        }
+
+        CEGUI::Window* const frame = wm.createWindow("TaharezLook/FrameWindow");
+        d_root->addChild(frame);
+        frame->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 10), CEGUI::UDim(0, 280)));
+        frame->setSize(CEGUI::USize(CEGUI::UDim(0, 300), CEGUI::UDim(0, 200)));
+        frame->setText("Frame");
+
+        // built on the main thread, in between the others
+        CEGUI::Window* const label = wm.createWindow("TaharezLook/Label");
+        frame->addChild(label);
+        label->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(0, 30)));
+        label->setText("Label");
+
+        subscribeRenderingEvents(*d_root);
+    }
+
+    ~GeometryBuildFixture()
+    {
+        d_context.setGeometryBuildThreadCount(1);
+        d_context.setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    void subscribeRenderingEvents(CEGUI::Window& window)
+    {
+        window.subscribeEvent(CEGUI::Window::EventRenderingStarted,
+            CEGUI::Event::Subscriber(&GeometryBuildFixture::handleStarted, this));
+        window.subscribeEvent(CEGUI::Window::EventRenderingEnded,
+            CEGUI::Event::Subscriber(&GeometryBuildFixture::handleEnded, this));
+
+        for (size_t i = 0; i < window.getChildCount(); ++i)
+            subscribeRenderingEvents(*window.getChildAtIdx(i));
+    }
+
+    bool handleStarted(const CEGUI::EventArgs&)
+    {
+        ++d_startedCount;
+        return true;
+    }
+
+    bool handleEnded(const CEGUI::EventArgs&)
+    {
+        ++d_endedCount;
+        return true;
+    }
+
+    //! Redraws every window and returns the vertex counts of their geometry.
+    std::vector<size_t> redrawAll()
+    {
+        d_startedCount = 0;
+        d_endedCount = 0;
+
+        d_root->invalidate(true);
+        d_context.draw();
+
+        std::vector<size_t> vertexCounts;
+        collectVertexCounts(*d_root, vertexCounts);
+        return vertexCounts;
+    }
+
+    void collectVertexCounts(CEGUI::Window& window, std::vector<size_t>& vertexCounts)
+    {
+        size_t vertexCount = 0;
+        for (const CEGUI::GeometryBuffer* buffer : window.getGeometryBuffers())
+            vertexCount += buffer->getVertexCount();
+        vertexCounts.push_back(vertexCount);
+
+        for (size_t i = 0; i < window.getChildCount(); ++i)
+            collectVertexCounts(*window.getChildAtIdx(i), vertexCounts);
+    }
+
+    void setFont(CEGUI::Window& window, const CEGUI::Font* font)
+    {
+        window.setFont(font);
+
+        for (size_t i = 0; i < window.getChildCount(); ++i)
+            setFont(*window.getChildAtIdx(i), font);
+    }
+
+    size_t getWindowCount(const CEGUI::Window& window) const
+    {
+        size_t count = 1;
+        for (size_t i = 0; i < window.getChildCount(); ++i)
+            count += getWindowCount(*window.getChildAtIdx(i));
+
+        return count;
+    }
+
+    CEGUI::GUIContext& d_context;
+    CEGUI::Window* d_root;
+    size_t d_startedCount;
+    size_t d_endedCount;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(GUIContext, GeometryBuildFixture)
+
+BOOST_AUTO_TEST_CASE(SerialByDefault)
+{
+    BOOST_CHECK_EQUAL(d_context.getGeometryBuildThreadCount(), 1u);
+
+    d_context.setGeometryBuildThreadCount(4);
+    BOOST_CHECK_EQUAL(d_context.getGeometryBuildThreadCount(), 4u);
+
+    d_context.setGeometryBuildThreadCount(0);
+    BOOST_CHECK_EQUAL(d_context.getGeometryBuildThreadCount(), 0u);
+    BOOST_CHECK(!redrawAll().empty());
+}
+
+BOOST_AUTO_TEST_CASE(ParallelBuildMatchesSerialBuild)
+{
+    const std::vector<size_t> serial = redrawAll();
+    const size_t windowCount = getWindowCount(*d_root);
+    BOOST_CHECK_EQUAL(d_startedCount, windowCount);
+    BOOST_CHECK_EQUAL(d_endedCount, windowCount);
+
+    d_context.setGeometryBuildThreadCount(4);
+    const std::vector<size_t> parallel = redrawAll();
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(parallel.begin(), parallel.end(),
+                                  serial.begin(), serial.end());
+    BOOST_CHECK_EQUAL(d_startedCount, windowCount);
+    BOOST_CHECK_EQUAL(d_endedCount, windowCount);
+}
+
+BOOST_AUTO_TEST_CASE(UnpreparedGlyphsAreBuiltOnMainThread)
+{
+    // a font of its own has none of its glyphs prepared yet
+    CEGUI::Font& font = CEGUI::FontManager::getSingleton().createFreeTypeFont(
+        "GeometryBuildTest", 13.0f, CEGUI::FontSizeUnit::Pixels, true, "DejaVuSans.ttf");
+    setFont(*d_root, &font);
+
+    d_context.setGeometryBuildThreadCount(4);
+    const std::vector<size_t> parallel = redrawAll();
+
+    d_context.setGeometryBuildThreadCount(1);
+    const std::vector<size_t> serial = redrawAll();
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(parallel.begin(), parallel.end(),
+                                  serial.begin(), serial.end());
+
+    setFont(*d_root, nullptr);
+    CEGUI::FontManager::getSingleton().destroy(font);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,228 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for quad indexed GeometryBuffers
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Null/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Vertex.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+CEGUI::NullRenderer& getRenderer()
+{
+    return *static_cast<CEGUI::NullRenderer*>(
+        CEGUI::System::getSingleton().getRenderer());
+}
+
+CEGUI::GeometryBuffer& createTexturedBuffer()
+{
+    return CEGUI::System::getSingleton().getRenderer()->createGeometryBufferTextured();
+}
+
+//! Fills \a corners with a quad at \a x, in the order appendQuad expects.
+void makeQuad(CEGUI::TexturedColouredVertex* corners, float x)
+{
+    const glm::vec2 positions[4] =
+        { glm::vec2(x, 0.0f), glm::vec2(x, 10.0f),
+          glm::vec2(x + 10.0f, 10.0f), glm::vec2(x + 10.0f, 0.0f) };
+
+    for (int i = 0; i < 4; ++i)
+    {
+        corners[i].d_position = glm::vec3(positions[i], 0.0f);
+        corners[i].d_colour = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+        corners[i].d_texCoords = positions[i] / 10.0f;
+    }
+}
+
+//! Returns the x and y position of vertex \a index of \a buffer.
+glm::vec2 getPosition(const CEGUI::GeometryBuffer& buffer, std::size_t index)
+{
+    const float* vertex =
+        &buffer.getVertexData()[index * buffer.getVertexAttributeElementCount()];
+    return glm::vec2(vertex[0], vertex[1]);
+}
+}
+
+BOOST_AUTO_TEST_SUITE(GeometryBuffer)
+
+BOOST_AUTO_TEST_CASE(QuadsAreIndexed)
+{
+    CEGUI::NullRenderer& renderer = getRenderer();
+    CEGUI::GeometryBuffer& buffer = createTexturedBuffer();
+
+    CEGUI::TexturedColouredVertex corners[4];
+    makeQuad(corners, 0.0f);
+    buffer.appendQuad(corners);
+    makeQuad(corners, 20.0f);
+    buffer.appendQuad(corners);
+
+    BOOST_CHECK(buffer.isQuadIndexed());
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 8u);
+    BOOST_CHECK_EQUAL(buffer.getIndexCount(), 12u);
+
+    const std::vector<std::uint16_t>& indices = CEGUI::GeometryBuffer::getQuadIndices();
+    BOOST_REQUIRE_EQUAL(indices.size(), CEGUI::GeometryBuffer::MaxIndexedQuadCount * 6);
+    BOOST_CHECK_EQUAL(indices[6], 4u);
+    BOOST_CHECK_EQUAL(indices[10], 4u);
+    BOOST_CHECK_EQUAL(indices[11], 6u);
+
+    renderer.destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_CASE(TextureCoordinateUpdateKeepsQuadsIndexed)
+{
+    CEGUI::NullRenderer& renderer = getRenderer();
+    CEGUI::Texture& texture = renderer.createTexture("QuadTexCoordTest");
+    CEGUI::GeometryBuffer& buffer = createTexturedBuffer();
+    buffer.setTexture("texture0", &texture);
+
+    CEGUI::TexturedColouredVertex corners[4];
+    makeQuad(corners, 0.0f);
+    buffer.appendQuad(corners);
+    makeQuad(corners, 20.0f);
+    buffer.appendQuad(corners);
+
+    renderer.updateGeometryBufferTexCoords(&texture, 0.5f);
+
+    BOOST_CHECK(buffer.isQuadIndexed());
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 8u);
+    BOOST_CHECK(getPosition(buffer, 6) == glm::vec2(30.0f, 10.0f));
+    BOOST_CHECK_EQUAL(buffer.getVertexData()[6 * 9 + 7], 1.5f);
+    BOOST_CHECK_EQUAL(buffer.getVertexData()[6 * 9 + 8], 0.5f);
+
+    renderer.destroyGeometryBuffer(buffer);
+    renderer.destroyTexture(texture);
+}
+
+BOOST_AUTO_TEST_CASE(OtherGeometryExpandsQuads)
+{
+    CEGUI::NullRenderer& renderer = getRenderer();
+    CEGUI::GeometryBuffer& buffer = createTexturedBuffer();
+
+    CEGUI::TexturedColouredVertex corners[4];
+    makeQuad(corners, 0.0f);
+    buffer.appendQuad(corners);
+    buffer.appendGeometry(corners, 3);
+
+    BOOST_CHECK(!buffer.isQuadIndexed());
+    BOOST_CHECK_EQUAL(buffer.getIndexCount(), 0u);
+    BOOST_REQUIRE_EQUAL(buffer.getVertexCount(), 9u);
+
+    // the quad became the triangles (TL, BL, BR) and (TR, TL, BR)
+    BOOST_CHECK(getPosition(buffer, 2) == glm::vec2(10.0f, 10.0f));
+    BOOST_CHECK(getPosition(buffer, 3) == glm::vec2(10.0f, 0.0f));
+    BOOST_CHECK(getPosition(buffer, 4) == glm::vec2(0.0f, 0.0f));
+    BOOST_CHECK(getPosition(buffer, 5) == glm::vec2(10.0f, 10.0f));
+
+    // once expanded, quads are appended as triangles too
+    buffer.appendQuad(corners);
+    BOOST_CHECK(!buffer.isQuadIndexed());
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 15u);
+
+    // a reset buffer starts indexing again
+    buffer.reset();
+    buffer.appendQuad(corners);
+    BOOST_CHECK(buffer.isQuadIndexed());
+
+    buffer.setStencilRenderingActive(CEGUI::PolygonFillRule::EvenOdd);
+    BOOST_CHECK(!buffer.isQuadIndexed());
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 6u);
+
+    renderer.destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_CASE(AppendedQuadDataStaysIndexed)
+{
+    CEGUI::NullRenderer& renderer = getRenderer();
+    CEGUI::GeometryBuffer& source = createTexturedBuffer();
+
+    CEGUI::TexturedColouredVertex corners[4];
+    for (int i = 0; i < 3; ++i)
+    {
+        makeQuad(corners, i * 20.0f);
+        source.appendQuad(corners);
+    }
+
+    CEGUI::GeometryBuffer& copy = createTexturedBuffer();
+    copy.appendQuads(source.getVertexData().data(), 3);
+
+    BOOST_CHECK(copy.isQuadIndexed());
+    BOOST_CHECK(copy.getVertexData() == source.getVertexData());
+
+    // quads appended after other geometry are split into triangles
+    CEGUI::GeometryBuffer& mixed = createTexturedBuffer();
+    mixed.appendGeometry(corners, 3);
+    mixed.appendQuads(source.getVertexData().data(), 3);
+
+    BOOST_CHECK(!mixed.isQuadIndexed());
+    BOOST_REQUIRE_EQUAL(mixed.getVertexCount(), 21u);
+    BOOST_CHECK(getPosition(mixed, 3 + 6 * 2 + 2) == glm::vec2(50.0f, 10.0f));
+
+    renderer.destroyGeometryBuffer(mixed);
+    renderer.destroyGeometryBuffer(copy);
+    renderer.destroyGeometryBuffer(source);
+}
+
+BOOST_AUTO_TEST_CASE(IndexingReducesFrameBytes)
+{
+    CEGUI::NullRenderer& renderer = getRenderer();
+    const int quad_count = 100;
+
+    std::size_t frame_bytes[2];
+    for (int indexed = 0; indexed < 2; ++indexed)
+    {
+        renderer.setQuadIndexingEnabled(indexed != 0);
+        CEGUI::GeometryBuffer& buffer = createTexturedBuffer();
+
+        CEGUI::TexturedColouredVertex corners[4];
+        for (int i = 0; i < quad_count; ++i)
+        {
+            makeQuad(corners, i * 20.0f);
+            buffer.appendQuad(corners);
+        }
+
+        renderer.beginRendering();
+        buffer.draw();
+        renderer.endRendering();
+
+        const CEGUI::NullRenderer::FrameStatistics& stats =
+            renderer.getLastFrameStatistics();
+        BOOST_CHECK_EQUAL(stats.d_drawCalls, 1u);
+        BOOST_CHECK_EQUAL(stats.d_vertexCount, quad_count * (indexed ? 4u : 6u));
+        BOOST_CHECK_EQUAL(stats.d_indexCount, indexed ? quad_count * 6u : 0u);
+        frame_bytes[indexed] = stats.d_vertexBytes + stats.d_indexBytes;
+
+        renderer.destroyGeometryBuffer(buffer);
+    }
+    renderer.setQuadIndexingEnabled(true);
+
+    BOOST_CHECK(frame_bytes[1] < frame_bytes[0]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
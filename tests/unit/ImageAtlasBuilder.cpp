@@ -0,0 +1,154 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for packing loose images into atlas textures
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/ImageAtlasBuilder.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GeometryBuffer.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(ImageAtlasBuilder)
+
+BOOST_AUTO_TEST_CASE(LooseImagesShareOnePage)
+{
+    CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+    imgr.setImageAtlasingEnabled(true);
+
+    imgr.addBitmapImageFromFile("AtlasTest/Launcher", "ic_launcher.png");
+    imgr.addBitmapImageFromFile("AtlasTest/Logo", "logo.png");
+    imgr.addBitmapImageFromFile("AtlasTest/WindowsLook", "WindowsLook.png");
+    // too large for the atlas, keeps a texture of its own.
+    imgr.addBitmapImageFromFile("AtlasTest/SampleBrowser", "SampleBrowser.png");
+
+    const CEGUI::ImageAtlasBuilder::Statistics stats = imgr.buildImageAtlas();
+    imgr.setImageAtlasingEnabled(false);
+
+    BOOST_CHECK_EQUAL(stats.d_texturesBefore, 4u);
+    BOOST_CHECK_EQUAL(stats.d_texturesAfter, 2u);
+    BOOST_CHECK_EQUAL(stats.d_pageCount, 1u);
+    BOOST_CHECK(stats.d_fillRatio > 0.0f && stats.d_fillRatio <= 1.0f);
+
+    const CEGUI::BitmapImage& launcher =
+        static_cast<const CEGUI::BitmapImage&>(imgr.get("AtlasTest/Launcher"));
+    const CEGUI::BitmapImage& logo =
+        static_cast<const CEGUI::BitmapImage&>(imgr.get("AtlasTest/Logo"));
+    const CEGUI::BitmapImage& browser =
+        static_cast<const CEGUI::BitmapImage&>(imgr.get("AtlasTest/SampleBrowser"));
+
+    BOOST_REQUIRE(launcher.getTexture() != nullptr);
+    BOOST_CHECK_EQUAL(launcher.getTexture(), logo.getTexture());
+    BOOST_CHECK(browser.getTexture() != launcher.getTexture());
+
+    // image areas keep their size but move to their place on the page.
+    BOOST_CHECK_EQUAL(launcher.getImageArea().getSize(), CEGUI::Sizef(100, 100));
+    BOOST_CHECK_EQUAL(logo.getImageArea().getSize(), CEGUI::Sizef(183, 89));
+    BOOST_CHECK_EQUAL(launcher.getImageArea().getIntersection(logo.getImageArea()).getSize(),
+                      CEGUI::Sizef(0, 0));
+
+    imgr.destroy("AtlasTest/Launcher");
+    imgr.destroy("AtlasTest/Logo");
+    imgr.destroy("AtlasTest/WindowsLook");
+    imgr.destroy("AtlasTest/SampleBrowser");
+}
+
+BOOST_AUTO_TEST_CASE(QueuedImagesRenderBeforeTheAtlasIsBuilt)
+{
+    CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    imgr.setImageAtlasingEnabled(true);
+
+    imgr.addBitmapImageFromFile("AtlasQueued/Launcher", "ic_launcher.png");
+
+    const CEGUI::BitmapImage& launcher =
+        static_cast<const CEGUI::BitmapImage&>(imgr.get("AtlasQueued/Launcher"));
+    BOOST_REQUIRE(launcher.getTexture() != nullptr);
+    BOOST_CHECK_EQUAL(launcher.getImageArea().getSize(), CEGUI::Sizef(100, 100));
+    const CEGUI::String own_texture(launcher.getTexture()->getName());
+
+    std::vector<CEGUI::GeometryBuffer*> buffers = launcher.createRenderGeometry(
+        CEGUI::ImageRenderSettings(CEGUI::Rectf(0.0f, 0.0f, 100.0f, 100.0f)));
+    BOOST_REQUIRE_EQUAL(buffers.size(), 1u);
+    BOOST_CHECK_EQUAL(buffers[0]->getTexture("texture0"), launcher.getTexture());
+    renderer->destroyGeometryBuffer(*buffers[0]);
+
+    // building the atlas moves the image and destroys its own texture.
+    imgr.buildImageAtlas();
+    imgr.setImageAtlasingEnabled(false);
+
+    BOOST_CHECK(launcher.getTexture()->getName() != own_texture);
+    BOOST_CHECK(!renderer->isTextureDefined(own_texture));
+
+    imgr.destroy("AtlasQueued/Launcher");
+}
+
+BOOST_AUTO_TEST_CASE(DestroyedImagesAreNotPacked)
+{
+    CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+    imgr.setImageAtlasingEnabled(true);
+
+    imgr.addBitmapImageFromFile("AtlasTest/Discarded", "ic_launcher.png");
+    const CEGUI::String own_texture(static_cast<const CEGUI::BitmapImage&>(
+        imgr.get("AtlasTest/Discarded")).getTexture()->getName());
+    imgr.destroy("AtlasTest/Discarded");
+    BOOST_CHECK(!CEGUI::System::getSingleton().getRenderer()->isTextureDefined(own_texture));
+
+    const CEGUI::ImageAtlasBuilder::Statistics stats = imgr.buildImageAtlas();
+    imgr.setImageAtlasingEnabled(false);
+
+    BOOST_CHECK_EQUAL(stats.d_pageCount, 0u);
+    BOOST_CHECK_EQUAL(stats.d_texturesBefore, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(PagesAreDestroyedWithTheirLastImage)
+{
+    CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    imgr.setImageAtlasingEnabled(true);
+
+    imgr.addBitmapImageFromFile("AtlasPages/Launcher", "ic_launcher.png");
+    imgr.addBitmapImageFromFile("AtlasPages/Logo", "logo.png");
+
+    imgr.buildImageAtlas();
+    imgr.setImageAtlasingEnabled(false);
+
+    const CEGUI::Texture* page =
+        static_cast<const CEGUI::BitmapImage&>(imgr.get("AtlasPages/Logo")).getTexture();
+    BOOST_REQUIRE(page != nullptr);
+    const CEGUI::String page_name(page->getName());
+
+    imgr.destroy("AtlasPages/Launcher");
+    BOOST_CHECK(renderer->isTextureDefined(page_name));
+
+    imgr.destroyImageCollection("AtlasPages", false);
+    BOOST_CHECK(!renderer->isTextureDefined(page_name));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
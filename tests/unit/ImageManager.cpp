@@ -0,0 +1,125 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for the ImageManager collections and image handles
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/ImageHandle.h"
+#include "CEGUI/Image.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+unsigned int countCollection(const CEGUI::String& prefix)
+{
+    unsigned int count = 0;
+    for (CEGUI::ImageManager::ImageCollectionIterator it =
+            CEGUI::ImageManager::getSingleton().getCollectionIterator(prefix);
+         !it.isAtEnd(); ++it)
+    {
+        BOOST_CHECK(it.getCurrentKey().find(prefix + "/") == 0);
+        ++count;
+    }
+
+    return count;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(ImageManager)
+
+BOOST_AUTO_TEST_CASE(CollectionIteration)
+{
+    CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+    imgr.create("BitmapImage", "CollTest/A");
+    imgr.create("BitmapImage", "CollTest/B");
+    imgr.create("BitmapImage", "CollTest/Sub/C");
+    imgr.create("BitmapImage", "CollTestOther/D");
+
+    BOOST_CHECK_EQUAL(countCollection("CollTest"), 3u);
+    BOOST_CHECK_EQUAL(countCollection("CollTest/Sub"), 1u);
+    BOOST_CHECK_EQUAL(countCollection("CollTestOther"), 1u);
+    BOOST_CHECK_EQUAL(countCollection("Coll"), 0u);
+
+    imgr.destroy("CollTest/B");
+    BOOST_CHECK_EQUAL(countCollection("CollTest"), 2u);
+
+    imgr.destroy("CollTest/A");
+    imgr.destroy("CollTest/Sub/C");
+    imgr.destroy("CollTestOther/D");
+    BOOST_CHECK_EQUAL(countCollection("CollTest"), 0u);
+    BOOST_CHECK_EQUAL(countCollection("CollTest/Sub"), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(DestroyImageCollection)
+{
+    CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+    const unsigned int count = imgr.getImageCount();
+
+    imgr.create("BitmapImage", "CollTest/A");
+    imgr.create("BitmapImage", "CollTest/Sub/B");
+    imgr.create("BitmapImage", "CollTestOther/C");
+
+    imgr.destroyImageCollection("CollTest", false);
+
+    BOOST_CHECK(!imgr.isDefined("CollTest/A"));
+    BOOST_CHECK(!imgr.isDefined("CollTest/Sub/B"));
+    BOOST_CHECK(imgr.isDefined("CollTestOther/C"));
+    BOOST_CHECK_EQUAL(countCollection("CollTest/Sub"), 0u);
+
+    // destroying an unknown collection is harmless.
+    imgr.destroyImageCollection("CollTest", false);
+
+    imgr.destroy("CollTestOther/C");
+    BOOST_CHECK_EQUAL(imgr.getImageCount(), count);
+}
+
+BOOST_AUTO_TEST_CASE(HandleFollowsRecreatedImage)
+{
+    CEGUI::ImageManager& imgr = CEGUI::ImageManager::getSingleton();
+    CEGUI::Image& image = imgr.create("BitmapImage", "HandleTest/A");
+
+    CEGUI::ImageHandle handle("HandleTest/A");
+    BOOST_CHECK_EQUAL(&handle.get(), &image);
+
+    // destroying any image makes the handle resolve its name again.
+    imgr.destroy("HandleTest/A");
+    BOOST_CHECK_THROW(handle.get(), CEGUI::UnknownObjectException);
+
+    CEGUI::Image& recreated = imgr.create("BitmapImage", "HandleTest/A");
+    BOOST_CHECK_EQUAL(&handle.get(), &recreated);
+
+    CEGUI::Image& other = imgr.create("BitmapImage", "HandleTest/B");
+    handle = "HandleTest/B";
+    BOOST_CHECK_EQUAL(&handle.get(), &other);
+
+    handle.setName("");
+    BOOST_CHECK(handle.empty());
+
+    imgr.destroyImageCollection("HandleTest", false);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,115 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for the row layout of MultiColumnList
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/widgets/MultiColumnList.h"
+#include "CEGUI/widgets/ListboxTextItem.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct MultiColumnListFixture
+{
+    MultiColumnListFixture()
+    {
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(1, 0)));
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(d_root);
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        d_list = static_cast<CEGUI::MultiColumnList*>(
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/MultiColumnList"));
+        d_root->addChild(d_list);
+        d_list->setSize(CEGUI::USize(CEGUI::UDim(0, 300), CEGUI::UDim(0, 200)));
+        d_list->addColumn("First", 0, CEGUI::UDim(0.5f, 0));
+        d_list->addColumn("Second", 1, CEGUI::UDim(0.5f, 0));
+
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            const unsigned int row = d_list->addRow(new CEGUI::ListboxTextItem("Item"), 0);
+            d_list->setItem(new CEGUI::ListboxTextItem("Other"), 1, row);
+        }
+    }
+
+    ~MultiColumnListFixture()
+    {
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::MultiColumnList* d_list;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(MultiColumnList, MultiColumnListFixture)
+
+BOOST_AUTO_TEST_CASE(RowOffsetsAreSumsOfRowHeights)
+{
+    float offset = 0.0f;
+    for (unsigned int i = 0; i < d_list->getRowCount(); ++i)
+    {
+        BOOST_CHECK_CLOSE(d_list->getRowOffset(i), offset, 0.001f);
+        offset += d_list->getHighestRowItemHeight(i);
+    }
+
+    BOOST_CHECK_CLOSE(d_list->getTotalRowsHeight(), offset, 0.001f);
+    BOOST_CHECK_THROW(d_list->getRowOffset(d_list->getRowCount() + 1), CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_CASE(RowAtOffset)
+{
+    const float rowHeight = d_list->getHighestRowItemHeight(0);
+    BOOST_REQUIRE(rowHeight > 0.0f);
+
+    BOOST_CHECK_EQUAL(d_list->getRowAtOffset(-10.0f), 0u);
+    BOOST_CHECK_EQUAL(d_list->getRowAtOffset(0.0f), 0u);
+    BOOST_CHECK_EQUAL(d_list->getRowAtOffset(rowHeight * 10.5f), 10u);
+    BOOST_CHECK_EQUAL(d_list->getRowAtOffset(rowHeight * 10.0f), 10u);
+    BOOST_CHECK_EQUAL(d_list->getRowAtOffset(d_list->getTotalRowsHeight()), d_list->getRowCount());
+}
+
+BOOST_AUTO_TEST_CASE(ChangedItemsUpdateRowHeights)
+{
+    const float rowHeight = d_list->getHighestRowItemHeight(5);
+    const float totalHeight = d_list->getTotalRowsHeight();
+
+    d_list->setItem(new CEGUI::ListboxTextItem("Two\nlines"), 1, 5);
+
+    const float newRowHeight = d_list->getHighestRowItemHeight(5);
+    BOOST_CHECK(newRowHeight > rowHeight);
+    BOOST_CHECK_CLOSE(d_list->getTotalRowsHeight(), totalHeight - rowHeight + newRowHeight, 0.001f);
+    BOOST_CHECK_CLOSE(d_list->getRowOffset(6), d_list->getRowOffset(5) + newRowHeight, 0.001f);
+
+    d_list->removeRow(5);
+    BOOST_CHECK_CLOSE(d_list->getTotalRowsHeight(), totalHeight - rowHeight, 0.001f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,238 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for the frame profiler
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Profiler.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+
+/*
+ * Enables the profiler for a test and restores its default state afterwards.
+ */
+struct ProfilerFixture
+{
+    ProfilerFixture() :
+        d_profiler(CEGUI::Profiler::getSingleton())
+    {
+        d_profiler.setEnabled(true);
+        d_profiler.setTraceCaptureEnabled(true);
+    }
+
+    ~ProfilerFixture()
+    {
+        d_profiler.setEnabled(false);
+        d_profiler.setTraceCaptureEnabled(false);
+        d_profiler.setMaxTraceEvents(100000);
+        d_profiler.clearTrace();
+        d_profiler.resetZoneStatistics();
+        d_profiler.resetCounters();
+    }
+
+    const CEGUI::Profiler::ZoneStatistics* findZone(const CEGUI::String& name,
+        const CEGUI::String& window_type = "") const
+    {
+        d_statistics = d_profiler.getZoneStatistics();
+        for (const CEGUI::Profiler::ZoneStatistics& stats : d_statistics)
+            if (stats.name == name && stats.windowType == window_type)
+                return &stats;
+
+        return nullptr;
+    }
+
+    CEGUI::Profiler& d_profiler;
+    mutable std::vector<CEGUI::Profiler::ZoneStatistics> d_statistics;
+};
+
+/*
+ * Returns the text of the value \a key of the first trace event named \a name.
+ */
+static std::string getTraceValue(const std::string& trace,
+                                 const std::string& name, const std::string& key)
+{
+    const std::string::size_type event = trace.find("\"name\":\"" + name + "\"");
+    if (event == std::string::npos)
+        return std::string();
+
+    const std::string::size_type value =
+        trace.find("\"" + key + "\":", event) + key.size() + 3;
+    return trace.substr(value, trace.find_first_of(",}", value) - value);
+}
+
+BOOST_FIXTURE_TEST_SUITE(Profiler, ProfilerFixture)
+
+BOOST_AUTO_TEST_CASE(DisabledRecordsNothing)
+{
+    d_profiler.setEnabled(false);
+
+    {
+        CEGUI::ProfilerZone zone("Test::zone");
+    }
+    CEGUI::Profiler::count(CEGUI::ProfilerCounter::DrawCalls, 3);
+
+    BOOST_CHECK(d_profiler.getZoneStatistics().empty());
+    BOOST_CHECK_EQUAL(d_profiler.getTraceEventCount(), 0u);
+    BOOST_CHECK_EQUAL(d_profiler.getCounter(CEGUI::ProfilerCounter::DrawCalls), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ZonesAreAggregatedPerWindowType)
+{
+    const CEGUI::String button("TaharezLook/Button");
+    const CEGUI::String editbox("TaharezLook/Editbox");
+
+    for (int i = 0; i < 3; ++i)
+    {
+        CEGUI::ProfilerZone zone("Test::zone", &button);
+    }
+    {
+        CEGUI::ProfilerZone zone("Test::zone", &editbox);
+    }
+    {
+        CEGUI::ProfilerZone zone("Test::zone");
+    }
+
+    BOOST_CHECK_EQUAL(d_profiler.getZoneStatistics().size(), 3u);
+
+    const CEGUI::Profiler::ZoneStatistics* stats = findZone("Test::zone", button);
+    BOOST_REQUIRE(stats);
+    BOOST_CHECK_EQUAL(stats->callCount, 3u);
+    BOOST_CHECK(stats->totalTime >= stats->maxTime);
+
+    stats = findZone("Test::zone", editbox);
+    BOOST_REQUIRE(stats);
+    BOOST_CHECK_EQUAL(stats->callCount, 1u);
+
+    stats = findZone("Test::zone");
+    BOOST_REQUIRE(stats);
+    BOOST_CHECK_EQUAL(stats->callCount, 1u);
+
+    BOOST_CHECK_EQUAL(d_profiler.getTraceEventCount(), 5u);
+
+    d_profiler.resetZoneStatistics();
+    BOOST_CHECK(d_profiler.getZoneStatistics().empty());
+}
+
+BOOST_AUTO_TEST_CASE(ChromeTraceExport)
+{
+    const CEGUI::String type("Look/\"Quoted\"");
+    {
+        CEGUI::ProfilerZone outer("Test::outer");
+        CEGUI::ProfilerZone inner("Test::inner", &type);
+    }
+    CEGUI::Profiler::count(CEGUI::ProfilerCounter::Vertices, 6);
+    d_profiler.endFrame();
+    CEGUI::Profiler::count(CEGUI::ProfilerCounter::Vertices, 4);
+    d_profiler.endFrame();
+
+    BOOST_CHECK_EQUAL(d_profiler.getFrameCount(), 2u);
+    BOOST_CHECK_EQUAL(d_profiler.getCounter(CEGUI::ProfilerCounter::Vertices), 10u);
+
+    std::ostringstream out;
+    d_profiler.writeChromeTrace(out);
+    const std::string trace(out.str());
+
+    BOOST_CHECK_EQUAL(trace.compare(0, 16, "{\"traceEvents\":["), 0);
+    BOOST_CHECK(trace.find("\"name\":\"Test::outer\",\"cat\":\"CEGUI\",\"ph\":\"X\"") != std::string::npos);
+    BOOST_CHECK(trace.find("\"args\":{\"windowType\":\"Look/\\\"Quoted\\\"\"}") != std::string::npos);
+    // counter samples hold the amount counted during each frame
+    BOOST_CHECK(trace.find("\"name\":\"Vertices\",\"cat\":\"CEGUI\",\"ph\":\"C\"") != std::string::npos);
+    BOOST_CHECK(trace.find("\"args\":{\"value\":6}") != std::string::npos);
+    BOOST_CHECK(trace.find("\"args\":{\"value\":4}") != std::string::npos);
+
+    d_profiler.clearTrace();
+    BOOST_CHECK_EQUAL(d_profiler.getTraceEventCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ChromeTraceKeepsMicrosecondsOfLateEvents)
+{
+    // two adjacent zones a minute after the epoch must stay distinct
+    const CEGUI::Profiler::Clock::time_point start(
+        CEGUI::Profiler::Clock::now() + std::chrono::minutes(1));
+    const CEGUI::Profiler::Clock::time_point middle(
+        start + std::chrono::microseconds(1));
+    d_profiler.recordZone("Test::first", nullptr, start, middle);
+    d_profiler.recordZone("Test::second", nullptr, middle,
+                          middle + std::chrono::microseconds(1));
+
+    std::ostringstream out;
+    d_profiler.writeChromeTrace(out);
+    const std::string trace(out.str());
+
+    const std::string first_ts(getTraceValue(trace, "Test::first", "ts"));
+    const std::string second_ts(getTraceValue(trace, "Test::second", "ts"));
+    BOOST_CHECK_EQUAL(first_ts.find('e'), std::string::npos);
+    BOOST_CHECK(std::stod(first_ts) > 1e6);
+    BOOST_CHECK_CLOSE(std::stod(second_ts) - std::stod(first_ts), 1.0, 0.1);
+    BOOST_CHECK_EQUAL(getTraceValue(trace, "Test::first", "dur"), "1.000");
+
+    // the stream's own formatting is left as it was
+    out.str("");
+    out << 1234567.0;
+    BOOST_CHECK_EQUAL(out.str(), "1.23457e+06");
+}
+
+BOOST_AUTO_TEST_CASE(TraceEventLimit)
+{
+    d_profiler.setMaxTraceEvents(2);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        CEGUI::ProfilerZone zone("Test::zone");
+    }
+
+    BOOST_CHECK_EQUAL(d_profiler.getTraceEventCount(), 2u);
+    BOOST_CHECK_EQUAL(d_profiler.getDroppedTraceEventCount(), 3u);
+    // aggregation is not limited
+    BOOST_CHECK_EQUAL(findZone("Test::zone")->callCount, 5u);
+}
+
+#ifdef CEGUI_HAS_PROFILER
+BOOST_AUTO_TEST_CASE(InstrumentedDraw)
+{
+    CEGUI::GUIContext& context = CEGUI::System::getSingleton().getDefaultGUIContext();
+    CEGUI::Window* root = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/FrameWindow");
+    context.setRootWindow(root);
+
+    CEGUI::System::getSingleton().renderAllGUIContexts();
+
+    BOOST_CHECK(findZone("System::renderAllGUIContexts"));
+    BOOST_CHECK(findZone("Window::bufferGeometry", "TaharezLook/FrameWindow"));
+    BOOST_CHECK(d_profiler.getCounter(CEGUI::ProfilerCounter::GeometryBuffersCreated) > 0);
+    BOOST_CHECK(d_profiler.getCounter(CEGUI::ProfilerCounter::DrawCalls) > 0);
+    BOOST_CHECK_EQUAL(d_profiler.getFrameCount(), 1u);
+
+    context.setRootWindow(nullptr);
+    CEGUI::WindowManager::getSingleton().destroyWindow(root);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
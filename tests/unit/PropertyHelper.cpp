@@ -26,9 +26,17 @@
  ***************************************************************************/
 
 #include "CEGUI/PropertyHelper.h"
+#include "CEGUI/Exceptions.h"
 
 #include <boost/test/unit_test.hpp>
 
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <random>
+#include <sstream>
+
 BOOST_AUTO_TEST_SUITE(PropertyHelper)
 
 BOOST_AUTO_TEST_CASE(Integer)
@@ -258,4 +266,169 @@ BOOST_AUTO_TEST_CASE(Sizef)
     BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::Sizef>::fromString(CEGUI::PropertyHelper<CEGUI::Sizef>::toString(CEGUI::Sizef(-123456.25f, 1234567))), CEGUI::Sizef(-123456.25f, 1234567));
 }
 
+
+BOOST_AUTO_TEST_CASE(FloatRoundTrip)
+{
+    std::mt19937 random(1234);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::uint32_t bits = static_cast<std::uint32_t>(random());
+        float val;
+        std::memcpy(&val, &bits, sizeof(val));
+        if (!std::isfinite(val))
+            continue;
+
+        const CEGUI::String str = CEGUI::PropertyHelper<float>::toString(val);
+        const float parsed = CEGUI::PropertyHelper<float>::fromString(str);
+        if (std::memcmp(&parsed, &val, sizeof(val)) != 0)
+            BOOST_ERROR("float " << str << " did not read back as the written value");
+    }
+
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(std::numeric_limits<float>::max()), "3.4028235e+38");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(std::numeric_limits<float>::denorm_min()), "1e-45");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(0.1f), "0.1");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(-0.0f), "-0");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(100000000.0f), "1e+08");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(0.0001f), "0.0001");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(0.00001f), "1e-05");
+}
+
+BOOST_AUTO_TEST_CASE(DoubleRoundTrip)
+{
+    std::mt19937_64 random(1234);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::uint64_t bits = random();
+        double val;
+        std::memcpy(&val, &bits, sizeof(val));
+        if (!std::isfinite(val))
+            continue;
+
+        const CEGUI::String str = CEGUI::PropertyHelper<double>::toString(val);
+        const double parsed = CEGUI::PropertyHelper<double>::fromString(str);
+        if (std::memcmp(&parsed, &val, sizeof(val)) != 0)
+            BOOST_ERROR("double " << str << " did not read back as the written value");
+    }
+
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::toString(0.1), "0.1");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::toString(std::numeric_limits<double>::max()), "1.7976931348623157e+308");
+}
+
+BOOST_AUTO_TEST_CASE(ParsingMatchesClassicLocale)
+{
+    std::mt19937 random(4321);
+    std::uniform_int_distribution<int> digit(0, 9);
+    std::uniform_int_distribution<int> length(1, 24);
+    std::uniform_int_distribution<int> exponent(-50, 50);
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        std::string text = (i % 2) ? "-" : "";
+        const int integer_digits = length(random);
+        for (int d = 0; d < integer_digits; ++d)
+            text += static_cast<char>('0' + digit(random));
+        text += '.';
+        const int fraction_digits = length(random);
+        for (int d = 0; d < fraction_digits; ++d)
+            text += static_cast<char>('0' + digit(random));
+        if (i % 3 == 0)
+            text += "e" + std::to_string(exponent(random));
+
+        std::istringstream stream(text);
+        stream.imbue(std::locale::classic());
+        double expected;
+        stream >> expected;
+
+        const double parsed = CEGUI::PropertyHelper<double>::fromString(text);
+        if (parsed != expected)
+            BOOST_ERROR("double " << text << " was read as " << parsed << " instead of " << expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(IntegerLimits)
+{
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::int16_t>::fromString("-32768"), std::numeric_limits<std::int16_t>::min());
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::int64_t>::toString(std::numeric_limits<std::int64_t>::min()), "-9223372036854775808");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::int64_t>::fromString("-9223372036854775808"), std::numeric_limits<std::int64_t>::min());
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::uint64_t>::fromString("18446744073709551615"), std::numeric_limits<std::uint64_t>::max());
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::int32_t>::fromString(" 42 "), 42);
+
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<std::int16_t>::fromString("32768"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<std::int32_t>::fromString("2147483648"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<std::uint64_t>::fromString("18446744073709551616"), CEGUI::InvalidRequestException);
+
+    std::mt19937_64 random(1234);
+    for (int i = 0; i < 10000; ++i)
+    {
+        const std::int64_t val = static_cast<std::int64_t>(random());
+        BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::int64_t>::fromString(CEGUI::PropertyHelper<std::int64_t>::toString(val)), val);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CompoundRoundTrip)
+{
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> value(-10000.0f, 10000.0f);
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        const CEGUI::UBox box(CEGUI::UDim(value(random), value(random)), CEGUI::UDim(value(random), value(random)),
+                              CEGUI::UDim(value(random), value(random)), CEGUI::UDim(value(random), value(random)));
+        BOOST_CHECK(CEGUI::PropertyHelper<CEGUI::UBox>::fromString(CEGUI::PropertyHelper<CEGUI::UBox>::toString(box)) == box);
+
+        const CEGUI::URect rect(CEGUI::UDim(value(random), value(random)), CEGUI::UDim(value(random), value(random)),
+                                CEGUI::UDim(value(random), value(random)), CEGUI::UDim(value(random), value(random)));
+        BOOST_CHECK(CEGUI::PropertyHelper<CEGUI::URect>::fromString(CEGUI::PropertyHelper<CEGUI::URect>::toString(rect)) == rect);
+
+        const CEGUI::ColourRect colours(CEGUI::Colour(static_cast<CEGUI::argb_t>(random())), CEGUI::Colour(static_cast<CEGUI::argb_t>(random())),
+                                        CEGUI::Colour(static_cast<CEGUI::argb_t>(random())), CEGUI::Colour(static_cast<CEGUI::argb_t>(random())));
+        BOOST_CHECK(CEGUI::PropertyHelper<CEGUI::ColourRect>::fromString(CEGUI::PropertyHelper<CEGUI::ColourRect>::toString(colours)) == colours);
+
+        const glm::vec3 vec(value(random), value(random), value(random));
+        BOOST_CHECK(CEGUI::PropertyHelper<glm::vec3>::fromString(CEGUI::PropertyHelper<glm::vec3>::toString(vec)) == vec);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MalformedStrings)
+{
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<float>::fromString("abc"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<float>::fromString("-"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<float>::fromString("."), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<float>::fromString("1e39"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<CEGUI::Colour>::fromString("1FFFFFFFF"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<CEGUI::USize>::fromString("1 2"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<CEGUI::Rectf>::fromString("l:0 t:0 r:0"), CEGUI::InvalidRequestException);
+
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString("2e"), 2.0f);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString(".5"), 0.5f);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::Colour>::fromString("0xFF00FF00"), CEGUI::Colour(0xFF00FF00));
+
+    // random garbage must only ever be rejected with the parsing exception.
+    static const char alphabet[] = "0123456789+-.eE{},: tlrbwhxyz";
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<int> character(0, sizeof(alphabet) - 2);
+    std::uniform_int_distribution<int> length(0, 40);
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        std::string text;
+        const int count = length(random);
+        for (int c = 0; c < count; ++c)
+            text += alphabet[character(random)];
+
+        try
+        {
+            CEGUI::PropertyHelper<float>::fromString(text);
+            CEGUI::PropertyHelper<CEGUI::UBox>::fromString(text);
+            CEGUI::PropertyHelper<CEGUI::Rectf>::fromString(text);
+            CEGUI::PropertyHelper<glm::quat>::fromString(text);
+        }
+        catch (CEGUI::InvalidRequestException&)
+        {
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests the glyph geometry cache of RenderedStringTextComponent
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Config.h"
+
+#ifdef CEGUI_HAS_FREETYPE
+
+#include "CEGUI/RenderedStringTextComponent.h"
+#include "CEGUI/FreeTypeFont.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct GlyphGeometryFixture
+{
+    GlyphGeometryFixture() :
+        d_font(static_cast<CEGUI::FreeTypeFont&>(
+            CEGUI::FontManager::getSingleton().createFreeTypeFont(
+                "GlyphGeometryCacheTest", 12.0f, CEGUI::FontSizeUnit::Pixels,
+                true, "DejaVuSans.ttf"))),
+        d_component("The quick brown fox", &d_font),
+        d_clipRect(0.0f, 0.0f, 400.0f, 300.0f)
+    {
+    }
+
+    ~GlyphGeometryFixture()
+    {
+        CEGUI::FontManager::getSingleton().destroy(d_font);
+    }
+
+    /*!
+        Creates the geometry of \a component at \a position and returns its
+        vertex data. \a material receives the material of the first buffer.
+    */
+    std::vector<float> render(const CEGUI::RenderedStringTextComponent& component,
+                              const glm::vec2& position,
+                              CEGUI::RefCounted<CEGUI::RenderMaterial>* material = nullptr)
+    {
+        CEGUI::Rectf clipRect(d_clipRect);
+        clipRect.offset(position);
+
+        std::vector<CEGUI::GeometryBuffer*> buffers = component.createRenderGeometry(
+            nullptr, position, nullptr, &clipRect, 0.0f, 0.0f);
+
+        std::vector<float> vertexData;
+        for (CEGUI::GeometryBuffer* buffer : buffers)
+        {
+            BOOST_CHECK(buffer->isQuadIndexed());
+            BOOST_CHECK(buffer->getClippingRegion() == clipRect);
+            vertexData.insert(vertexData.end(), buffer->getVertexData().begin(),
+                              buffer->getVertexData().end());
+        }
+
+        if (material && !buffers.empty())
+            *material = buffers.front()->getRenderMaterial();
+
+        for (CEGUI::GeometryBuffer* buffer : buffers)
+            CEGUI::System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+
+        return vertexData;
+    }
+
+    //! Returns the vertex data laid out by a new component with the same text.
+    std::vector<float> renderUncached(const glm::vec2& position)
+    {
+        CEGUI::RenderedStringTextComponent component(d_component.getText(), &d_font);
+        component.setColours(d_component.getColours());
+        return render(component, position);
+    }
+
+    CEGUI::FreeTypeFont& d_font;
+    CEGUI::RenderedStringTextComponent d_component;
+    //! Clipping area relative to the rendered position.
+    CEGUI::Rectf d_clipRect;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(RenderedStringTextComponent, GlyphGeometryFixture)
+
+BOOST_AUTO_TEST_CASE(CachedGeometryIsReused)
+{
+    CEGUI::RefCounted<CEGUI::RenderMaterial> firstMaterial;
+    CEGUI::RefCounted<CEGUI::RenderMaterial> secondMaterial;
+
+    const std::vector<float> first = render(d_component, glm::vec2(10, 20), &firstMaterial);
+    const std::vector<float> second = render(d_component, glm::vec2(10, 20), &secondMaterial);
+
+    BOOST_CHECK(!first.empty());
+    BOOST_CHECK(first == second);
+    // the second buffers were created from the cache
+    BOOST_CHECK(firstMaterial == secondMaterial);
+}
+
+BOOST_AUTO_TEST_CASE(CachedGeometryIsMovedByWholePixels)
+{
+    render(d_component, glm::vec2(10, 20));
+
+    CEGUI::RefCounted<CEGUI::RenderMaterial> firstMaterial;
+    CEGUI::RefCounted<CEGUI::RenderMaterial> movedMaterial;
+    render(d_component, glm::vec2(10, 20), &firstMaterial);
+    const std::vector<float> moved = render(d_component, glm::vec2(47, -3), &movedMaterial);
+
+    BOOST_CHECK(firstMaterial == movedMaterial);
+    BOOST_CHECK(moved == renderUncached(glm::vec2(47, -3)));
+
+    // glyphs are aligned to pixels, fractional moves lay the text out again
+    const std::vector<float> fractional = render(d_component, glm::vec2(10.4f, 20.6f));
+    BOOST_CHECK(fractional == renderUncached(glm::vec2(10.4f, 20.6f)));
+}
+
+BOOST_AUTO_TEST_CASE(ClippedGeometryIsCached)
+{
+    // cut the text in the middle of a glyph
+    d_clipRect = CEGUI::Rectf(0.0f, 0.0f, 31.5f, 300.0f);
+
+    render(d_component, glm::vec2(10, 20));
+    BOOST_CHECK(render(d_component, glm::vec2(15, 22)) ==
+                renderUncached(glm::vec2(15, 22)));
+
+    d_clipRect = CEGUI::Rectf(0.0f, 0.0f, 55.5f, 300.0f);
+    BOOST_CHECK(render(d_component, glm::vec2(15, 22)) ==
+                renderUncached(glm::vec2(15, 22)));
+}
+
+BOOST_AUTO_TEST_CASE(TextAndColourChangesInvalidate)
+{
+    const std::vector<float> before = render(d_component, glm::vec2(10, 20));
+
+    d_component.setText("Jumps over the lazy dog");
+    const std::vector<float> newText = render(d_component, glm::vec2(10, 20));
+    BOOST_CHECK(newText != before);
+    BOOST_CHECK(newText == renderUncached(glm::vec2(10, 20)));
+
+    d_component.setColours(CEGUI::Colour(1.0f, 0.0f, 0.0f));
+    const std::vector<float> newColour = render(d_component, glm::vec2(10, 20));
+    BOOST_CHECK(newColour != newText);
+    BOOST_CHECK(newColour == renderUncached(glm::vec2(10, 20)));
+}
+
+BOOST_AUTO_TEST_CASE(FontChangesInvalidate)
+{
+    const std::vector<float> before = render(d_component, glm::vec2(10, 20));
+
+    d_font.setSize(24.0f);
+
+    const std::vector<float> resized = render(d_component, glm::vec2(10, 20));
+    BOOST_CHECK(resized != before);
+    BOOST_CHECK(resized == renderUncached(glm::vec2(10, 20)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
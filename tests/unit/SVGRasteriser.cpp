@@ -0,0 +1,239 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for the CPU rasterisation of SVG images
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/svg/SVGRasteriser.h"
+#include "CEGUI/svg/SVGImage.h"
+#include "CEGUI/svg/SVGData.h"
+#include "CEGUI/svg/SVGBasicShape.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+void appendVertex(CEGUI::SVGData::TesselatedGeometry& geometry,
+                  float x, float y, const glm::vec4& colour)
+{
+    const float vertex[] = { x, y, 0.0f, colour.x, colour.y, colour.z, colour.w };
+    geometry.d_vertexData.insert(geometry.d_vertexData.end(), vertex, vertex + 7);
+}
+
+void appendQuad(CEGUI::SVGData::TesselatedGeometry& geometry,
+                float left, float top, float right, float bottom, const glm::vec4& colour)
+{
+    appendVertex(geometry, left, top, colour);
+    appendVertex(geometry, left, bottom, colour);
+    appendVertex(geometry, right, bottom, colour);
+    appendVertex(geometry, left, top, colour);
+    appendVertex(geometry, right, bottom, colour);
+    appendVertex(geometry, right, top, colour);
+}
+
+CEGUI::SVGData::TesselatedGeometry createGeometry(CEGUI::PolygonFillRule fill_rule)
+{
+    CEGUI::SVGData::TesselatedGeometry geometry;
+    geometry.d_customTransform = glm::mat4(1.0f);
+    geometry.d_fillRule = fill_rule;
+    geometry.d_postStencilVertexCount = 0;
+    return geometry;
+}
+
+std::uint8_t alphaAt(const std::vector<std::uint8_t>& pixels, unsigned int width,
+                     unsigned int x, unsigned int y)
+{
+    return pixels[(y * width + x) * 4 + 3];
+}
+}
+
+BOOST_AUTO_TEST_SUITE(SVGRasteriser)
+
+BOOST_AUTO_TEST_CASE(SharedEdgesAreCoveredOnce)
+{
+    CEGUI::SVGData::TesselatedGeometryList geometry(1, createGeometry(CEGUI::PolygonFillRule::NoFilling));
+    appendQuad(geometry[0], 0.0f, 0.0f, 4.0f, 4.0f, glm::vec4(1.0f, 0.0f, 0.0f, 0.5f));
+
+    std::vector<std::uint8_t> pixels;
+    CEGUI::SVGRasteriser::rasterise(geometry, glm::vec2(2.0f, 2.0f), glm::vec2(0.0f, 0.0f),
+                                    10, 10, pixels);
+
+    BOOST_REQUIRE_EQUAL(pixels.size(), 10u * 10u * 4u);
+
+    // Every covered pixel, including those on the diagonal, is blended once.
+    for (unsigned int y = 0; y < 8; ++y)
+        for (unsigned int x = 0; x < 8; ++x)
+            BOOST_CHECK_EQUAL(alphaAt(pixels, 10, x, y), 128);
+
+    BOOST_CHECK_EQUAL(pixels[0], 255);
+    BOOST_CHECK_EQUAL(alphaAt(pixels, 10, 8, 8), 0);
+    BOOST_CHECK_EQUAL(alphaAt(pixels, 10, 9, 0), 0);
+}
+
+BOOST_AUTO_TEST_CASE(EvenOddFillLeavesOverlapEmpty)
+{
+    CEGUI::SVGData::TesselatedGeometryList geometry(1, createGeometry(CEGUI::PolygonFillRule::EvenOdd));
+    const glm::vec4 colour(0.0f, 0.0f, 1.0f, 1.0f);
+    appendQuad(geometry[0], 0.0f, 0.0f, 6.0f, 6.0f, colour);
+    appendQuad(geometry[0], 2.0f, 2.0f, 8.0f, 8.0f, colour);
+    // the quad drawn where the stencil test passes
+    appendQuad(geometry[0], 0.0f, 0.0f, 8.0f, 8.0f, colour);
+    geometry[0].d_postStencilVertexCount = 6;
+
+    std::vector<std::uint8_t> pixels;
+    CEGUI::SVGRasteriser::rasterise(geometry, glm::vec2(1.0f, 1.0f), glm::vec2(0.0f, 0.0f),
+                                    8, 8, pixels);
+
+    BOOST_CHECK_EQUAL(alphaAt(pixels, 8, 1, 1), 255);
+    BOOST_CHECK_EQUAL(alphaAt(pixels, 8, 3, 3), 0);
+    BOOST_CHECK_EQUAL(alphaAt(pixels, 8, 7, 7), 255);
+    BOOST_CHECK_EQUAL(alphaAt(pixels, 8, 7, 0), 0);
+
+    geometry[0].d_fillRule = CEGUI::PolygonFillRule::NonZero;
+    CEGUI::SVGRasteriser::rasterise(geometry, glm::vec2(1.0f, 1.0f), glm::vec2(0.0f, 0.0f),
+                                    8, 8, pixels);
+
+    BOOST_CHECK_EQUAL(alphaAt(pixels, 8, 3, 3), 255);
+    BOOST_CHECK_EQUAL(alphaAt(pixels, 8, 7, 0), 0);
+}
+
+BOOST_AUTO_TEST_CASE(RasterisedImagesShareTexturesWithinBudget)
+{
+    CEGUI::SVGData data("RasterisationTest");
+    data.setWidth(40.0f);
+    data.setHeight(20.0f);
+
+    CEGUI::SVGPaintStyle paint_style;
+    paint_style.d_fill.d_none = false;
+    paint_style.d_fill.d_colour = glm::vec3(1.0f, 0.0f, 0.0f);
+    paint_style.d_stroke.d_none = true;
+    data.addShape(new CEGUI::SVGRect(paint_style, glm::mat3(1.0f), 0.0f, 0.0f, 40.0f, 20.0f));
+
+    CEGUI::SVGImage image("RasterisationTest", data);
+    image.setUseRasterisation(true);
+    image.setRasterSizePolicy(CEGUI::SVGImage::RasterSizePolicy::Exact);
+
+    CEGUI::Renderer& renderer = *CEGUI::System::getSingleton().getRenderer();
+    const std::size_t initial_usage = CEGUI::SVGData::getRasterisationMemoryUsage();
+    const std::size_t initial_budget = CEGUI::SVGData::getRasterisationBudget();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        std::vector<CEGUI::GeometryBuffer*> buffers = image.createRenderGeometry(
+            CEGUI::ImageRenderSettings(CEGUI::Rectf(glm::vec2(i * 10.0f, 0.0f), CEGUI::Sizef(40.0f, 20.0f))));
+
+        BOOST_REQUIRE_EQUAL(buffers.size(), 1u);
+        BOOST_CHECK(buffers[0]->getTexture("texture0") != nullptr);
+        renderer.destroyGeometryBuffer(*buffers[0]);
+    }
+
+    BOOST_CHECK_EQUAL(CEGUI::SVGData::getRasterisationMemoryUsage() - initial_usage, 40u * 20u * 4u);
+
+    // A budget too small for a second size evicts the first one.
+    CEGUI::SVGData::setRasterisationBudget(initial_usage + 40u * 20u * 4u);
+
+    std::vector<CEGUI::GeometryBuffer*> buffers = image.createRenderGeometry(
+        CEGUI::ImageRenderSettings(CEGUI::Rectf(glm::vec2(0.0f, 0.0f), CEGUI::Sizef(20.0f, 10.0f))));
+    BOOST_REQUIRE_EQUAL(buffers.size(), 1u);
+    renderer.destroyGeometryBuffer(*buffers[0]);
+
+    BOOST_CHECK_EQUAL(CEGUI::SVGData::getRasterisationMemoryUsage() - initial_usage, 20u * 10u * 4u);
+
+    // Rasterisations that do not fit at all fall back to geometry.
+    CEGUI::SVGData::setRasterisationBudget(initial_usage);
+    buffers = image.createRenderGeometry(
+        CEGUI::ImageRenderSettings(CEGUI::Rectf(glm::vec2(0.0f, 0.0f), CEGUI::Sizef(80.0f, 40.0f))));
+    BOOST_CHECK(!buffers.empty());
+    for (CEGUI::GeometryBuffer* buffer : buffers)
+    {
+        BOOST_CHECK(buffer->getTexture("texture0") == nullptr);
+        renderer.destroyGeometryBuffer(*buffer);
+    }
+
+    CEGUI::SVGData::setRasterisationBudget(initial_budget);
+    CEGUI::SVGData::destroyRetiredRasterisations();
+}
+
+BOOST_AUTO_TEST_CASE(RasterisationsInUseAreNotEvicted)
+{
+    CEGUI::SVGData data("RasterisationInUseTest");
+    data.setWidth(40.0f);
+    data.setHeight(20.0f);
+
+    CEGUI::SVGPaintStyle paint_style;
+    paint_style.d_fill.d_none = false;
+    paint_style.d_fill.d_colour = glm::vec3(0.0f, 0.0f, 1.0f);
+    paint_style.d_stroke.d_none = true;
+    data.addShape(new CEGUI::SVGRect(paint_style, glm::mat3(1.0f), 0.0f, 0.0f, 40.0f, 20.0f));
+
+    CEGUI::SVGImage image("RasterisationInUseTest", data);
+    image.setUseRasterisation(true);
+    image.setRasterSizePolicy(CEGUI::SVGImage::RasterSizePolicy::Exact);
+
+    CEGUI::Renderer& renderer = *CEGUI::System::getSingleton().getRenderer();
+    const std::size_t initial_usage = CEGUI::SVGData::getRasterisationMemoryUsage();
+    const std::size_t initial_budget = CEGUI::SVGData::getRasterisationBudget();
+    CEGUI::SVGData::setRasterisationBudget(initial_usage + 40u * 20u * 4u);
+
+    // The geometry of the first size stays alive, as if a window still drew it.
+    std::vector<CEGUI::GeometryBuffer*> held = image.createRenderGeometry(
+        CEGUI::ImageRenderSettings(CEGUI::Rectf(glm::vec2(0.0f, 0.0f), CEGUI::Sizef(40.0f, 20.0f))));
+    BOOST_REQUIRE_EQUAL(held.size(), 1u);
+    const CEGUI::Texture* held_texture = held[0]->getTexture("texture0");
+    BOOST_REQUIRE(held_texture != nullptr);
+
+    // A second size does not fit and falls back to geometry instead of evicting it.
+    std::vector<CEGUI::GeometryBuffer*> buffers = image.createRenderGeometry(
+        CEGUI::ImageRenderSettings(CEGUI::Rectf(glm::vec2(0.0f, 0.0f), CEGUI::Sizef(20.0f, 10.0f))));
+    BOOST_CHECK(!buffers.empty());
+    for (CEGUI::GeometryBuffer* buffer : buffers)
+    {
+        BOOST_CHECK(buffer->getTexture("texture0") == nullptr);
+        renderer.destroyGeometryBuffer(*buffer);
+    }
+
+    BOOST_CHECK_EQUAL(CEGUI::SVGData::getRasterisationMemoryUsage() - initial_usage, 40u * 20u * 4u);
+    BOOST_CHECK(data.getCachedRasterisation(CEGUI::Rectf(0.0f, 0.0f, 40.0f, 20.0f),
+                                            CEGUI::Sizef(40.0f, 20.0f),
+                                            image.getUsesGeometryAntialiasing()) != nullptr);
+
+    // Once the geometry is gone, the rasterisation can be evicted.
+    renderer.destroyGeometryBuffer(*held[0]);
+    buffers = image.createRenderGeometry(
+        CEGUI::ImageRenderSettings(CEGUI::Rectf(glm::vec2(0.0f, 0.0f), CEGUI::Sizef(20.0f, 10.0f))));
+    BOOST_REQUIRE_EQUAL(buffers.size(), 1u);
+    BOOST_CHECK(buffers[0]->getTexture("texture0") != nullptr);
+    BOOST_CHECK(buffers[0]->getTexture("texture0") != held_texture);
+    renderer.destroyGeometryBuffer(*buffers[0]);
+
+    BOOST_CHECK_EQUAL(CEGUI::SVGData::getRasterisationMemoryUsage() - initial_usage, 20u * 10u * 4u);
+
+    CEGUI::SVGData::setRasterisationBudget(initial_budget);
+    CEGUI::SVGData::destroyRetiredRasterisations();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,274 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for the ScrollablePane and its content extents
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/widgets/ScrollablePane.h"
+#include "CEGUI/widgets/ScrolledContainer.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/CoordConverter.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <vector>
+
+/*
+ * Used to bring a ScrollablePane up for testing
+ *
+ * This is for exception safety, no matter what happens in the tests,
+ * its destructor will be called
+ */
+struct ScrollablePaneFixture
+{
+    ScrollablePaneFixture() :
+        d_contentChangedCount(0)
+    {
+        d_pane = static_cast<CEGUI::ScrollablePane*>(
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/ScrollablePane"));
+        d_pane->setSize(CEGUI::USize(cegui_absdim(200), cegui_absdim(100)));
+
+        d_container = const_cast<CEGUI::ScrolledContainer*>(d_pane->getContentPane());
+        d_container->subscribeEvent(CEGUI::ScrolledContainer::EventContentChanged,
+            CEGUI::Event::Subscriber(&ScrollablePaneFixture::handleContentChanged, this));
+    }
+
+    ~ScrollablePaneFixture()
+    {
+        if (CEGUI::System::getSingleton().getDefaultGUIContext().getRootWindow() == d_pane)
+            CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(nullptr);
+
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_pane);
+    }
+
+    //! Show the pane on screen, so that its children can be clipped by it.
+    void showPane()
+    {
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(d_pane);
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+    }
+
+    CEGUI::Window* addItem(float x, float y, float width, float height)
+    {
+        CEGUI::Window* item = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        item->setArea(CEGUI::UVector2(cegui_absdim(x), cegui_absdim(y)),
+                      CEGUI::USize(cegui_absdim(width), cegui_absdim(height)));
+        d_pane->addChild(item);
+
+        return item;
+    }
+
+    //! Compute the extents by going through all children, like they used to be.
+    CEGUI::Rectf scanChildExtents() const
+    {
+        CEGUI::Rectf extents(0, 0, 0, 0);
+        const CEGUI::Sizef& size = d_container->getPixelSize();
+
+        for (size_t i = 0; i < d_container->getChildCount(); ++i)
+        {
+            const CEGUI::Window* const wnd = d_container->getChildAtIdx(i);
+            CEGUI::Rectf area(CEGUI::CoordConverter::asAbsolute(wnd->getPosition(), size),
+                              wnd->getPixelSize());
+
+            if (wnd->getHorizontalAlignment() == CEGUI::HorizontalAlignment::Centre)
+                area.setPosition(area.getPosition() - glm::vec2(area.getWidth() * 0.5f - size.d_width * 0.5f, 0.0f));
+            if (wnd->getVerticalAlignment() == CEGUI::VerticalAlignment::Centre)
+                area.setPosition(area.getPosition() - glm::vec2(0.0f, area.getHeight() * 0.5f - size.d_height * 0.5f));
+
+            extents.d_min.x = std::min(extents.d_min.x, area.d_min.x);
+            extents.d_min.y = std::min(extents.d_min.y, area.d_min.y);
+            extents.d_max.x = std::max(extents.d_max.x, area.d_max.x);
+            extents.d_max.y = std::max(extents.d_max.y, area.d_max.y);
+        }
+
+        return extents;
+    }
+
+    bool handleContentChanged(const CEGUI::EventArgs&)
+    {
+        ++d_contentChangedCount;
+        return true;
+    }
+
+    CEGUI::ScrollablePane* d_pane;
+    CEGUI::ScrolledContainer* d_container;
+    int d_contentChangedCount;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ScrollablePane, ScrollablePaneFixture)
+
+BOOST_AUTO_TEST_CASE(ExtentsFollowChildren)
+{
+    CEGUI::Window* first = addItem(10, 10, 50, 20);
+    CEGUI::Window* second = addItem(-30, 40, 50, 20);
+    CEGUI::Window* third = addItem(0, 100, 300, 20);
+    BOOST_CHECK_EQUAL(d_container->getChildExtentsArea(), CEGUI::Rectf(-30, 0, 300, 120));
+    BOOST_CHECK_EQUAL(d_container->getContentArea(), CEGUI::Rectf(-30, 0, 300, 120));
+
+    // moving a child outwards extends the extents.
+    first->setPosition(CEGUI::UVector2(cegui_absdim(10), cegui_absdim(-15)));
+    BOOST_CHECK_EQUAL(d_container->getChildExtentsArea(), CEGUI::Rectf(-30, -15, 300, 120));
+
+    // moving or shrinking the children on the edges shrinks them again.
+    first->setPosition(CEGUI::UVector2(cegui_absdim(10), cegui_absdim(10)));
+    third->setWidth(cegui_absdim(100));
+    BOOST_CHECK_EQUAL(d_container->getChildExtentsArea(), CEGUI::Rectf(-30, 0, 100, 120));
+
+    // moving a child inside the extents leaves them unchanged.
+    first->setPosition(CEGUI::UVector2(cegui_absdim(20), cegui_absdim(20)));
+    BOOST_CHECK_EQUAL(d_container->getChildExtentsArea(), CEGUI::Rectf(-30, 0, 100, 120));
+
+    d_pane->removeChild(second);
+    BOOST_CHECK_EQUAL(d_container->getChildExtentsArea(), CEGUI::Rectf(0, 0, 100, 120));
+    BOOST_CHECK_EQUAL(d_container->getChildExtentsArea(), scanChildExtents());
+    CEGUI::WindowManager::getSingleton().destroyWindow(second);
+}
+
+BOOST_AUTO_TEST_CASE(ExtentsMatchScan)
+{
+    std::vector<CEGUI::Window*> items;
+    for (int i = 0; i < 50; ++i)
+        items.push_back(addItem(static_cast<float>((i * 37) % 200 - 100), static_cast<float>((i * 53) % 300 - 50),
+                                static_cast<float>(10 + i % 7), static_cast<float>(10 + i % 5)));
+
+    for (int step = 0; step < 500; ++step)
+    {
+        CEGUI::Window* item = items[(step * 31) % items.size()];
+        if (step % 3 == 0)
+            item->setHeight(cegui_absdim(static_cast<float>(5 + step % 40)));
+        else
+            item->setPosition(CEGUI::UVector2(cegui_absdim(static_cast<float>((step * 17) % 250 - 120)),
+                                              cegui_absdim(static_cast<float>((step * 29) % 330 - 60))));
+
+        if (step % 50 == 0)
+            item->setHorizontalAlignment(step % 100 ? CEGUI::HorizontalAlignment::Left :
+                                                      CEGUI::HorizontalAlignment::Centre);
+
+        BOOST_REQUIRE_EQUAL(d_container->getChildExtentsArea(), scanChildExtents());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CentredChildrenFollowResize)
+{
+    d_pane->setContentPaneAutoSized(false);
+    d_pane->setContentPaneArea(CEGUI::Rectf(0, 0, 200, 100));
+
+    CEGUI::Window* item = addItem(0, 0, 300, 20);
+    item->setHorizontalAlignment(CEGUI::HorizontalAlignment::Centre);
+    BOOST_CHECK_EQUAL(d_container->getChildExtentsArea(), CEGUI::Rectf(-50, 0, 250, 20));
+
+    d_pane->setContentPaneArea(CEGUI::Rectf(0, 0, 400, 100));
+    BOOST_CHECK_EQUAL(d_container->getChildExtentsArea(), CEGUI::Rectf(0, 0, 350, 20));
+}
+
+BOOST_AUTO_TEST_CASE(BatchedContentChanges)
+{
+    d_contentChangedCount = 0;
+
+    d_pane->beginInitialisation();
+    for (int i = 0; i < 20; ++i)
+        addItem(0, static_cast<float>(i * 20), 100, 20);
+    BOOST_CHECK_EQUAL(d_contentChangedCount, 0);
+
+    // the deferred notification may resize the pane's viewable area when the
+    // scrollbars appear, which notifies again, but not once per child.
+    d_pane->endInitialisation();
+    BOOST_CHECK_GE(d_contentChangedCount, 1);
+    BOOST_CHECK_LT(d_contentChangedCount, 5);
+    BOOST_CHECK_EQUAL(d_pane->getContentPaneArea(), CEGUI::Rectf(0, 0, 100, 400));
+
+    // without anything changed, ending initialisation does not notify again.
+    const int count = d_contentChangedCount;
+    d_pane->beginInitialisation();
+    d_pane->endInitialisation();
+    BOOST_CHECK_EQUAL(d_contentChangedCount, count);
+}
+
+BOOST_AUTO_TEST_CASE(CulledScrolling)
+{
+    showPane();
+    d_pane->setContentCullingEnabled(true);
+
+    std::vector<CEGUI::Window*> items;
+    for (int i = 0; i < 50; ++i)
+        items.push_back(addItem(0, static_cast<float>(i * 20), 150, 20));
+
+    const CEGUI::Rectf& viewport(d_container->getInnerRectClipper());
+
+    for (int step = 0; step <= 40; ++step)
+    {
+        d_pane->setVerticalScrollPosition(static_cast<float>((step * 7) % 41) / 40.0f);
+
+        for (const CEGUI::Window* item : items)
+        {
+            const CEGUI::Rectf area(item->getUnclippedOuterRect().getFresh());
+            const bool in_view = area.getIntersection(viewport).getHeight() > 0.0f;
+
+            // children in view are up to date, the others stay clipped away.
+            if (in_view)
+                BOOST_REQUIRE_EQUAL(item->getUnclippedOuterRect().get(), area);
+            else
+                BOOST_REQUIRE_EQUAL(item->getOuterRectClipper().getHeight(), 0.0f);
+        }
+    }
+
+    // disabling culling brings all children up to date.
+    d_pane->setContentCullingEnabled(false);
+    for (const CEGUI::Window* item : items)
+        BOOST_REQUIRE_EQUAL(item->getUnclippedOuterRect().get(), item->getUnclippedOuterRect().getFresh());
+}
+
+BOOST_AUTO_TEST_CASE(CulledDrawing)
+{
+    showPane();
+
+    std::vector<CEGUI::Window*> items;
+    for (int i = 0; i < 50; ++i)
+        items.push_back(addItem(0, static_cast<float>(i * 20), 150, 20));
+
+    int drawn_count = 0;
+    for (CEGUI::Window* item : items)
+        item->subscribeEvent(CEGUI::Window::EventRenderingStarted,
+            [&drawn_count]() { ++drawn_count; });
+
+    d_pane->setContentCullingEnabled(true);
+    d_pane->setVerticalScrollPosition(0.5f);
+    d_pane->draw();
+    BOOST_CHECK_GT(drawn_count, 0);
+    BOOST_CHECK_LE(drawn_count, 7);
+
+    // without culling every child is drawn.
+    d_pane->setContentCullingEnabled(false);
+    drawn_count = 0;
+    for (CEGUI::Window* item : items)
+        item->invalidate();
+    d_pane->draw();
+    BOOST_CHECK_EQUAL(drawn_count, 50);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for the shaped text run cache
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ShapedTextCache.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+CEGUI::ShapedTextCache::Run makeRun(size_t glyph_count)
+{
+    CEGUI::ShapedTextCache::Run run;
+    for (size_t i = 0; i < glyph_count; ++i)
+    {
+        const CEGUI::ShapedTextCache::Glyph glyph = {
+            static_cast<unsigned int>(i), static_cast<unsigned int>(i), 8.0f, 0.0f, 0.0f };
+        run.push_back(glyph);
+    }
+
+    return run;
+}
+
+const CEGUI::DefaultParagraphDirection LTR = CEGUI::DefaultParagraphDirection::LeftToRight;
+const CEGUI::DefaultParagraphDirection RTL = CEGUI::DefaultParagraphDirection::RightToLeft;
+}
+
+BOOST_AUTO_TEST_SUITE(ShapedTextCache)
+
+BOOST_AUTO_TEST_CASE(CountsHitsAndMisses)
+{
+    CEGUI::ShapedTextCache cache;
+
+    BOOST_CHECK(cache.find(U"Hello", LTR) == nullptr);
+    cache.insert(U"Hello", LTR, makeRun(5));
+
+    const CEGUI::ShapedTextCache::Run* run = cache.find(U"Hello", LTR);
+    BOOST_REQUIRE(run != nullptr);
+    BOOST_CHECK_EQUAL(run->size(), 5u);
+
+    // the paragraph direction is part of the key
+    BOOST_CHECK(cache.find(U"Hello", RTL) == nullptr);
+
+    BOOST_CHECK_EQUAL(cache.getHitCount(), 1u);
+    BOOST_CHECK_EQUAL(cache.getMissCount(), 2u);
+
+    cache.resetStatistics();
+    BOOST_CHECK_EQUAL(cache.getHitCount(), 0u);
+    BOOST_CHECK_EQUAL(cache.getMissCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(EvictsLeastRecentlyUsed)
+{
+    CEGUI::ShapedTextCache cache(10);
+
+    cache.insert(U"abcd", LTR, makeRun(4));
+    cache.insert(U"efgh", LTR, makeRun(4));
+    // use the first run so the second one is the least recently used
+    BOOST_CHECK(cache.find(U"abcd", LTR) != nullptr);
+
+    cache.insert(U"ijkl", LTR, makeRun(4));
+    BOOST_CHECK_EQUAL(cache.getGlyphCount(), 8u);
+    BOOST_CHECK_EQUAL(cache.getRunCount(), 2u);
+    BOOST_CHECK(cache.find(U"abcd", LTR) != nullptr);
+    BOOST_CHECK(cache.find(U"efgh", LTR) == nullptr);
+    BOOST_CHECK(cache.find(U"ijkl", LTR) != nullptr);
+
+    cache.setMaxGlyphCount(4);
+    BOOST_CHECK_EQUAL(cache.getRunCount(), 1u);
+    BOOST_CHECK(cache.find(U"ijkl", LTR) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(OversizedRunsAreNotCached)
+{
+    CEGUI::ShapedTextCache cache(4);
+    cache.insert(U"ab", LTR, makeRun(2));
+
+    const CEGUI::ShapedTextCache::Run& run = cache.insert(U"abcdef", LTR, makeRun(6));
+    BOOST_CHECK_EQUAL(run.size(), 6u);
+    BOOST_CHECK(cache.find(U"abcdef", LTR) == nullptr);
+    BOOST_CHECK(cache.find(U"ab", LTR) != nullptr);
+
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.getGlyphCount(), 0u);
+    BOOST_CHECK(cache.find(U"ab", LTR) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
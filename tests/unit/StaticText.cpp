@@ -0,0 +1,116 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for sizing FalagardStaticText to its content
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/CoordConverter.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+const char* const LongText =
+    "The quick brown fox jumps over the lazy dog. Pack my box with five "
+    "dozen liquor jugs. How vexingly quick daft zebras jump!";
+
+struct StaticTextFixture
+{
+    StaticTextFixture() :
+        d_sizedCount(0)
+    {
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(1, 0)));
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(d_root);
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        d_text = CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/StaticText");
+        d_root->addChild(d_text);
+        d_text->setProperty("HorzFormatting", "WordWrapLeftAligned");
+        d_text->setText(LongText);
+        d_text->subscribeEvent(CEGUI::Element::EventSized,
+            CEGUI::Event::Subscriber(&StaticTextFixture::handleSized, this));
+    }
+
+    ~StaticTextFixture()
+    {
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    bool handleSized(const CEGUI::EventArgs&)
+    {
+        ++d_sizedCount;
+        return true;
+    }
+
+    CEGUI::Sizef getMeasuredPixelSize() const
+    {
+        return d_text->constrainPixelSize(CEGUI::CoordConverter::asAbsolute(
+            d_text->getSizeAdjustedToContent(), d_root->getPixelSize(), false));
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::Window* d_text;
+    int d_sizedCount;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(StaticText, StaticTextFixture)
+
+BOOST_AUTO_TEST_CASE(MeasureDoesNotResize)
+{
+    d_text->setAspectMode(CEGUI::AspectMode::Expand);
+    d_text->setAspectRatio(3.f);
+    d_text->setAdjustWidthToContent(true);
+    d_text->setAdjustHeightToContent(true);
+
+    const CEGUI::Sizef adjusted(d_text->getPixelSize());
+    d_sizedCount = 0;
+
+    const CEGUI::Sizef measured(getMeasuredPixelSize());
+    BOOST_CHECK_EQUAL(d_sizedCount, 0);
+    BOOST_CHECK(d_text->getPixelSize() == adjusted);
+    BOOST_CHECK(measured == adjusted);
+}
+
+BOOST_AUTO_TEST_CASE(AdjustingResizesOnce)
+{
+    d_text->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 300)));
+    d_text->setAdjustWidthToContent(true);
+
+    d_sizedCount = 0;
+    d_text->setText(CEGUI::String(LongText) + " " + LongText);
+
+    // the bisection only measures; the result is applied in a single step
+    BOOST_CHECK_EQUAL(d_sizedCount, 1);
+    BOOST_CHECK(d_text->getPixelSize().d_width > 0.f);
+    BOOST_CHECK_EQUAL(d_text->getPixelSize().d_height, 300.f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
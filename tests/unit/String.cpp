@@ -26,12 +26,86 @@
  ***************************************************************************/
 
 #include "CEGUI/String.h"
+#include "CEGUI/Exceptions.h"
 
 #include <boost/test/unit_test.hpp>
 
 // it's not worth it to test std::string, is it?
 #if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
 
+namespace
+{
+// Straightforward per code point conversions the optimised ones must match.
+std::u32string referenceUtf8ToUtf32(const std::string& utf8)
+{
+    std::u32string result;
+    size_t i = 0;
+    while (i < utf8.size())
+    {
+        size_t consumed;
+        result.push_back(CEGUI::String::getCodePointFromCodeUnits(
+            utf8.data() + i, utf8.size() - i, consumed));
+        i += consumed;
+    }
+
+    return result;
+}
+
+std::string referenceUtf32ToUtf8(const std::u32string& utf32)
+{
+    std::string result;
+    for (const char32_t c : utf32)
+    {
+        if (c < 0x80)
+            result.push_back(static_cast<char>(c));
+        else if (c < 0x800)
+        {
+            result.push_back(static_cast<char>((c >> 6) | 0xC0));
+            result.push_back(static_cast<char>((c & 0x3F) | 0x80));
+        }
+        else if (c < 0x10000)
+        {
+            result.push_back(static_cast<char>((c >> 12) | 0xE0));
+            result.push_back(static_cast<char>(((c >> 6) & 0x3F) | 0x80));
+            result.push_back(static_cast<char>((c & 0x3F) | 0x80));
+        }
+        else
+        {
+            result.push_back(static_cast<char>((c >> 18) | 0xF0));
+            result.push_back(static_cast<char>(((c >> 12) & 0x3F) | 0x80));
+            result.push_back(static_cast<char>(((c >> 6) & 0x3F) | 0x80));
+            result.push_back(static_cast<char>((c & 0x3F) | 0x80));
+        }
+    }
+
+    return result;
+}
+
+// Build a string of runs taken from ASCII, Latin-1, CJK and emoji text.
+std::u32string makeMixedString(unsigned int seed, size_t length)
+{
+    static const char32_t samples[][4] = {
+        { U'a', U'Z', U'0', U' ' },
+        { 0xE9, 0xFC, 0xDF, 0xF1 },
+        { 0x4E2D, 0x6587, 0x5B57, 0x3042 },
+        { 0x1F600, 0x1F44D, 0x1F680, 0x10FFFF }
+    };
+
+    std::u32string result;
+    while (result.size() < length)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const unsigned int kind = (seed >> 16) % 4;
+        const size_t run = 1 + (seed >> 8) % 40;
+
+        for (size_t i = 0; i < run && result.size() < length; ++i)
+            result.push_back(samples[kind][(seed + i) % 4]);
+    }
+
+    return result;
+}
+}
+
 BOOST_AUTO_TEST_SUITE(String)
 
 BOOST_AUTO_TEST_CASE(ConstructionAssignment)
@@ -56,6 +130,81 @@ BOOST_AUTO_TEST_CASE(Operators)
     BOOST_CHECK(a != b);
 }
 
+BOOST_AUTO_TEST_CASE(TranscodeAllCodePoints)
+{
+    std::u32string all;
+    for (char32_t c = 0; c <= 0x10FFFF; ++c)
+        all.push_back(c);
+
+    const std::string utf8 = CEGUI::String::convertUtf32ToUtf8(all);
+    BOOST_CHECK(utf8 == referenceUtf32ToUtf8(all));
+    BOOST_CHECK(CEGUI::String::convertUtf8ToUtf32(utf8) == all);
+}
+
+BOOST_AUTO_TEST_CASE(TranscodeMixedStrings)
+{
+    for (unsigned int seed = 0; seed < 64; ++seed)
+    {
+        const std::u32string utf32 = makeMixedString(seed, 300);
+
+        // vary the start and length to cover every block boundary
+        for (size_t start = 0; start < 40; ++start)
+        {
+            const size_t length = (seed * 7 + start * 13) % (utf32.size() - start);
+            const std::u32string part = utf32.substr(start, length);
+
+            const std::string utf8 = CEGUI::String::convertUtf32ToUtf8(part);
+            BOOST_REQUIRE(utf8 == referenceUtf32ToUtf8(part));
+            BOOST_REQUIRE(CEGUI::String::convertUtf8ToUtf32(utf8) == part);
+            BOOST_REQUIRE(referenceUtf8ToUtf32(utf8) == part);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TranscodeAsciiBlocks)
+{
+    std::u32string utf32;
+    for (size_t i = 0; i < 200; ++i)
+    {
+        utf32.push_back(static_cast<char32_t>(i % 0x80));
+
+        const std::string utf8 = CEGUI::String::convertUtf32ToUtf8(utf32);
+        BOOST_REQUIRE(utf8 == referenceUtf32ToUtf8(utf32));
+        BOOST_REQUIRE(CEGUI::String::convertUtf8ToUtf32(utf8) == utf32);
+
+        // a single code point that is not ASCII at the end of the last block
+        std::u32string withEnd(utf32);
+        withEnd.push_back(0x80);
+        BOOST_REQUIRE(CEGUI::String::convertUtf32ToUtf8(withEnd) == referenceUtf32ToUtf8(withEnd));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TranscodeOutOfRangeUtf32)
+{
+    const std::u32string utf32 = U"0123456789abcdef0123456789abcdef" +
+        std::u32string(1, static_cast<char32_t>(0x110000)) +
+        std::u32string(1, static_cast<char32_t>(0x7FFFFFFF)) +
+        std::u32string(1, static_cast<char32_t>(0xFFFFFFFF)) +
+        U"0123456789abcdef0123456789abcdef";
+
+    BOOST_CHECK(CEGUI::String::convertUtf32ToUtf8(utf32) == referenceUtf32ToUtf8(utf32));
+}
+
+BOOST_AUTO_TEST_CASE(TranscodeInvalidUtf8)
+{
+    const std::string ascii(40, 'a');
+
+    // continuation byte without a start byte
+    BOOST_CHECK_THROW(CEGUI::String::convertUtf8ToUtf32(ascii + "\x80" + ascii),
+                      CEGUI::UnicodeStringException);
+    // invalid start byte
+    BOOST_CHECK_THROW(CEGUI::String::convertUtf8ToUtf32(ascii + "\xFF" + ascii),
+                      CEGUI::UnicodeStringException);
+    // truncated sequence at the end
+    BOOST_CHECK_THROW(CEGUI::String::convertUtf8ToUtf32(ascii + "\xE4\xB8"),
+                      CEGUI::UnicodeStringException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
@@ -0,0 +1,117 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+
+    purpose:    Tests for the TextureTarget pooling of the NullRenderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TextureTargetPool.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/RendererModules/Null/Renderer.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+CEGUI::NullRenderer& getRenderer()
+{
+    return *static_cast<CEGUI::NullRenderer*>(
+        CEGUI::System::getSingleton().getRenderer());
+}
+}
+
+BOOST_AUTO_TEST_SUITE(TextureTargetPool)
+
+BOOST_AUTO_TEST_CASE(SizeClassesRoundUp)
+{
+    CEGUI::TextureTargetPool pool;
+    pool.setSizeGranularity(64.0f);
+
+    BOOST_CHECK(pool.getSizeClass(CEGUI::Sizef(1.0f, 64.0f)) == CEGUI::Sizef(64.0f, 64.0f));
+    BOOST_CHECK(pool.getSizeClass(CEGUI::Sizef(65.0f, 200.5f)) == CEGUI::Sizef(128.0f, 256.0f));
+
+    pool.setSizeGranularity(1.0f);
+    BOOST_CHECK(pool.getSizeClass(CEGUI::Sizef(10.2f, 3.0f)) == CEGUI::Sizef(11.0f, 3.0f));
+}
+
+BOOST_AUTO_TEST_CASE(ReleasedTargetIsReused)
+{
+    CEGUI::NullRenderer& renderer = getRenderer();
+    const CEGUI::TextureTargetPool::Statistics initial =
+        renderer.getTextureTargetPool().getStatistics();
+
+    CEGUI::TextureTarget* first = renderer.createTextureTarget(false, CEGUI::Sizef(1000.0f, 650.0f));
+    // the target covers the requested size, its texture the size class
+    BOOST_CHECK(first->getArea().getSize() == CEGUI::Sizef(1000.0f, 650.0f));
+    BOOST_CHECK(first->getTexture().getSize() == CEGUI::Sizef(1024.0f, 704.0f));
+    renderer.destroyTextureTarget(first);
+
+    CEGUI::TextureTargetPool::Statistics stats = renderer.getTextureTargetPool().getStatistics();
+    BOOST_CHECK_EQUAL(stats.d_pooledTargetCount, initial.d_pooledTargetCount + 1);
+    BOOST_CHECK_EQUAL(stats.d_pooledBytes,
+                      initial.d_pooledBytes + 1024u * 704u * 4u);
+
+    // a slightly different size of the same class gets the same target back
+    CEGUI::TextureTarget* second = renderer.createTextureTarget(false, CEGUI::Sizef(1010.0f, 690.0f));
+    BOOST_CHECK_EQUAL(first, second);
+    BOOST_CHECK(second->getArea().getSize() == CEGUI::Sizef(1010.0f, 690.0f));
+
+    // a target with a stencil buffer is never handed out for one without
+    CEGUI::TextureTarget* stencilled = renderer.createTextureTarget(true, CEGUI::Sizef(1010.0f, 690.0f));
+    BOOST_CHECK(stencilled != second);
+    BOOST_CHECK(stencilled->getUsesStencil());
+
+    stats = renderer.getTextureTargetPool().getStatistics();
+    BOOST_CHECK_EQUAL(stats.d_reuseCount, initial.d_reuseCount + 1);
+    BOOST_CHECK_EQUAL(stats.d_targetCount, initial.d_targetCount + 2);
+
+    // the textures are held by size class, the requested areas are smaller
+    BOOST_CHECK_EQUAL(stats.d_bytesHeld,
+                      initial.d_bytesHeld + 1024u * 704u * (4u + 5u));
+    BOOST_CHECK_EQUAL(stats.d_bytesRequested,
+                      initial.d_bytesRequested + 1010u * 690u * (4u + 5u));
+
+    renderer.destroyTextureTarget(second);
+    renderer.destroyTextureTarget(stencilled);
+}
+
+BOOST_AUTO_TEST_CASE(FullPoolDeletesTargets)
+{
+    CEGUI::NullRenderer& renderer = getRenderer();
+    CEGUI::TextureTargetPool& pool = renderer.getTextureTargetPool();
+    const std::size_t max_bytes = pool.getMaxPooledBytes();
+    pool.setMaxPooledBytes(0);
+
+    // nothing pooled is large enough, so a new target gets created
+    const std::size_t initial_count = pool.getStatistics().d_targetCount;
+    CEGUI::TextureTarget* target = renderer.createTextureTarget(false, CEGUI::Sizef(4000.0f, 4000.0f));
+    BOOST_CHECK_EQUAL(pool.getStatistics().d_targetCount, initial_count + 1);
+    renderer.destroyTextureTarget(target);
+    BOOST_CHECK_EQUAL(pool.getStatistics().d_targetCount, initial_count);
+
+    pool.setMaxPooledBytes(max_bytes);
+}
+
+BOOST_AUTO_TEST_SUITE_END()